@@ -131,9 +131,17 @@ pub fn build(b: *std.Build) void {
         .windows => {},
         else => {
             compile_args.append(b.allocator, "-fPIC") catch @panic("OOM");
+            // -std=c99 hides usleep(), kill() and MAP_ANONYMOUS; php_config.h
+            // turns the system extensions on for phpize builds
+            compile_args.append(b.allocator, "-D_GNU_SOURCE") catch @panic("OOM");
         },
     }
 
+    // Inline cmpxchg16b for the shared monotonic ULID state (see src/monotonic.c)
+    if (target.result.cpu.arch == .x86_64) {
+        compile_args.append(b.allocator, "-mcx16") catch @panic("OOM");
+    }
+
     // Add optimization flags
     switch (optimize) {
         .ReleaseFast, .ReleaseSmall, .ReleaseSafe => {
@@ -163,6 +171,8 @@ pub fn build(b: *std.Build) void {
         .windows => {},
         else => {
             compile_args.append(b.allocator, "-lm") catch @panic("OOM");
+            // config.h defines HAVE_PTHREAD_H for the generateBatch() workers
+            compile_args.append(b.allocator, "-lpthread") catch @panic("OOM");
         },
     }
 
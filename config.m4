@@ -29,13 +29,47 @@ if test "$PHP_IDENTIFIER" != "no"; then
   dnl Define the extension
   AC_DEFINE(HAVE_IDENTIFIER, 1, [Whether you have identifier extension])
 
+  dnl Worker threads for generateBatch()
+  AC_CHECK_HEADERS([pthread.h], [
+    PHP_ADD_LIBRARY(pthread, 1, IDENTIFIER_SHARED_LIBADD)
+    PHP_SUBST(IDENTIFIER_SHARED_LIBADD)
+  ])
+
+  dnl A 16-byte compare-and-swap for the shared monotonic ULID state: x86-64
+  dnl compilers only inline cmpxchg16b with -mcx16
+  IDENTIFIER_CFLAGS=""
+  AC_MSG_CHECKING([whether the compiler inlines a 16-byte compare-and-swap])
+  identifier_save_CFLAGS=$CFLAGS
+  for identifier_flag in "" "-mcx16"; do
+    CFLAGS="$identifier_save_CFLAGS $identifier_flag"
+    AC_COMPILE_IFELSE([AC_LANG_PROGRAM([], [[
+#if !defined(__SIZEOF_INT128__) || !defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+# error no inline 16-byte CAS
+#endif
+    ]])], [identifier_cas16=yes; IDENTIFIER_CFLAGS=$identifier_flag], [identifier_cas16=no])
+    test "$identifier_cas16" = "yes" && break
+  done
+  CFLAGS=$identifier_save_CFLAGS
+  AC_MSG_RESULT([$identifier_cas16 $IDENTIFIER_CFLAGS])
+
   dnl Source files to compile
   identifier_sources="src/php_identifier.c \
+    src/batch.c \
     src/bit128.c \
+    src/bit128_set.c \
+    src/bit128_vector.c \
     src/codec.c \
     src/context.c \
     src/context_fixed.c \
     src/context_system.c \
+    src/functions.c \
+    src/generator.c \
+    src/hybrid_clock.c \
+    src/monotonic.c \
+    src/reservoir.c \
+    src/sequence.c \
+    src/snowflake.c \
+    src/state_file.c \
     src/ulid.c \
     src/uuid.c \
     src/uuid_version1.c \
@@ -43,10 +77,12 @@ if test "$PHP_IDENTIFIER" != "no"; then
     src/uuid_version4.c \
     src/uuid_version5.c \
     src/uuid_version6.c \
-    src/uuid_version7.c"
+    src/uuid_version7.c \
+    src/worker.c"
 
   dnl Register the extension
-  PHP_NEW_EXTENSION(identifier, $identifier_sources, $ext_shared)
+  PHP_NEW_EXTENSION(identifier, $identifier_sources, $ext_shared,, $IDENTIFIER_CFLAGS)
+  PHP_ADD_EXTENSION_DEP(identifier, spl)
 
   dnl Add compiler flags
   PHP_ADD_BUILD_DIR($ext_builddir/src)
@@ -0,0 +1,216 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "zend_exceptions.h"
+#include "php_identifier.h"
+#include <string.h>
+
+/* Worker threads need a CSPRNG that does not touch request globals */
+#if defined(HAVE_PTHREAD_H) && !defined(PHP_WIN32) && \
+    (defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__))
+# define PHP_IDENTIFIER_BATCH_THREADS 1
+# include <pthread.h>
+# include <errno.h>
+# ifdef __linux__
+#  include <sys/random.h>
+# else
+#  include <stdlib.h>
+# endif
+#endif
+
+/* Never split a batch into slices smaller than this */
+#define PHP_IDENTIFIER_BATCH_MIN_SLICE 16384
+
+/* Validate generateBatch() arguments and allocate the packed count * 16 byte
+ * buffer the generators fill. Returns NULL with an exception set on error. */
+zend_string *php_identifier_batch_alloc(zend_long count, zend_long format)
+{
+    if (count < 0 || (zend_ulong)count > (ZSTR_MAX_LEN / 16)) {
+        zend_throw_exception(zend_ce_exception, "Batch count must be a non-negative integer", 0);
+        return NULL;
+    }
+
+    if (format < PHP_IDENTIFIER_BATCH_OBJECTS || format > PHP_IDENTIFIER_BATCH_BINARY) {
+        zend_throw_exception(zend_ce_exception, "Batch format must be one of the Bit128::BATCH_* constants", 0);
+        return NULL;
+    }
+
+    zend_string *packed = zend_string_alloc((size_t)count * 16, 0);
+    ZSTR_VAL(packed)[ZSTR_LEN(packed)] = '\0';
+
+    return packed;
+}
+
+/* Hand a filled batch back in the requested format. Takes ownership of
+ * packed, which is returned as-is for BATCH_BINARY. */
+void php_identifier_batch_return(zval *return_value, zend_string *packed, zend_class_entry *ce, zend_long format, php_identifier_format string_format)
+{
+    if (format == PHP_IDENTIFIER_BATCH_BINARY) {
+        RETURN_STR(packed);
+    }
+
+    size_t count = ZSTR_LEN(packed) / 16;
+    const unsigned char *bytes = (const unsigned char *)ZSTR_VAL(packed);
+
+    array_init_size(return_value, (uint32_t)count);
+    if (count == 0) {
+        zend_string_release(packed);
+        return;
+    }
+
+    zend_hash_real_init_packed(Z_ARRVAL_P(return_value));
+
+    ZEND_HASH_FILL_PACKED(Z_ARRVAL_P(return_value)) {
+        for (size_t i = 0; i < count; i++, bytes += 16) {
+            zval element;
+
+            if (format == PHP_IDENTIFIER_BATCH_STRINGS) {
+                size_t length = string_format == PHP_IDENTIFIER_FORMAT_ULID ? 26 : 36;
+                zend_string *str = zend_string_alloc(length, 0);
+
+                if (string_format == PHP_IDENTIFIER_FORMAT_ULID) {
+                    php_identifier_format_ulid(bytes, ZSTR_VAL(str));
+                } else {
+                    php_identifier_format_uuid(bytes, ZSTR_VAL(str));
+                }
+                ZVAL_STR(&element, str);
+            } else {
+                object_init_ex(&element, ce);
+                php_identifier_bit128_fill(PHP_IDENTIFIER_BIT128_OBJ_P(&element), bytes);
+            }
+
+            ZEND_HASH_FILL_SET(&element);
+            ZEND_HASH_FILL_NEXT();
+        }
+    } ZEND_HASH_FILL_END();
+
+    zend_string_release(packed);
+}
+
+/* Number of threads to fill count identifiers with: the request, capped by
+ * the slice size and PHP_IDENTIFIER_BATCH_MAX_THREADS, and always 1 when the
+ * build has no thread support. Returns 0 with an exception set if the
+ * request is invalid. */
+uint32_t php_identifier_batch_threads(zend_long requested, size_t count)
+{
+    if (requested < 1 || requested > PHP_IDENTIFIER_BATCH_MAX_THREADS) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Batch threads must be between 1 and %d", PHP_IDENTIFIER_BATCH_MAX_THREADS);
+        return 0;
+    }
+
+#ifdef PHP_IDENTIFIER_BATCH_THREADS
+    size_t slices = count / PHP_IDENTIFIER_BATCH_MIN_SLICE;
+    if (slices < (size_t)requested) {
+        return slices > 1 ? (uint32_t)slices : 1;
+    }
+    return (uint32_t)requested;
+#else
+    (void)count;
+    return 1;
+#endif
+}
+
+/* Fill length bytes from the OS CSPRNG. Safe to call from worker threads. */
+bool php_identifier_batch_random(unsigned char *buffer, size_t length)
+{
+#if defined(PHP_IDENTIFIER_BATCH_THREADS) && defined(__linux__)
+    while (length > 0) {
+        /* getrandom() returns at most 32 MiB - 1 per call */
+        ssize_t n = getrandom(buffer, length > 33554431 ? 33554431 : length, 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        buffer += n;
+        length -= (size_t)n;
+    }
+    return true;
+#elif defined(PHP_IDENTIFIER_BATCH_THREADS)
+    arc4random_buf(buffer, length);
+    return true;
+#else
+    (void)buffer;
+    (void)length;
+    return false;
+#endif
+}
+
+#ifdef PHP_IDENTIFIER_BATCH_THREADS
+typedef struct _php_identifier_batch_slice {
+    unsigned char *bytes;
+    size_t start;
+    size_t count;
+    php_identifier_batch_fill_fn fill;
+    const void *arg;
+    bool ok;
+} php_identifier_batch_slice;
+
+static void *php_identifier_batch_worker(void *data)
+{
+    php_identifier_batch_slice *slice = data;
+
+    slice->ok = slice->fill(slice->bytes + slice->start * 16, slice->start, slice->count, slice->arg);
+
+    return NULL;
+}
+#endif
+
+/* Split count identifiers into one contiguous slice per thread and fill them
+ * in parallel. fill must only write its own slice and must not call into the
+ * engine. A slice whose thread cannot be started runs on the calling thread.
+ * Returns FAILURE with an exception set if any slice failed. */
+zend_result php_identifier_batch_parallel(unsigned char *bytes, size_t count, uint32_t threads,
+    php_identifier_batch_fill_fn fill, const void *arg)
+{
+#ifdef PHP_IDENTIFIER_BATCH_THREADS
+    php_identifier_batch_slice slices[PHP_IDENTIFIER_BATCH_MAX_THREADS];
+    pthread_t handles[PHP_IDENTIFIER_BATCH_MAX_THREADS];
+    bool started[PHP_IDENTIFIER_BATCH_MAX_THREADS];
+    size_t per_slice = count / threads;
+    size_t start = 0;
+    bool ok = true;
+
+    for (uint32_t t = 0; t < threads; t++) {
+        slices[t].bytes = bytes;
+        slices[t].start = start;
+        slices[t].count = (t == threads - 1) ? count - start : per_slice;
+        slices[t].fill = fill;
+        slices[t].arg = arg;
+        slices[t].ok = false;
+        start += slices[t].count;
+    }
+
+    /* The calling thread takes slice 0 itself */
+    for (uint32_t t = 1; t < threads; t++) {
+        started[t] = pthread_create(&handles[t], NULL, php_identifier_batch_worker, &slices[t]) == 0;
+    }
+
+    php_identifier_batch_worker(&slices[0]);
+
+    for (uint32_t t = 1; t < threads; t++) {
+        if (started[t]) {
+            pthread_join(handles[t], NULL);
+        } else {
+            php_identifier_batch_worker(&slices[t]);
+        }
+    }
+
+    for (uint32_t t = 0; t < threads; t++) {
+        ok = ok && slices[t].ok;
+    }
+#else
+    bool ok = fill(bytes, 0, count, arg);
+    (void)threads;
+#endif
+
+    if (!ok) {
+        zend_throw_exception(zend_ce_exception, "Failed to generate secure random bytes for batch", 0);
+        return FAILURE;
+    }
+
+    return SUCCESS;
+}
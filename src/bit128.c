@@ -38,9 +38,505 @@ ZEND_END_ARG_INFO()
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_toString, 0, 0, IS_STRING, 0)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_serialize, 0, 0, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_unserialize, 0, 1, IS_VOID, 0)
+    ZEND_ARG_TYPE_INFO(0, data, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_set_state, 0, 1, IS_STATIC, 0)
+    ZEND_ARG_TYPE_INFO(0, properties, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_sortArray, 0, 1, IS_VOID, 0)
+    ZEND_ARG_TYPE_INFO(1, ids, IS_ARRAY, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, descending, _IS_BOOL, 0, "false")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, byTime, _IS_BOOL, 0, "false")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_bit128_binarySearch, 0, 2, MAY_BE_LONG|MAY_BE_FALSE)
+    ZEND_ARG_TYPE_INFO(0, sorted, IS_ARRAY, 0)
+    ZEND_ARG_OBJ_INFO(0, needle, Identifier\\Bit128, 0)
+ZEND_END_ARG_INFO()
+
 /* Bit128 object handlers */
 static zend_object_handlers php_identifier_bit128_object_handlers;
 
+static const char php_identifier_hex_digits[] = "0123456789abcdef";
+
+/* Format 16 bytes as 32 lowercase hex characters (output must hold 33 bytes) */
+void php_identifier_format_hex(const unsigned char *bytes, char *output)
+{
+    for (int i = 0; i < 16; i++) {
+        output[i * 2] = php_identifier_hex_digits[bytes[i] >> 4];
+        output[i * 2 + 1] = php_identifier_hex_digits[bytes[i] & 0x0F];
+    }
+    output[32] = '\0';
+}
+
+/* Hex digit values, -1 for anything else */
+const int8_t php_identifier_hex_values[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+/* Parse exactly 32 hex digits without allocating */
+php_identifier_parse_result php_identifier_parse_hex(const char *str, size_t len, unsigned char *bytes)
+{
+    if (len != 32) {
+        return PHP_IDENTIFIER_PARSE_LENGTH;
+    }
+
+    for (int i = 0; i < 16; i++) {
+        int high = php_identifier_hex_values[(unsigned char)str[i * 2]];
+        int low = php_identifier_hex_values[(unsigned char)str[i * 2 + 1]];
+
+        if ((high | low) < 0) {
+            return PHP_IDENTIFIER_PARSE_CHARACTER;
+        }
+        bytes[i] = (unsigned char)((high << 4) | low);
+    }
+
+    return PHP_IDENTIFIER_PARSE_OK;
+}
+
+/* Parse 32 hex digits with any number of dashes in between */
+php_identifier_parse_result php_identifier_parse_hex_dashed(const char *str, size_t len, unsigned char *bytes)
+{
+    size_t digits = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        if (str[i] == '-') {
+            continue;
+        }
+
+        int value = php_identifier_hex_values[(unsigned char)str[i]];
+        if (value < 0) {
+            return PHP_IDENTIFIER_PARSE_CHARACTER;
+        }
+        if (digits == 32) {
+            return PHP_IDENTIFIER_PARSE_LENGTH;
+        }
+
+        if (digits & 1) {
+            bytes[digits >> 1] |= (unsigned char)value;
+        } else {
+            bytes[digits >> 1] = (unsigned char)(value << 4);
+        }
+        digits++;
+    }
+
+    return digits == 32 ? PHP_IDENTIFIER_PARSE_OK : PHP_IDENTIFIER_PARSE_LENGTH;
+}
+
+/* Parse the canonical xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx form */
+php_identifier_parse_result php_identifier_parse_uuid(const char *str, size_t len, unsigned char *bytes)
+{
+    /* Offsets of the high nibble of each byte */
+    static const uint8_t offsets[16] = {0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+
+    if (len != 36) {
+        return PHP_IDENTIFIER_PARSE_LENGTH;
+    }
+
+    if (str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
+        return PHP_IDENTIFIER_PARSE_FORMAT;
+    }
+
+    for (int i = 0; i < 16; i++) {
+        int high = php_identifier_hex_values[(unsigned char)str[offsets[i]]];
+        int low = php_identifier_hex_values[(unsigned char)str[offsets[i] + 1]];
+
+        if ((high | low) < 0) {
+            return PHP_IDENTIFIER_PARSE_CHARACTER;
+        }
+        bytes[i] = (unsigned char)((high << 4) | low);
+    }
+
+    return PHP_IDENTIFIER_PARSE_OK;
+}
+
+/* Dashed hex parsing for fromHex(); throws with the kind ("UUID", "ULID") in the message */
+bool php_identifier_parse_hex_string(const zend_string *str, const char *kind, unsigned char *bytes)
+{
+    switch (php_identifier_parse_hex_dashed(ZSTR_VAL(str), ZSTR_LEN(str), bytes)) {
+        case PHP_IDENTIFIER_PARSE_OK:
+            return true;
+        case PHP_IDENTIFIER_PARSE_LENGTH:
+            zend_throw_exception_ex(zend_ce_exception, 0, "%s hex string must be exactly 32 characters (excluding dashes)", kind);
+            return false;
+        default:
+            zend_throw_exception_ex(zend_ce_exception, 0, "Invalid hexadecimal character in %s", kind);
+            return false;
+    }
+}
+
+/* Drop cached representations after the payload changes */
+void php_identifier_bit128_reset_cache(php_identifier_bit128_obj *intern)
+{
+    if (intern->str_cache) {
+        zend_string_release(intern->str_cache);
+        intern->str_cache = NULL;
+    }
+    if (intern->bytes_cache) {
+        zend_string_release(intern->bytes_cache);
+        intern->bytes_cache = NULL;
+    }
+}
+
+/* Canonical string in the given format, served from the per-object cache
+ * when identifier.string_cache is enabled */
+zend_string *php_identifier_bit128_format(php_identifier_bit128_obj *intern, php_identifier_format format)
+{
+    if (intern->str_cache && intern->str_cache_format == format) {
+        return zend_string_copy(intern->str_cache);
+    }
+
+    zend_string *result;
+
+    switch (format) {
+        case PHP_IDENTIFIER_FORMAT_UUID:
+            result = zend_string_alloc(36, 0);
+            php_identifier_format_uuid(intern->data, ZSTR_VAL(result));
+            break;
+        case PHP_IDENTIFIER_FORMAT_ULID:
+            result = zend_string_alloc(26, 0);
+            php_identifier_format_ulid(intern->data, ZSTR_VAL(result));
+            break;
+        default:
+            result = zend_string_alloc(32, 0);
+            php_identifier_format_hex(intern->data, ZSTR_VAL(result));
+            break;
+    }
+
+    if (IDENTIFIER_G(string_cache)) {
+        if (intern->str_cache) {
+            zend_string_release(intern->str_cache);
+        }
+        intern->str_cache = zend_string_copy(result);
+        intern->str_cache_format = format;
+    }
+
+    return result;
+}
+
+/* Raw 16-byte payload as a string, cached like the canonical string */
+zend_string *php_identifier_bit128_bytes(php_identifier_bit128_obj *intern)
+{
+    if (intern->bytes_cache) {
+        return zend_string_copy(intern->bytes_cache);
+    }
+
+    zend_string *result = zend_string_init((char *)intern->data, 16, 0);
+
+    if (IDENTIFIER_G(string_cache)) {
+        intern->bytes_cache = zend_string_copy(result);
+    }
+
+    return result;
+}
+
+/* Build the canonical string of any Bit128 instance without a method call
+ * for the built-in classes. Returns NULL with an exception set on failure. */
+zend_string *php_identifier_bit128_to_string(zend_object *object)
+{
+    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ(object);
+    zend_function *fn = zend_hash_str_find_ptr(&object->ce->function_table, "tostring", sizeof("tostring") - 1);
+    zend_class_entry *scope = fn ? fn->common.scope : NULL;
+
+    if (scope == php_identifier_uuid_ce) {
+        return php_identifier_bit128_format(intern, PHP_IDENTIFIER_FORMAT_UUID);
+    }
+
+    if (scope == php_identifier_ulid_ce) {
+        return php_identifier_bit128_format(intern, PHP_IDENTIFIER_FORMAT_ULID);
+    }
+
+    if (scope == php_identifier_bit128_ce || fn == NULL) {
+        return php_identifier_bit128_format(intern, PHP_IDENTIFIER_FORMAT_HEX);
+    }
+
+    /* toString() is overridden in userland: honour it */
+    zval retval;
+    zend_call_known_instance_method_with_0_params(fn, object, &retval);
+
+    if (Z_TYPE(retval) != IS_STRING) {
+        zval_ptr_dtor(&retval);
+        if (!EG(exception)) {
+            zend_throw_exception(zend_ce_exception, "toString() must return a string", 0);
+        }
+        return NULL;
+    }
+
+    return Z_STR(retval);
+}
+
+/* Order identifiers by their 16-byte payload, regardless of class;
+ * other objects are uncomparable */
+static int php_identifier_bit128_compare_objects(zval *o1, zval *o2)
+{
+    ZEND_COMPARE_OBJECTS_FALLBACK(o1, o2);
+
+    /* zend_compare() picks the handler of either operand: the other one
+     * may be any object and has no payload to read */
+    if (!instanceof_function(Z_OBJCE_P(o1), php_identifier_bit128_ce)
+        || !instanceof_function(Z_OBJCE_P(o2), php_identifier_bit128_ce)) {
+        return ZEND_UNCOMPARABLE;
+    }
+
+    php_identifier_bit128_obj *a = PHP_IDENTIFIER_BIT128_OBJ_P(o1);
+    php_identifier_bit128_obj *b = PHP_IDENTIFIER_BIT128_OBJ_P(o2);
+
+    return ZEND_NORMALIZE_BOOL(memcmp(a->data, b->data, 16));
+}
+
+/* String casts skip the __toString() call unless a subclass overrides it */
+static zend_result php_identifier_bit128_cast_object(zend_object *readobj, zval *retval, int type)
+{
+    if (type == IS_STRING
+        && readobj->ce->__tostring
+        && readobj->ce->__tostring->common.scope == php_identifier_bit128_ce) {
+        zend_string *str = php_identifier_bit128_to_string(readobj);
+        if (!str) {
+            return FAILURE;
+        }
+        ZVAL_STR(retval, str);
+        return SUCCESS;
+    }
+
+    return zend_std_cast_object_tostring(readobj, retval, type);
+}
+
+/* Whether an identifier has properties: only userland subclasses declare
+ * any, and zend_std_get_properties() would build an empty table otherwise */
+static zend_always_inline bool php_identifier_bit128_has_properties(const zend_object *object)
+{
+    return object->properties || object->ce->default_properties_count;
+}
+
+/* Copy of the properties to add entries to, without building the table of a
+ * property-less identifier */
+static HashTable *php_identifier_bit128_properties_copy(zend_object *object, uint32_t extra)
+{
+    if (!php_identifier_bit128_has_properties(object)) {
+        return zend_new_array(extra);
+    }
+
+    return zend_array_dup(zend_std_get_properties(object));
+}
+
+/* Show the canonical value in var_dump() and print_r(), and the hex payload
+ * in var_export() */
+static HashTable *php_identifier_bit128_get_properties_for(zend_object *object, zend_prop_purpose purpose)
+{
+    if (purpose == ZEND_PROP_PURPOSE_VAR_EXPORT) {
+        /* Hex keeps var_export() output printable; __set_state() reads it back */
+        HashTable *props = php_identifier_bit128_properties_copy(object, 1);
+        zend_string *hex = zend_string_alloc(32, 0);
+        zval value;
+
+        php_identifier_format_hex(PHP_IDENTIFIER_BIT128_OBJ(object)->data, ZSTR_VAL(hex));
+        ZVAL_STR(&value, hex);
+        zend_hash_str_update(props, "hex", sizeof("hex") - 1, &value);
+        return props;
+    }
+
+    if (purpose != ZEND_PROP_PURPOSE_DEBUG) {
+        if (!php_identifier_bit128_has_properties(object)) {
+            return (HashTable *)&zend_empty_array;
+        }
+        return zend_std_get_properties_for(object, purpose);
+    }
+
+    HashTable *props = php_identifier_bit128_properties_copy(object, 1);
+    zend_string *str = php_identifier_bit128_to_string(object);
+
+    if (str) {
+        zval value;
+        ZVAL_STR(&value, str);
+        zend_hash_str_update(props, "value", sizeof("value") - 1, &value);
+    } else {
+        zend_clear_exception();
+    }
+
+    return props;
+}
+
+/* Below this many records an insertion sort beats the 16 radix passes */
+#define PHP_IDENTIFIER_RADIX_THRESHOLD 64
+
+/* Largest record size accepted by php_identifier_radix_sort() */
+#define PHP_IDENTIFIER_RADIX_MAX_RECORD 32
+
+static void php_identifier_insertion_sort(unsigned char *records, size_t count, size_t size)
+{
+    unsigned char tmp[PHP_IDENTIFIER_RADIX_MAX_RECORD];
+
+    for (size_t i = 1; i < count; i++) {
+        size_t j = i;
+
+        if (memcmp(records + (j - 1) * size, records + i * size, 16) <= 0) {
+            continue;
+        }
+
+        memcpy(tmp, records + i * size, size);
+        while (j > 0 && memcmp(records + (j - 1) * size, tmp, 16) > 0) {
+            j--;
+        }
+        memmove(records + (j + 1) * size, records + j * size, (i - j) * size);
+        memcpy(records + j * size, tmp, size);
+    }
+}
+
+/* Stable ascending sort of fixed-size records whose first 16 bytes are a
+ * big-endian key. LSD radix sort, one pass per key byte; passes over a byte
+ * that is the same in every record (common for timestamp prefixes) are
+ * skipped. Records are raw identifiers (size 16) or sort records. */
+void php_identifier_radix_sort(void *base, size_t count, size_t size)
+{
+    unsigned char *records = base;
+
+    ZEND_ASSERT(size >= 16 && size <= PHP_IDENTIFIER_RADIX_MAX_RECORD);
+
+    if (count < 2) {
+        return;
+    }
+
+    if (count <= PHP_IDENTIFIER_RADIX_THRESHOLD) {
+        php_identifier_insertion_sort(records, count, size);
+        return;
+    }
+
+    size_t (*histogram)[256] = ecalloc(16, sizeof(*histogram));
+    unsigned char *scratch = safe_emalloc(count, size, 0);
+    unsigned char *src = records;
+    unsigned char *dst = scratch;
+
+    /* Count every byte position in a single sweep */
+    for (size_t i = 0; i < count; i++) {
+        const unsigned char *key = records + i * size;
+        for (int b = 0; b < 16; b++) {
+            histogram[b][key[b]]++;
+        }
+    }
+
+    for (int b = 15; b >= 0; b--) {
+        size_t *counts = histogram[b];
+
+        if (counts[src[b]] == count) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (int v = 0; v < 256; v++) {
+            size_t n = counts[v];
+            counts[v] = offset;
+            offset += n;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            const unsigned char *record = src + i * size;
+            memcpy(dst + counts[record[b]]++ * size, record, size);
+        }
+
+        unsigned char *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != records) {
+        memcpy(records, src, count * size);
+    }
+
+    efree(scratch);
+    efree(histogram);
+}
+
+/* Reverse an array of fixed-size records in place */
+void php_identifier_reverse_records(void *base, size_t count, size_t size)
+{
+    unsigned char *records = base;
+    unsigned char tmp[PHP_IDENTIFIER_RADIX_MAX_RECORD];
+
+    ZEND_ASSERT(size <= PHP_IDENTIFIER_RADIX_MAX_RECORD);
+
+    for (size_t i = 0, j = count ? count - 1 : 0; i < j; i++, j--) {
+        memcpy(tmp, records + i * size, size);
+        memcpy(records + i * size, records + j * size, size);
+        memcpy(records + j * size, tmp, size);
+    }
+}
+
+/* Binary search over ascending 16-byte records; returns -1 when missing */
+zend_long php_identifier_bsearch(const unsigned char *records, size_t count, const unsigned char *needle)
+{
+    size_t low = 0;
+    size_t high = count;
+
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        int result = memcmp(records + mid * 16, needle, 16);
+
+        if (result == 0) {
+            return (zend_long)mid;
+        }
+        if (result < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return -1;
+}
+
+/* Sort key for an identifier. With by_time, Version1 payloads are rewritten
+ * into the Version6 field order so that byte order matches time order. */
+void php_identifier_sort_key(zend_object *object, bool by_time, unsigned char *key)
+{
+    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ(object);
+    const unsigned char *data = intern->data;
+
+    if (!by_time || object->ce != php_identifier_uuid_version1_ce) {
+        memcpy(key, data, 16);
+        return;
+    }
+
+    uint64_t timestamp = ((uint64_t)(data[6] & 0x0F) << 56) |
+                         ((uint64_t)data[7] << 48) |
+                         ((uint64_t)data[4] << 40) |
+                         ((uint64_t)data[5] << 32) |
+                         ((uint64_t)data[0] << 24) |
+                         ((uint64_t)data[1] << 16) |
+                         ((uint64_t)data[2] << 8) |
+                         ((uint64_t)data[3]);
+
+    key[0] = (timestamp >> 52) & 0xFF;
+    key[1] = (timestamp >> 44) & 0xFF;
+    key[2] = (timestamp >> 36) & 0xFF;
+    key[3] = (timestamp >> 28) & 0xFF;
+    key[4] = (timestamp >> 20) & 0xFF;
+    key[5] = (timestamp >> 12) & 0xFF;
+    key[6] = 0x60 | ((timestamp >> 8) & 0x0F);
+    key[7] = timestamp & 0xFF;
+    memcpy(key + 8, data + 8, 8);
+}
+
 /* Bit128 methods */
 
 /**
@@ -66,13 +562,21 @@ static PHP_METHOD(Identifier_Bit128, __construct)
         Z_PARAM_STR(bytes)
     ZEND_PARSE_PARAMETERS_END();
 
+    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(getThis());
+
+    /* Identifiers are values, and some instances are shared per request */
+    if (intern->initialized) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Cannot modify an already initialized %s", ZSTR_VAL(Z_OBJCE_P(getThis())->name));
+        RETURN_THROWS();
+    }
+
     if (ZSTR_LEN(bytes) != 16) {
         zend_throw_exception(zend_ce_exception, "Bytes must be exactly 16 bytes long", 0);
         RETURN_THROWS();
     }
 
-    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(getThis());
-    memcpy(intern->data, ZSTR_VAL(bytes), 16);
+    php_identifier_bit128_fill(intern, ZSTR_VAL(bytes));
+    php_identifier_bit128_reset_cache(intern);
 }
 
 /**
@@ -94,7 +598,7 @@ static PHP_METHOD(Identifier_Bit128, __construct)
 static PHP_METHOD(Identifier_Bit128, getBytes)
 {
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(getThis());
-    RETURN_STRINGL((char*)intern->data, 16);
+    RETURN_STR(php_identifier_bit128_bytes(intern));
 }
 
 /**
@@ -201,13 +705,7 @@ static PHP_METHOD(Identifier_Bit128, toHex)
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(getThis());
     
     zend_string *result = zend_string_alloc(32, 0);
-    char *hex = ZSTR_VAL(result);
-    
-    for (int i = 0; i < 16; i++) {
-        sprintf(hex + (i * 2), "%02x", intern->data[i]);
-    }
-    
-    ZSTR_VAL(result)[32] = '\0';
+    php_identifier_format_hex(intern->data, ZSTR_VAL(result));
     RETURN_STR(result);
 }
 
@@ -236,32 +734,22 @@ static PHP_METHOD(Identifier_Bit128, fromHex)
         Z_PARAM_STR(hex)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Validate hex string length */
-    if (ZSTR_LEN(hex) != 32) {
-        zend_throw_exception(zend_ce_exception, "Hex string must be exactly 32 characters long", 0);
-        RETURN_THROWS();
-    }
-
-    /* Validate hex characters */
-    const char *hex_str = ZSTR_VAL(hex);
-    for (int i = 0; i < 32; i++) {
-        if (!isxdigit(hex_str[i])) {
+    unsigned char bytes[16];
+    switch (php_identifier_parse_hex(ZSTR_VAL(hex), ZSTR_LEN(hex), bytes)) {
+        case PHP_IDENTIFIER_PARSE_OK:
+            break;
+        case PHP_IDENTIFIER_PARSE_LENGTH:
+            zend_throw_exception(zend_ce_exception, "Hex string must be exactly 32 characters long", 0);
+            RETURN_THROWS();
+        default:
             zend_throw_exception(zend_ce_exception, "Invalid hex character in string", 0);
             RETURN_THROWS();
-        }
-    }
-
-    /* Parse hex string to bytes */
-    unsigned char bytes[16];
-    for (int i = 0; i < 16; i++) {
-        char hex_byte[3] = {hex_str[i * 2], hex_str[i * 2 + 1], '\0'};
-        bytes[i] = (unsigned char)strtol(hex_byte, NULL, 16);
     }
 
     /* Create new Bit128 object */
     object_init_ex(return_value, php_identifier_bit128_ce);
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(return_value);
-    memcpy(intern->data, bytes, 16);
+    php_identifier_bit128_fill(intern, bytes);
 }
 
 /**
@@ -304,7 +792,7 @@ static PHP_METHOD(Identifier_Bit128, fromBytes)
     /* Create new Bit128 object */
     object_init_ex(return_value, php_identifier_bit128_ce);
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(return_value);
-    memcpy(intern->data, ZSTR_VAL(bytes), 16);
+    php_identifier_bit128_fill(intern, ZSTR_VAL(bytes));
 }
 
 /**
@@ -324,8 +812,9 @@ static PHP_METHOD(Identifier_Bit128, fromBytes)
  */
 static PHP_METHOD(Identifier_Bit128, toString)
 {
-    /* Default implementation: delegate to toHex */
-    PHP_MN(Identifier_Bit128_toHex)(INTERNAL_FUNCTION_PARAM_PASSTHRU);
+    /* Default implementation: the hex representation */
+    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(getThis());
+    RETURN_STR(php_identifier_bit128_format(intern, PHP_IDENTIFIER_FORMAT_HEX));
 }
 
 /**
@@ -345,13 +834,315 @@ static PHP_METHOD(Identifier_Bit128, toString)
  */
 static PHP_METHOD(Identifier_Bit128, __toString)
 {
-    zval retval;
+    /* Formats natively, or calls toString() if a subclass overrides it */
+    zend_string *result = php_identifier_bit128_to_string(Z_OBJ_P(getThis()));
+
+    if (!result) {
+        RETURN_THROWS();
+    }
+
+    RETURN_STR(result);
+}
+
+/**
+ * Serialize the identifier
+ *
+ * Returns the raw 16 bytes instead of the default property table, so
+ * serialize() output stays compact. The class name recorded by serialize()
+ * restores the exact subclass (Version1-7, Ulid, ...).
+ *
+ * @return array The 16-byte payload at index 0
+ *
+ * @example
+ * $payload = serialize(Ulid::generate());
+ * $ulid = unserialize($payload); // Identifier\Ulid
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128, __serialize)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    zend_object *object = Z_OBJ_P(getThis());
+    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ(object);
+    zval bytes;
+
+    array_init_size(return_value, 1);
+    ZVAL_STRINGL(&bytes, (char *)intern->data, 16);
+    zend_hash_next_index_insert_new(Z_ARRVAL_P(return_value), &bytes);
+
+    /* Userland subclasses may carry their own properties */
+    if (php_identifier_bit128_has_properties(object)) {
+        HashTable *props = zend_std_get_properties(object);
+
+        if (zend_hash_num_elements(props) > 0) {
+            zval members;
+            ZVAL_ARR(&members, zend_array_dup(props));
+            zend_hash_next_index_insert_new(Z_ARRVAL_P(return_value), &members);
+        }
+    }
+}
 
-    /* Call the toString() method on this object */
-    zend_call_method_with_0_params(Z_OBJ_P(getThis()), Z_OBJCE_P(getThis()), NULL, "tostring", &retval);
+/**
+ * Restore a serialized identifier
+ *
+ * Copies the 16-byte payload back without going through the string parsers.
+ *
+ * @param array $data Data produced by __serialize()
+ * @throws Exception If the data does not hold a 16-byte payload
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128, __unserialize)
+{
+    HashTable *data;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_ARRAY_HT(data)
+    ZEND_PARSE_PARAMETERS_END();
+
+    zend_object *object = Z_OBJ_P(getThis());
+    zval *bytes = zend_hash_index_find(data, 0);
+    zval *members = zend_hash_index_find(data, 1);
+
+    if (PHP_IDENTIFIER_BIT128_OBJ(object)->initialized) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Cannot modify an already initialized %s", ZSTR_VAL(object->ce->name));
+        RETURN_THROWS();
+    }
+
+    if (!bytes || Z_TYPE_P(bytes) != IS_STRING || Z_STRLEN_P(bytes) != 16
+        || (members && Z_TYPE_P(members) != IS_ARRAY)) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Invalid serialization data for %s", ZSTR_VAL(object->ce->name));
+        RETURN_THROWS();
+    }
+
+    php_identifier_bit128_fill(PHP_IDENTIFIER_BIT128_OBJ(object), Z_STRVAL_P(bytes));
+    php_identifier_bit128_reset_cache(PHP_IDENTIFIER_BIT128_OBJ(object));
+
+    if (members) {
+        zend_string *key;
+        zend_ulong index;
+
+        /* Restore declared properties only: unserialize() must not create
+         * the dynamic properties the write handler forbids */
+        ZEND_HASH_FOREACH_KEY(Z_ARRVAL_P(members), index, key) {
+            const char *class_name;
+            const char *prop_name;
+            size_t prop_len;
+
+            (void)index;
+            if (!key || zend_unmangle_property_name_ex(key, &class_name, &prop_name, &prop_len) != SUCCESS
+                || (!object->ce->__set && !zend_hash_str_exists(&object->ce->properties_info, prop_name, prop_len))) {
+                zend_throw_exception_ex(zend_ce_exception, 0, "Invalid serialization data for %s", ZSTR_VAL(object->ce->name));
+                RETURN_THROWS();
+            }
+        } ZEND_HASH_FOREACH_END();
+
+        object_properties_load(object, Z_ARRVAL_P(members));
+#ifdef GC_NOT_COLLECTABLE
+        if (object->properties) {
+            GC_DEL_FLAGS(object, GC_NOT_COLLECTABLE);
+        }
+#endif
+    }
+}
+
+/**
+ * Recreate an identifier exported with var_export()
+ *
+ * Accepts the 'hex' entry written by var_export(), or a raw 16-byte 'bytes'
+ * entry. The object is created as the class the method is called on.
+ *
+ * @param array $properties Array with a 'hex' or 'bytes' entry
+ * @return static New identifier instance
+ * @throws Exception If neither entry holds a valid payload
+ *
+ * @example
+ * $code = var_export(Ulid::generate(), true);
+ * $ulid = eval("return $code;");
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128, __set_state)
+{
+    HashTable *properties;
 
-    /* Return the result from toString() */
-    RETURN_ZVAL(&retval, 1, 1);
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_ARRAY_HT(properties)
+    ZEND_PARSE_PARAMETERS_END();
+
+    zend_class_entry *ce = zend_get_called_scope(execute_data);
+    unsigned char bytes[16];
+    zval *value;
+
+    if ((value = zend_hash_str_find(properties, "hex", sizeof("hex") - 1))
+        && Z_TYPE_P(value) == IS_STRING && Z_STRLEN_P(value) == 32) {
+        if (php_identifier_parse_hex(Z_STRVAL_P(value), 32, bytes) != PHP_IDENTIFIER_PARSE_OK) {
+            zend_throw_exception(zend_ce_exception, "Invalid hex character in string", 0);
+            RETURN_THROWS();
+        }
+    } else if ((value = zend_hash_str_find(properties, "bytes", sizeof("bytes") - 1))
+        && Z_TYPE_P(value) == IS_STRING && Z_STRLEN_P(value) == 16) {
+        memcpy(bytes, Z_STRVAL_P(value), 16);
+    } else {
+        zend_throw_exception(zend_ce_exception, "State must contain a 32-character 'hex' or 16-byte 'bytes' entry", 0);
+        RETURN_THROWS();
+    }
+
+    if (object_init_ex(return_value, ce) != SUCCESS) {
+        RETURN_THROWS();
+    }
+    php_identifier_bit128_fill(PHP_IDENTIFIER_BIT128_OBJ_P(return_value), bytes);
+}
+
+/**
+ * Sort an array of identifiers in place
+ *
+ * Sorts by the 16-byte binary value using a native radix sort, which is far
+ * faster than usort() with a compare() callback on large arrays. The array is
+ * re-indexed as a list. With $byTime, Version1 UUIDs are ordered by their
+ * reassembled timestamp (their raw byte order is not time order); all other
+ * identifiers are already time-ordered by their bytes.
+ *
+ * @param array $ids Array of Bit128 instances, sorted in place
+ * @param bool $descending Sort from highest to lowest
+ * @param bool $byTime Order Version1 UUIDs by timestamp
+ * @throws Exception If an element is not a Bit128 instance
+ *
+ * @example
+ * $ids = [Version4::generate(), Version4::generate(), Version4::generate()];
+ * Bit128::sortArray($ids);
+ * var_dump($ids[0] <= $ids[1]); // bool(true)
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128, sortArray)
+{
+    zval *ids;
+    bool descending = 0;
+    bool by_time = 0;
+
+    ZEND_PARSE_PARAMETERS_START(1, 3)
+        Z_PARAM_ARRAY_EX(ids, 0, 1)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_BOOL(descending)
+        Z_PARAM_BOOL(by_time)
+    ZEND_PARSE_PARAMETERS_END();
+
+    HashTable *ht = Z_ARRVAL_P(ids);
+    uint32_t count = zend_hash_num_elements(ht);
+
+    if (count == 0) {
+        return;
+    }
+
+    php_identifier_sort_record *records = safe_emalloc(count, sizeof(php_identifier_sort_record), 0);
+    zval **values = safe_emalloc(count, sizeof(zval *), 0);
+    uint32_t i = 0;
+    zval *entry;
+
+    ZEND_HASH_FOREACH_VAL(ht, entry) {
+        zval *value = entry;
+        ZVAL_DEREF(value);
+
+        if (Z_TYPE_P(value) != IS_OBJECT || !instanceof_function(Z_OBJCE_P(value), php_identifier_bit128_ce)) {
+            efree(records);
+            efree(values);
+            zend_throw_exception(zend_ce_exception, "All array elements must be Bit128 instances", 0);
+            RETURN_THROWS();
+        }
+
+        php_identifier_sort_key(Z_OBJ_P(value), by_time, records[i].key);
+        if (descending) {
+            /* Sort the complemented key ascending, so equal keys keep their order */
+            for (int b = 0; b < 16; b++) {
+                records[i].key[b] ^= 0xFF;
+            }
+        }
+        records[i].index = i;
+        values[i] = entry;
+        i++;
+    } ZEND_HASH_FOREACH_END();
+
+    php_identifier_radix_sort(records, count, sizeof(php_identifier_sort_record));
+
+    /* Rebuild as a list; the original zvals (and references) are kept */
+    zval sorted;
+    array_init_size(&sorted, count);
+
+    for (i = 0; i < count; i++) {
+        zval *value = values[records[i].index];
+        Z_TRY_ADDREF_P(value);
+        zend_hash_next_index_insert_new(Z_ARRVAL(sorted), value);
+    }
+
+    efree(records);
+    efree(values);
+
+    zval garbage;
+    ZVAL_COPY_VALUE(&garbage, ids);
+    ZVAL_COPY_VALUE(ids, &sorted);
+    zval_ptr_dtor(&garbage);
+}
+
+/**
+ * Find an identifier in a sorted list
+ *
+ * Performs a binary search over a list sorted in ascending byte order, such
+ * as the output of sortArray() without $byTime.
+ *
+ * @param array $sorted List of Bit128 instances in ascending order
+ * @param Bit128 $needle The identifier to look for
+ * @return int|false Index of a matching element, or false if not found
+ * @throws Exception If the array is not a list or holds non-Bit128 values
+ *
+ * @example
+ * Bit128::sortArray($ids);
+ * $index = Bit128::binarySearch($ids, $needle);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128, binarySearch)
+{
+    HashTable *sorted;
+    zval *needle;
+
+    ZEND_PARSE_PARAMETERS_START(2, 2)
+        Z_PARAM_ARRAY_HT(sorted)
+        Z_PARAM_OBJECT_OF_CLASS(needle, php_identifier_bit128_ce)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (!zend_array_is_list(sorted)) {
+        zend_throw_exception(zend_ce_exception, "Sorted array must be a list", 0);
+        RETURN_THROWS();
+    }
+
+    const unsigned char *key = PHP_IDENTIFIER_BIT128_OBJ_P(needle)->data;
+    zend_ulong low = 0;
+    zend_ulong high = zend_hash_num_elements(sorted);
+
+    while (low < high) {
+        zend_ulong mid = low + (high - low) / 2;
+        zval *value = zend_hash_index_find(sorted, mid);
+
+        ZVAL_DEREF(value);
+        if (Z_TYPE_P(value) != IS_OBJECT || !instanceof_function(Z_OBJCE_P(value), php_identifier_bit128_ce)) {
+            zend_throw_exception(zend_ce_exception, "All array elements must be Bit128 instances", 0);
+            RETURN_THROWS();
+        }
+
+        int result = memcmp(PHP_IDENTIFIER_BIT128_OBJ_P(value)->data, key, 16);
+        if (result == 0) {
+            RETURN_LONG((zend_long)mid);
+        }
+        if (result < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    RETURN_FALSE;
 }
 
 /* Bit128 method entries */
@@ -366,6 +1157,11 @@ static const zend_function_entry php_identifier_bit128_methods[] = {
     PHP_ME(Identifier_Bit128, fromBytes, arginfo_bit128_fromBytes, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Bit128, toString, arginfo_bit128_toString, ZEND_ACC_PUBLIC)
     PHP_ME(Identifier_Bit128, __toString, arginfo_bit128_toString, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128, __serialize, arginfo_bit128_serialize, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128, __unserialize, arginfo_bit128_unserialize, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128, __set_state, arginfo_bit128_set_state, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Bit128, sortArray, arginfo_bit128_sortArray, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Bit128, binarySearch, arginfo_bit128_binarySearch, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_FE_END
 };
 
@@ -375,14 +1171,105 @@ static zend_object *php_identifier_bit128_create_object(zend_class_entry *ce)
     php_identifier_bit128_obj *intern = zend_object_alloc(sizeof(php_identifier_bit128_obj), ce);
 
     zend_object_std_init(&intern->std, ce);
-    object_properties_init(&intern->std, ce);
+
+    /* Identifiers hold no zvals unless a userland subclass declares some */
+    if (ce->default_properties_count) {
+        object_properties_init(&intern->std, ce);
+    }
+#ifdef GC_NOT_COLLECTABLE
+    else if (!ce->__set) {
+        GC_ADD_FLAGS(&intern->std, GC_NOT_COLLECTABLE);
+    }
+#endif
 
     intern->std.handlers = &php_identifier_bit128_object_handlers;
     memset(intern->data, 0, 16);
+    intern->str_cache = NULL;
+    intern->bytes_cache = NULL;
+    intern->str_cache_format = PHP_IDENTIFIER_FORMAT_HEX;
+    intern->initialized = false;
 
     return &intern->std;
 }
 
+/* Free Bit128 object */
+static void php_identifier_bit128_free_object(zend_object *object)
+{
+    php_identifier_bit128_reset_cache(PHP_IDENTIFIER_BIT128_OBJ(object));
+    zend_object_std_dtor(object);
+}
+
+/* Only declared properties (or ones handled by __set) may be written */
+static bool php_identifier_bit128_is_dynamic_property(zend_object *object, zend_string *name)
+{
+    if (object->ce->__set || zend_hash_exists(&object->ce->properties_info, name)) {
+        return false;
+    }
+
+    return !object->properties || !zend_hash_exists(object->properties, name);
+}
+
+static ZEND_COLD void php_identifier_bit128_forbid_dynamic_property(zend_object *object, zend_string *name)
+{
+    zend_throw_error(NULL, "Cannot create dynamic property %s::$%s", ZSTR_VAL(object->ce->name), ZSTR_VAL(name));
+}
+
+static zval *php_identifier_bit128_write_property(zend_object *object, zend_string *name, zval *value, void **cache_slot)
+{
+    if (UNEXPECTED(php_identifier_bit128_is_dynamic_property(object, name))) {
+        php_identifier_bit128_forbid_dynamic_property(object, name);
+        return &EG(error_zval);
+    }
+
+    return zend_std_write_property(object, name, value, cache_slot);
+}
+
+static zval *php_identifier_bit128_get_property_ptr_ptr(zend_object *object, zend_string *name, int type, void **cache_slot)
+{
+    if (UNEXPECTED(php_identifier_bit128_is_dynamic_property(object, name))) {
+        if (type == BP_VAR_R || type == BP_VAR_IS) {
+            return NULL;
+        }
+        php_identifier_bit128_forbid_dynamic_property(object, name);
+        return &EG(error_zval);
+    }
+
+    return zend_std_get_property_ptr_ptr(object, name, type, cache_slot);
+}
+
+/* Report no GC children unless a subclass brought its own properties */
+static HashTable *php_identifier_bit128_get_gc(zend_object *object, zval **table, int *n)
+{
+    if (object->ce->default_properties_count || object->properties) {
+        return zend_std_get_gc(object, table, n);
+    }
+
+    *table = NULL;
+    *n = 0;
+    return NULL;
+}
+
+/* Clone Bit128 object: copy the payload and share the cached strings */
+static zend_object *php_identifier_bit128_clone_object(zend_object *object)
+{
+    php_identifier_bit128_obj *old = PHP_IDENTIFIER_BIT128_OBJ(object);
+    zend_object *new_object = object->ce->create_object(object->ce);
+    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ(new_object);
+
+    memcpy(intern->data, old->data, 16);
+    intern->initialized = old->initialized;
+    if (old->str_cache) {
+        intern->str_cache = zend_string_copy(old->str_cache);
+        intern->str_cache_format = old->str_cache_format;
+    }
+    if (old->bytes_cache) {
+        intern->bytes_cache = zend_string_copy(old->bytes_cache);
+    }
+
+    zend_objects_clone_members(new_object, object);
+    return new_object;
+}
+
 /* Register Bit128 class */
 void php_identifier_bit128_register_class(void)
 {
@@ -395,6 +1282,20 @@ void php_identifier_bit128_register_class(void)
     /* Implement Stringable interface */
     zend_class_implements(php_identifier_bit128_ce, 1, zend_ce_stringable);
 
+    /* Output formats for generateBatch() */
+    zend_declare_class_constant_long(php_identifier_bit128_ce, "BATCH_OBJECTS", sizeof("BATCH_OBJECTS")-1, PHP_IDENTIFIER_BATCH_OBJECTS);
+    zend_declare_class_constant_long(php_identifier_bit128_ce, "BATCH_STRINGS", sizeof("BATCH_STRINGS")-1, PHP_IDENTIFIER_BATCH_STRINGS);
+    zend_declare_class_constant_long(php_identifier_bit128_ce, "BATCH_BINARY", sizeof("BATCH_BINARY")-1, PHP_IDENTIFIER_BATCH_BINARY);
+
     /* Set up object handlers */
     memcpy(&php_identifier_bit128_object_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+    php_identifier_bit128_object_handlers.offset = XtOffsetOf(php_identifier_bit128_obj, std);
+    php_identifier_bit128_object_handlers.free_obj = php_identifier_bit128_free_object;
+    php_identifier_bit128_object_handlers.clone_obj = php_identifier_bit128_clone_object;
+    php_identifier_bit128_object_handlers.compare = php_identifier_bit128_compare_objects;
+    php_identifier_bit128_object_handlers.cast_object = php_identifier_bit128_cast_object;
+    php_identifier_bit128_object_handlers.get_properties_for = php_identifier_bit128_get_properties_for;
+    php_identifier_bit128_object_handlers.write_property = php_identifier_bit128_write_property;
+    php_identifier_bit128_object_handlers.get_property_ptr_ptr = php_identifier_bit128_get_property_ptr_ptr;
+    php_identifier_bit128_object_handlers.get_gc = php_identifier_bit128_get_gc;
 }
@@ -0,0 +1,724 @@
+#include "php.h"
+#include "zend_exceptions.h"
+#include "zend_interfaces.h"
+#include "php_identifier.h"
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* Arginfo declarations */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_bit128_set_construct, 0, 0, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, capacity, IS_LONG, 0, "0")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_set_add, 0, 1, _IS_BOOL, 0)
+    ZEND_ARG_OBJ_INFO(0, id, Identifier\\Bit128, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_set_contains, 0, 1, _IS_BOOL, 0)
+    ZEND_ARG_OBJ_INFO(0, id, Identifier\\Bit128, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_set_remove, 0, 1, _IS_BOOL, 0)
+    ZEND_ARG_OBJ_INFO(0, id, Identifier\\Bit128, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_set_addAll, 0, 1, IS_LONG, 0)
+    ZEND_ARG_OBJ_TYPE_MASK(0, ids, Identifier\\Bit128Vector, MAY_BE_ARRAY, NULL)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_bit128_set_union, 0, 1, Identifier\\Bit128Set, 0)
+    ZEND_ARG_OBJ_INFO(0, other, Identifier\\Bit128Set, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_bit128_set_intersect, 0, 1, Identifier\\Bit128Set, 0)
+    ZEND_ARG_OBJ_INFO(0, other, Identifier\\Bit128Set, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_set_count, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_bit128_set_toVector, 0, 0, Identifier\\Bit128Vector, 0)
+ZEND_END_ARG_INFO()
+
+/* Bit128Set object handlers */
+static zend_object_handlers php_identifier_bit128_set_handlers;
+
+/*
+ * Open-addressing layout in the SwissTable style: a power-of-two array of
+ * 16-byte slots plus one control byte per slot. A control byte is EMPTY,
+ * DELETED or the low 7 bits of the hash (H2) of a full slot. Lookups scan a
+ * whole group of control bytes at once, with SSE2 where available and an
+ * 8-byte SWAR fallback elsewhere. The first GROUP_WIDTH control bytes are
+ * mirrored after the end so that a group load never has to wrap.
+ */
+#define SET_CTRL_EMPTY   ((uint8_t)0x80)
+#define SET_CTRL_DELETED ((uint8_t)0xFE)
+
+#ifdef __SSE2__
+# define SET_GROUP_WIDTH 16
+#else
+# define SET_GROUP_WIDTH 8
+#endif
+
+#define SET_MIN_CAPACITY 16
+
+typedef uint32_t php_identifier_set_mask;
+
+static zend_always_inline int php_identifier_set_ctz(uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(x);
+#else
+    int n = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+#ifdef __SSE2__
+
+static zend_always_inline php_identifier_set_mask php_identifier_set_match(const uint8_t *group, uint8_t h2)
+{
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (php_identifier_set_mask)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)h2), ctrl));
+}
+
+static zend_always_inline php_identifier_set_mask php_identifier_set_match_empty(const uint8_t *group)
+{
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (php_identifier_set_mask)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8((char)SET_CTRL_EMPTY), ctrl));
+}
+
+static zend_always_inline php_identifier_set_mask php_identifier_set_match_free(const uint8_t *group)
+{
+    /* EMPTY and DELETED are the only control values with the top bit set */
+    __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (php_identifier_set_mask)_mm_movemask_epi8(ctrl);
+}
+
+#else
+
+#define SET_LSBS 0x0101010101010101ULL
+#define SET_MSBS 0x8080808080808080ULL
+
+/* Load a group as a little-endian word so byte i maps to bits 8i..8i+7 */
+static zend_always_inline uint64_t php_identifier_set_load_group(const uint8_t *group)
+{
+    uint64_t word = 0;
+    for (int i = SET_GROUP_WIDTH - 1; i >= 0; i--) {
+        word = (word << 8) | group[i];
+    }
+    return word;
+}
+
+/* Collapse a word with one flag bit per byte (bit 7) into one bit per byte */
+static zend_always_inline php_identifier_set_mask php_identifier_set_compress(uint64_t bits)
+{
+    php_identifier_set_mask mask = 0;
+    for (int i = 0; i < SET_GROUP_WIDTH; i++) {
+        if (bits & (0x80ULL << (i * 8))) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+static zend_always_inline php_identifier_set_mask php_identifier_set_match(const uint8_t *group, uint8_t h2)
+{
+    /* Classic zero-byte test; false positives are filtered by the key compare */
+    uint64_t x = php_identifier_set_load_group(group) ^ (SET_LSBS * h2);
+    return php_identifier_set_compress((x - SET_LSBS) & ~x & SET_MSBS);
+}
+
+static zend_always_inline php_identifier_set_mask php_identifier_set_match_empty(const uint8_t *group)
+{
+    /* EMPTY (0x80) is the only value with bit 7 set and bit 1 clear */
+    uint64_t ctrl = php_identifier_set_load_group(group);
+    return php_identifier_set_compress(ctrl & ~(ctrl << 6) & SET_MSBS);
+}
+
+static zend_always_inline php_identifier_set_mask php_identifier_set_match_free(const uint8_t *group)
+{
+    return php_identifier_set_compress(php_identifier_set_load_group(group) & SET_MSBS);
+}
+
+#endif
+
+/* Hash both 64-bit halves so v1/v6 ids (constant node bytes) spread as well
+ * as random ones; a single multiply keeps this far below a string hash. */
+static zend_always_inline uint64_t php_identifier_set_hash(const unsigned char *key)
+{
+    uint64_t hi, lo;
+
+    memcpy(&hi, key, 8);
+    memcpy(&lo, key + 8, 8);
+
+    uint64_t h = (hi ^ (lo * 0x9E3779B97F4A7C15ULL));
+    h ^= h >> 32;
+    return h * 0xD6E8FEB86659FD93ULL;
+}
+
+#define SET_H1(hash) ((size_t)((hash) >> 7))
+#define SET_H2(hash) ((uint8_t)((hash) & 0x7F))
+
+static zend_always_inline size_t php_identifier_set_max_load(size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+static zend_always_inline void php_identifier_set_ctrl(php_identifier_bit128_set_obj *set, size_t index, uint8_t value)
+{
+    set->ctrl[index] = value;
+    if (index < SET_GROUP_WIDTH) {
+        set->ctrl[set->capacity + index] = value;
+    }
+}
+
+/* Locate a key; returns its slot index or -1 */
+static zend_long php_identifier_set_find(const php_identifier_bit128_set_obj *set, const unsigned char *key)
+{
+    if (set->capacity == 0) {
+        return -1;
+    }
+
+    uint64_t hash = php_identifier_set_hash(key);
+    uint8_t h2 = SET_H2(hash);
+    size_t mask = set->capacity - 1;
+    size_t pos = SET_H1(hash) & mask;
+    size_t stride = 0;
+
+    while (1) {
+        const uint8_t *group = set->ctrl + pos;
+        php_identifier_set_mask match = php_identifier_set_match(group, h2);
+
+        while (match) {
+            size_t index = (pos + php_identifier_set_ctz(match)) & mask;
+            if (memcmp(set->slots + index * 16, key, 16) == 0) {
+                return (zend_long)index;
+            }
+            match &= match - 1;
+        }
+
+        if (php_identifier_set_match_empty(group)) {
+            return -1;
+        }
+
+        stride += SET_GROUP_WIDTH;
+        pos = (pos + stride) & mask;
+    }
+}
+
+/* First EMPTY or DELETED slot on the probe sequence of `hash` */
+static size_t php_identifier_set_find_free(const php_identifier_bit128_set_obj *set, uint64_t hash)
+{
+    size_t mask = set->capacity - 1;
+    size_t pos = SET_H1(hash) & mask;
+    size_t stride = 0;
+
+    while (1) {
+        php_identifier_set_mask free_slots = php_identifier_set_match_free(set->ctrl + pos);
+
+        if (free_slots) {
+            return (pos + php_identifier_set_ctz(free_slots)) & mask;
+        }
+
+        stride += SET_GROUP_WIDTH;
+        pos = (pos + stride) & mask;
+    }
+}
+
+/* Rebuild the table at `capacity`, dropping tombstones */
+static void php_identifier_set_rehash(php_identifier_bit128_set_obj *set, size_t capacity)
+{
+    uint8_t *old_ctrl = set->ctrl;
+    unsigned char *old_slots = set->slots;
+    size_t old_capacity = set->capacity;
+
+    /* One allocation: slots first, then the control bytes and their mirror */
+    set->slots = safe_emalloc(capacity, 17, SET_GROUP_WIDTH);
+    set->ctrl = set->slots + capacity * 16;
+    set->capacity = capacity;
+    memset(set->ctrl, SET_CTRL_EMPTY, capacity + SET_GROUP_WIDTH);
+
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old_ctrl[i] & 0x80) {
+            continue;
+        }
+
+        const unsigned char *key = old_slots + i * 16;
+        uint64_t hash = php_identifier_set_hash(key);
+        size_t index = php_identifier_set_find_free(set, hash);
+
+        php_identifier_set_ctrl(set, index, SET_H2(hash));
+        memcpy(set->slots + index * 16, key, 16);
+    }
+
+    set->growth_left = php_identifier_set_max_load(capacity) - set->size;
+
+    if (old_slots) {
+        efree(old_slots);
+    }
+}
+
+/* Smallest table that holds `count` keys under the 7/8 load factor */
+static size_t php_identifier_set_capacity_for(size_t count)
+{
+    size_t capacity = SET_MIN_CAPACITY;
+
+    while (php_identifier_set_max_load(capacity) < count) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+void php_identifier_bit128_set_reserve(php_identifier_bit128_set_obj *set, size_t count)
+{
+    if (set->capacity && php_identifier_set_max_load(set->capacity) >= count) {
+        return;
+    }
+    php_identifier_set_rehash(set, php_identifier_set_capacity_for(count));
+}
+
+/* Insert a key; returns 1 if it was added, 0 if already present */
+int php_identifier_bit128_set_insert(php_identifier_bit128_set_obj *set, const unsigned char *key)
+{
+    if (php_identifier_set_find(set, key) >= 0) {
+        return 0;
+    }
+
+    if (set->growth_left == 0) {
+        /* Mostly tombstones: clean up in place, otherwise grow */
+        size_t capacity = set->capacity ? set->capacity : SET_MIN_CAPACITY;
+        if (set->capacity && set->size * 2 > php_identifier_set_max_load(set->capacity)) {
+            capacity *= 2;
+        }
+        php_identifier_set_rehash(set, capacity);
+    }
+
+    uint64_t hash = php_identifier_set_hash(key);
+    size_t index = php_identifier_set_find_free(set, hash);
+
+    if (set->ctrl[index] == SET_CTRL_EMPTY) {
+        set->growth_left--;
+    }
+    php_identifier_set_ctrl(set, index, SET_H2(hash));
+    memcpy(set->slots + index * 16, key, 16);
+    set->size++;
+
+    return 1;
+}
+
+int php_identifier_bit128_set_contains(const php_identifier_bit128_set_obj *set, const unsigned char *key)
+{
+    return php_identifier_set_find(set, key) >= 0;
+}
+
+/* Add every element of an array or Bit128Vector; returns the number added,
+ * or -1 with an exception set if the array holds a non-Bit128 value */
+static zend_long php_identifier_set_add_all(php_identifier_bit128_set_obj *set, zval *ids)
+{
+    zend_long added = 0;
+
+    if (Z_TYPE_P(ids) == IS_OBJECT) {
+        php_identifier_bit128_vector_obj *vector = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(ids);
+
+        php_identifier_bit128_set_reserve(set, set->size + vector->count);
+        for (size_t i = 0; i < vector->count; i++) {
+            added += php_identifier_bit128_set_insert(set, vector->data + i * 16);
+        }
+        return added;
+    }
+
+    zval *entry;
+    php_identifier_bit128_set_reserve(set, set->size + zend_hash_num_elements(Z_ARRVAL_P(ids)));
+
+    ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(ids), entry) {
+        ZVAL_DEREF(entry);
+        if (Z_TYPE_P(entry) != IS_OBJECT || !instanceof_function(Z_OBJCE_P(entry), php_identifier_bit128_ce)) {
+            zend_throw_exception(zend_ce_exception, "All array elements must be Bit128 instances", 0);
+            return -1;
+        }
+        added += php_identifier_bit128_set_insert(set, PHP_IDENTIFIER_BIT128_OBJ_P(entry)->data);
+    } ZEND_HASH_FOREACH_END();
+
+    return added;
+}
+
+/* Bit128Set methods */
+
+/**
+ * Create an empty identifier set
+ *
+ * A hash set of 128-bit identifiers that stores the raw 16-byte payloads,
+ * so membership tests never allocate strings. Identifiers are compared by
+ * value regardless of class.
+ *
+ * @param int $capacity Number of identifiers to reserve room for
+ * @throws Exception If capacity is negative
+ *
+ * @example
+ * $seen = new Bit128Set(100000);
+ * if ($seen->add($event->id)) {
+ *     process($event);
+ * }
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Set, __construct)
+{
+    zend_long capacity = 0;
+
+    ZEND_PARSE_PARAMETERS_START(0, 1)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_LONG(capacity)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (capacity < 0) {
+        zend_throw_exception(zend_ce_exception, "Capacity must not be negative", 0);
+        RETURN_THROWS();
+    }
+
+    if (capacity > 0) {
+        php_identifier_bit128_set_reserve(PHP_IDENTIFIER_BIT128_SET_OBJ_P(getThis()), (size_t)capacity);
+    }
+}
+
+/**
+ * Add an identifier to the set
+ *
+ * @param Bit128 $id Identifier to add
+ * @return bool True if it was added, false if it was already present
+ *
+ * @example
+ * $set = new Bit128Set();
+ * var_dump($set->add($id)); // bool(true)
+ * var_dump($set->add($id)); // bool(false)
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Set, add)
+{
+    zval *id;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_OBJECT_OF_CLASS(id, php_identifier_bit128_ce)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_set_obj *set = PHP_IDENTIFIER_BIT128_SET_OBJ_P(getThis());
+    RETURN_BOOL(php_identifier_bit128_set_insert(set, PHP_IDENTIFIER_BIT128_OBJ_P(id)->data));
+}
+
+/**
+ * Check whether an identifier is in the set
+ *
+ * @param Bit128 $id Identifier to look for
+ * @return bool True if present
+ *
+ * @example
+ * var_dump($set->contains($id)); // bool(true)
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Set, contains)
+{
+    zval *id;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_OBJECT_OF_CLASS(id, php_identifier_bit128_ce)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_set_obj *set = PHP_IDENTIFIER_BIT128_SET_OBJ_P(getThis());
+    RETURN_BOOL(php_identifier_bit128_set_contains(set, PHP_IDENTIFIER_BIT128_OBJ_P(id)->data));
+}
+
+/**
+ * Remove an identifier from the set
+ *
+ * @param Bit128 $id Identifier to remove
+ * @return bool True if it was present
+ *
+ * @example
+ * $set->remove($id);
+ * var_dump($set->contains($id)); // bool(false)
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Set, remove)
+{
+    zval *id;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_OBJECT_OF_CLASS(id, php_identifier_bit128_ce)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_set_obj *set = PHP_IDENTIFIER_BIT128_SET_OBJ_P(getThis());
+    zend_long index = php_identifier_set_find(set, PHP_IDENTIFIER_BIT128_OBJ_P(id)->data);
+
+    if (index < 0) {
+        RETURN_FALSE;
+    }
+
+    php_identifier_set_ctrl(set, (size_t)index, SET_CTRL_DELETED);
+    set->size--;
+    RETURN_TRUE;
+}
+
+/**
+ * Add many identifiers at once
+ *
+ * Accepts a Bit128Vector (read without creating objects) or an array of
+ * Bit128 instances. The table is sized up front.
+ *
+ * @param Bit128Vector|array $ids Identifiers to add
+ * @return int Number of identifiers that were not already present
+ * @throws Exception If an array element is not a Bit128 instance
+ *
+ * @example
+ * $set = new Bit128Set();
+ * echo $set->addAll(Bit128Vector::fromBinary($blob)); // number of distinct ids
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Set, addAll)
+{
+    zval *ids;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_ZVAL(ids)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (Z_TYPE_P(ids) != IS_ARRAY
+        && (Z_TYPE_P(ids) != IS_OBJECT || Z_OBJCE_P(ids) != php_identifier_bit128_vector_ce)) {
+        zend_argument_type_error(1, "must be of type Identifier\\Bit128Vector|array, %s given", zend_zval_type_name(ids));
+        RETURN_THROWS();
+    }
+
+    zend_long added = php_identifier_set_add_all(PHP_IDENTIFIER_BIT128_SET_OBJ_P(getThis()), ids);
+    if (added < 0) {
+        RETURN_THROWS();
+    }
+
+    RETURN_LONG(added);
+}
+
+/**
+ * Create a set holding the identifiers of both sets
+ *
+ * @param Bit128Set $other The other set
+ * @return Bit128Set New set; neither operand is modified
+ *
+ * @example
+ * $all = $a->union($b);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Set, union)
+{
+    zval *other;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_OBJECT_OF_CLASS(other, php_identifier_bit128_set_ce)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_set_obj *a = PHP_IDENTIFIER_BIT128_SET_OBJ_P(getThis());
+    php_identifier_bit128_set_obj *b = PHP_IDENTIFIER_BIT128_SET_OBJ_P(other);
+
+    object_init_ex(return_value, php_identifier_bit128_set_ce);
+    php_identifier_bit128_set_obj *result = PHP_IDENTIFIER_BIT128_SET_OBJ_P(return_value);
+
+    php_identifier_bit128_set_reserve(result, a->size + b->size);
+    for (size_t i = 0; i < a->capacity; i++) {
+        if (!(a->ctrl[i] & 0x80)) {
+            php_identifier_bit128_set_insert(result, a->slots + i * 16);
+        }
+    }
+    for (size_t i = 0; i < b->capacity; i++) {
+        if (!(b->ctrl[i] & 0x80)) {
+            php_identifier_bit128_set_insert(result, b->slots + i * 16);
+        }
+    }
+}
+
+/**
+ * Create a set holding the identifiers present in both sets
+ *
+ * @param Bit128Set $other The other set
+ * @return Bit128Set New set; neither operand is modified
+ *
+ * @example
+ * $common = $a->intersect($b);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Set, intersect)
+{
+    zval *other;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_OBJECT_OF_CLASS(other, php_identifier_bit128_set_ce)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_set_obj *a = PHP_IDENTIFIER_BIT128_SET_OBJ_P(getThis());
+    php_identifier_bit128_set_obj *b = PHP_IDENTIFIER_BIT128_SET_OBJ_P(other);
+
+    /* Walk the smaller set and probe the larger one */
+    if (b->size < a->size) {
+        php_identifier_bit128_set_obj *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    object_init_ex(return_value, php_identifier_bit128_set_ce);
+    php_identifier_bit128_set_obj *result = PHP_IDENTIFIER_BIT128_SET_OBJ_P(return_value);
+
+    for (size_t i = 0; i < a->capacity; i++) {
+        if (!(a->ctrl[i] & 0x80) && php_identifier_bit128_set_contains(b, a->slots + i * 16)) {
+            php_identifier_bit128_set_insert(result, a->slots + i * 16);
+        }
+    }
+}
+
+/**
+ * Get the number of identifiers in the set
+ *
+ * @return int Number of identifiers
+ *
+ * @example
+ * echo count($set);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Set, count)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_LONG((zend_long)PHP_IDENTIFIER_BIT128_SET_OBJ_P(getThis())->size);
+}
+
+/**
+ * Copy the identifiers into a Bit128Vector
+ *
+ * The order is unspecified; call sort() on the result for byte order.
+ *
+ * @return Bit128Vector Vector holding every identifier in the set
+ *
+ * @example
+ * $vector = $set->toVector();
+ * $vector->sort();
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Set, toVector)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_bit128_set_obj *set = PHP_IDENTIFIER_BIT128_SET_OBJ_P(getThis());
+
+    object_init_ex(return_value, php_identifier_bit128_vector_ce);
+    php_identifier_bit128_vector_obj *vector = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(return_value);
+
+    for (size_t i = 0; i < set->capacity; i++) {
+        if (!(set->ctrl[i] & 0x80)) {
+            php_identifier_bit128_vector_push(vector, set->slots + i * 16);
+        }
+    }
+}
+
+/* Bit128Set method entries */
+static const zend_function_entry php_identifier_bit128_set_methods[] = {
+    PHP_ME(Identifier_Bit128Set, __construct, arginfo_bit128_set_construct, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Set, add, arginfo_bit128_set_add, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Set, contains, arginfo_bit128_set_contains, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Set, remove, arginfo_bit128_set_remove, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Set, addAll, arginfo_bit128_set_addAll, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Set, union, arginfo_bit128_set_union, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Set, intersect, arginfo_bit128_set_intersect, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Set, count, arginfo_bit128_set_count, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Set, toVector, arginfo_bit128_set_toVector, ZEND_ACC_PUBLIC)
+    PHP_FE_END
+};
+
+/* Bit128Set object creation */
+static zend_object *php_identifier_bit128_set_create_object(zend_class_entry *ce)
+{
+    php_identifier_bit128_set_obj *intern = zend_object_alloc(sizeof(php_identifier_bit128_set_obj), ce);
+
+    zend_object_std_init(&intern->std, ce);
+    object_properties_init(&intern->std, ce);
+
+    intern->ctrl = NULL;
+    intern->slots = NULL;
+    intern->capacity = 0;
+    intern->size = 0;
+    intern->growth_left = 0;
+
+    intern->std.handlers = &php_identifier_bit128_set_handlers;
+    return &intern->std;
+}
+
+/* Free set object */
+static void php_identifier_bit128_set_free_object(zend_object *object)
+{
+    php_identifier_bit128_set_obj *intern = PHP_IDENTIFIER_BIT128_SET_OBJ(object);
+
+    /* ctrl shares the slots allocation */
+    if (intern->slots) {
+        efree(intern->slots);
+    }
+
+    zend_object_std_dtor(&intern->std);
+}
+
+/* Clone set object */
+static zend_object *php_identifier_bit128_set_clone_object(zend_object *object)
+{
+    php_identifier_bit128_set_obj *old = PHP_IDENTIFIER_BIT128_SET_OBJ(object);
+    zend_object *new_object = php_identifier_bit128_set_create_object(object->ce);
+    php_identifier_bit128_set_obj *intern = PHP_IDENTIFIER_BIT128_SET_OBJ(new_object);
+
+    if (old->capacity) {
+        size_t bytes = old->capacity * 17 + SET_GROUP_WIDTH;
+
+        intern->slots = emalloc(bytes);
+        memcpy(intern->slots, old->slots, bytes);
+        intern->ctrl = intern->slots + old->capacity * 16;
+        intern->capacity = old->capacity;
+        intern->size = old->size;
+        intern->growth_left = old->growth_left;
+    }
+
+    zend_objects_clone_members(new_object, object);
+    return new_object;
+}
+
+/* count() without a method call */
+static zend_result php_identifier_bit128_set_count_elements(zend_object *object, zend_long *count)
+{
+    *count = (zend_long)PHP_IDENTIFIER_BIT128_SET_OBJ(object)->size;
+    return SUCCESS;
+}
+
+/* Register Bit128Set class */
+void php_identifier_bit128_set_register_class(void)
+{
+    zend_class_entry ce;
+
+    INIT_NS_CLASS_ENTRY(ce, "Identifier", "Bit128Set", php_identifier_bit128_set_methods);
+    php_identifier_bit128_set_ce = zend_register_internal_class(&ce);
+    php_identifier_bit128_set_ce->ce_flags |= ZEND_ACC_FINAL | ZEND_ACC_NOT_SERIALIZABLE;
+    php_identifier_bit128_set_ce->create_object = php_identifier_bit128_set_create_object;
+
+    zend_class_implements(php_identifier_bit128_set_ce, 1, zend_ce_countable);
+
+    memcpy(&php_identifier_bit128_set_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+    php_identifier_bit128_set_handlers.offset = XtOffsetOf(php_identifier_bit128_set_obj, std);
+    php_identifier_bit128_set_handlers.free_obj = php_identifier_bit128_set_free_object;
+    php_identifier_bit128_set_handlers.clone_obj = php_identifier_bit128_set_clone_object;
+    php_identifier_bit128_set_handlers.count_elements = php_identifier_bit128_set_count_elements;
+}
@@ -0,0 +1,672 @@
+#include "php.h"
+#include "zend_exceptions.h"
+#include "zend_interfaces.h"
+#include "php_identifier.h"
+#include <string.h>
+
+/* Arginfo declarations */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_bit128_vector_construct, 0, 0, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, elementClass, IS_STRING, 0, "Identifier\\Bit128::class")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_vector_append, 0, 1, IS_VOID, 0)
+    ZEND_ARG_OBJ_INFO(0, id, Identifier\\Bit128, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_vector_count, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_vector_offsetExists, 0, 1, _IS_BOOL, 0)
+    ZEND_ARG_TYPE_INFO(0, offset, IS_MIXED, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_bit128_vector_offsetGet, 0, 1, Identifier\\Bit128, 0)
+    ZEND_ARG_TYPE_INFO(0, offset, IS_MIXED, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_vector_offsetSet, 0, 2, IS_VOID, 0)
+    ZEND_ARG_TYPE_INFO(0, offset, IS_MIXED, 0)
+    ZEND_ARG_TYPE_INFO(0, value, IS_MIXED, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_vector_offsetUnset, 0, 1, IS_VOID, 0)
+    ZEND_ARG_TYPE_INFO(0, offset, IS_MIXED, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_bit128_vector_getIterator, 0, 0, Iterator, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_vector_toBinary, 0, 0, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_bit128_vector_fromBinary, 0, 1, Identifier\\Bit128Vector, 0)
+    ZEND_ARG_TYPE_INFO(0, binary, IS_STRING, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, elementClass, IS_STRING, 0, "Identifier\\Bit128::class")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_bit128_vector_sort, 0, 0, IS_VOID, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, descending, _IS_BOOL, 0, "false")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_bit128_vector_binarySearch, 0, 1, MAY_BE_LONG|MAY_BE_FALSE)
+    ZEND_ARG_OBJ_INFO(0, needle, Identifier\\Bit128, 0)
+ZEND_END_ARG_INFO()
+
+/* Bit128Vector object handlers */
+static zend_object_handlers php_identifier_bit128_vector_handlers;
+
+/* Iterator over a vector; the current element is materialized on demand */
+typedef struct _php_identifier_bit128_vector_iterator {
+    zend_object_iterator it;
+    size_t position;
+    zval current;
+} php_identifier_bit128_vector_iterator;
+
+/* Grow the buffer so that at least `needed` records fit */
+static void php_identifier_bit128_vector_reserve(php_identifier_bit128_vector_obj *intern, size_t needed)
+{
+    if (needed <= intern->capacity) {
+        return;
+    }
+
+    size_t capacity = intern->capacity ? intern->capacity : 8;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+
+    intern->data = safe_erealloc(intern->data, capacity, 16, 0);
+    intern->capacity = capacity;
+}
+
+/* Resolve and validate the class used to materialize elements */
+static zend_class_entry *php_identifier_bit128_vector_element_class(zend_string *name)
+{
+    zend_class_entry *ce = zend_lookup_class(name);
+
+    if (!ce || !instanceof_function(ce, php_identifier_bit128_ce)) {
+        zend_throw_exception(zend_ce_exception, "Element class must extend Identifier\\Bit128", 0);
+        return NULL;
+    }
+
+    if (ce->ce_flags & (ZEND_ACC_INTERFACE | ZEND_ACC_TRAIT | ZEND_ACC_EXPLICIT_ABSTRACT_CLASS)) {
+        zend_throw_exception(zend_ce_exception, "Element class must be instantiable", 0);
+        return NULL;
+    }
+
+    return ce;
+}
+
+/* Validate an offset argument, returning -1 (with an exception) if unusable */
+static zend_long php_identifier_bit128_vector_offset(php_identifier_bit128_vector_obj *intern, zval *offset)
+{
+    ZVAL_DEREF(offset);
+
+    if (Z_TYPE_P(offset) != IS_LONG) {
+        zend_throw_exception(zend_ce_exception, "Bit128Vector offset must be an integer", 0);
+        return -1;
+    }
+
+    if (Z_LVAL_P(offset) < 0 || (zend_ulong)Z_LVAL_P(offset) >= intern->count) {
+        zend_throw_exception(zend_ce_exception, "Bit128Vector offset out of range", 0);
+        return -1;
+    }
+
+    return Z_LVAL_P(offset);
+}
+
+/* Create the object for element `index` */
+void php_identifier_bit128_vector_materialize(php_identifier_bit128_vector_obj *intern, size_t index, zval *out)
+{
+    const unsigned char *record = intern->data + index * 16;
+    zend_class_entry *ce = intern->element_ce;
+
+    /* A vector of generic Uuids yields the matching version subclass */
+    if (ce == php_identifier_uuid_ce) {
+        ce = php_identifier_uuid_class_for_version((record[6] >> 4) & 0x0F);
+    }
+
+    object_init_ex(out, ce);
+    php_identifier_bit128_fill(PHP_IDENTIFIER_BIT128_OBJ_P(out), record);
+}
+
+/* Append the payload of a Bit128 instance */
+void php_identifier_bit128_vector_push(php_identifier_bit128_vector_obj *intern, const unsigned char *bytes)
+{
+    php_identifier_bit128_vector_reserve(intern, intern->count + 1);
+    memcpy(intern->data + intern->count * 16, bytes, 16);
+    intern->count++;
+}
+
+/* Iterator handlers */
+static void php_identifier_bit128_vector_it_dtor(zend_object_iterator *iter)
+{
+    php_identifier_bit128_vector_iterator *it = (php_identifier_bit128_vector_iterator *)iter;
+
+    zval_ptr_dtor(&it->current);
+    zval_ptr_dtor(&iter->data);
+}
+
+static zend_result php_identifier_bit128_vector_it_valid(zend_object_iterator *iter)
+{
+    php_identifier_bit128_vector_iterator *it = (php_identifier_bit128_vector_iterator *)iter;
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(&iter->data);
+
+    return it->position < intern->count ? SUCCESS : FAILURE;
+}
+
+static zval *php_identifier_bit128_vector_it_get_current_data(zend_object_iterator *iter)
+{
+    php_identifier_bit128_vector_iterator *it = (php_identifier_bit128_vector_iterator *)iter;
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(&iter->data);
+
+    zval_ptr_dtor(&it->current);
+    php_identifier_bit128_vector_materialize(intern, it->position, &it->current);
+
+    return &it->current;
+}
+
+static void php_identifier_bit128_vector_it_get_current_key(zend_object_iterator *iter, zval *key)
+{
+    php_identifier_bit128_vector_iterator *it = (php_identifier_bit128_vector_iterator *)iter;
+
+    ZVAL_LONG(key, (zend_long)it->position);
+}
+
+static void php_identifier_bit128_vector_it_move_forward(zend_object_iterator *iter)
+{
+    php_identifier_bit128_vector_iterator *it = (php_identifier_bit128_vector_iterator *)iter;
+
+    it->position++;
+}
+
+static void php_identifier_bit128_vector_it_rewind(zend_object_iterator *iter)
+{
+    php_identifier_bit128_vector_iterator *it = (php_identifier_bit128_vector_iterator *)iter;
+
+    it->position = 0;
+}
+
+static const zend_object_iterator_funcs php_identifier_bit128_vector_it_funcs = {
+    .dtor = php_identifier_bit128_vector_it_dtor,
+    .valid = php_identifier_bit128_vector_it_valid,
+    .get_current_data = php_identifier_bit128_vector_it_get_current_data,
+    .get_current_key = php_identifier_bit128_vector_it_get_current_key,
+    .move_forward = php_identifier_bit128_vector_it_move_forward,
+    .rewind = php_identifier_bit128_vector_it_rewind,
+};
+
+static zend_object_iterator *php_identifier_bit128_vector_get_iterator(zend_class_entry *ce, zval *object, int by_ref)
+{
+    if (by_ref) {
+        zend_throw_error(NULL, "An iterator cannot be used with foreach by reference");
+        return NULL;
+    }
+
+    php_identifier_bit128_vector_iterator *it = emalloc(sizeof(php_identifier_bit128_vector_iterator));
+
+    zend_iterator_init(&it->it);
+    ZVAL_OBJ_COPY(&it->it.data, Z_OBJ_P(object));
+    it->it.funcs = &php_identifier_bit128_vector_it_funcs;
+    it->position = 0;
+    ZVAL_UNDEF(&it->current);
+
+    return &it->it;
+}
+
+/* Bit128Vector methods */
+
+/**
+ * Create an empty identifier vector
+ *
+ * Stores identifiers contiguously as raw 16-byte records, which takes a
+ * fraction of the memory of an array of objects. Objects are only created
+ * when an element is read. A vector of Identifier\Uuid yields the matching
+ * version subclass for each element.
+ *
+ * @param string $elementClass Class used when reading elements (Bit128 subclass)
+ * @throws Exception If the class does not extend Bit128
+ *
+ * @example
+ * $ids = new Bit128Vector(Ulid::class);
+ * $ids->append(Ulid::generate());
+ * echo count($ids); // 1
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, __construct)
+{
+    zend_string *element_class = NULL;
+
+    ZEND_PARSE_PARAMETERS_START(0, 1)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_STR(element_class)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(getThis());
+
+    if (element_class) {
+        zend_class_entry *ce = php_identifier_bit128_vector_element_class(element_class);
+        if (!ce) {
+            RETURN_THROWS();
+        }
+        intern->element_ce = ce;
+    }
+}
+
+/**
+ * Append an identifier
+ *
+ * Copies the 16-byte payload of the identifier to the end of the vector.
+ *
+ * @param Bit128 $id Identifier to append
+ *
+ * @example
+ * $ids = new Bit128Vector(Uuid::class);
+ * $ids->append(Version7::generate());
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, append)
+{
+    zval *id;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_OBJECT_OF_CLASS(id, php_identifier_bit128_ce)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(getThis());
+    php_identifier_bit128_vector_push(intern, PHP_IDENTIFIER_BIT128_OBJ_P(id)->data);
+}
+
+/**
+ * Get the number of identifiers in the vector
+ *
+ * @return int Number of elements
+ *
+ * @example
+ * echo count($ids); // same as $ids->count()
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, count)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(getThis());
+    RETURN_LONG((zend_long)intern->count);
+}
+
+/**
+ * Check whether an offset exists
+ *
+ * @param mixed $offset Integer offset
+ * @return bool True if 0 <= offset < count
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, offsetExists)
+{
+    zval *offset;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_ZVAL(offset)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(getThis());
+
+    ZVAL_DEREF(offset);
+    RETURN_BOOL(Z_TYPE_P(offset) == IS_LONG
+        && Z_LVAL_P(offset) >= 0
+        && (zend_ulong)Z_LVAL_P(offset) < intern->count);
+}
+
+/**
+ * Get the identifier at an offset
+ *
+ * Creates a new object of the element class for the stored record.
+ *
+ * @param mixed $offset Integer offset
+ * @return Bit128 The identifier at that position
+ * @throws Exception If the offset is not an integer or out of range
+ *
+ * @example
+ * $first = $ids[0];
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, offsetGet)
+{
+    zval *offset;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_ZVAL(offset)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(getThis());
+    zend_long index = php_identifier_bit128_vector_offset(intern, offset);
+
+    if (index < 0) {
+        RETURN_THROWS();
+    }
+
+    php_identifier_bit128_vector_materialize(intern, (size_t)index, return_value);
+}
+
+/**
+ * Replace or append an identifier
+ *
+ * $ids[] = $id appends; $ids[$i] = $id replaces an existing element.
+ *
+ * @param mixed $offset Integer offset, or null to append
+ * @param mixed $value Bit128 instance
+ * @throws Exception If the value is not a Bit128 or the offset is invalid
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, offsetSet)
+{
+    zval *offset;
+    zval *value;
+
+    ZEND_PARSE_PARAMETERS_START(2, 2)
+        Z_PARAM_ZVAL(offset)
+        Z_PARAM_ZVAL(value)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(getThis());
+
+    ZVAL_DEREF(value);
+    if (Z_TYPE_P(value) != IS_OBJECT || !instanceof_function(Z_OBJCE_P(value), php_identifier_bit128_ce)) {
+        zend_throw_exception(zend_ce_exception, "Bit128Vector values must be Bit128 instances", 0);
+        RETURN_THROWS();
+    }
+
+    const unsigned char *bytes = PHP_IDENTIFIER_BIT128_OBJ_P(value)->data;
+
+    ZVAL_DEREF(offset);
+    if (Z_TYPE_P(offset) == IS_NULL) {
+        php_identifier_bit128_vector_push(intern, bytes);
+        return;
+    }
+
+    zend_long index = php_identifier_bit128_vector_offset(intern, offset);
+    if (index < 0) {
+        RETURN_THROWS();
+    }
+
+    memcpy(intern->data + index * 16, bytes, 16);
+}
+
+/**
+ * Unsetting elements is not supported
+ *
+ * @param mixed $offset Ignored
+ * @throws Exception Always
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, offsetUnset)
+{
+    zval *offset;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_ZVAL(offset)
+    ZEND_PARSE_PARAMETERS_END();
+
+    (void)offset;
+    zend_throw_exception(zend_ce_exception, "Bit128Vector does not support unset", 0);
+    RETURN_THROWS();
+}
+
+/**
+ * Get an iterator over the identifiers
+ *
+ * foreach over the vector yields offset => identifier pairs; each
+ * identifier object is created as the loop reaches it.
+ *
+ * @return Iterator Iterator over the elements
+ *
+ * @example
+ * foreach ($ids as $i => $id) {
+ *     echo $i, ': ', $id, "\n";
+ * }
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, getIterator)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    zend_create_internal_iterator_zval(return_value, getThis());
+}
+
+/**
+ * Export all identifiers as one binary string
+ *
+ * Returns the records back to back, 16 bytes per identifier, in vector order.
+ *
+ * @return string Binary string of count() * 16 bytes
+ *
+ * @example
+ * file_put_contents('ids.bin', $ids->toBinary());
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, toBinary)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(getThis());
+
+    if (intern->count == 0) {
+        RETURN_EMPTY_STRING();
+    }
+
+    RETURN_STRINGL((char *)intern->data, intern->count * 16);
+}
+
+/**
+ * Load a vector from a binary string
+ *
+ * Copies the blob as-is without parsing individual identifiers. The blob
+ * length must be a multiple of 16 bytes.
+ *
+ * @param string $binary Concatenated 16-byte records
+ * @param string $elementClass Class used when reading elements (Bit128 subclass)
+ * @return Bit128Vector New vector holding the records
+ * @throws Exception If the length is not a multiple of 16 or the class is invalid
+ *
+ * @example
+ * $ids = Bit128Vector::fromBinary(file_get_contents('ids.bin'), Ulid::class);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, fromBinary)
+{
+    zend_string *binary;
+    zend_string *element_class = NULL;
+
+    ZEND_PARSE_PARAMETERS_START(1, 2)
+        Z_PARAM_STR(binary)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_STR(element_class)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (ZSTR_LEN(binary) % 16 != 0) {
+        zend_throw_exception(zend_ce_exception, "Binary length must be a multiple of 16 bytes", 0);
+        RETURN_THROWS();
+    }
+
+    zend_class_entry *ce = php_identifier_bit128_ce;
+    if (element_class) {
+        ce = php_identifier_bit128_vector_element_class(element_class);
+        if (!ce) {
+            RETURN_THROWS();
+        }
+    }
+
+    object_init_ex(return_value, php_identifier_bit128_vector_ce);
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(return_value);
+    size_t count = ZSTR_LEN(binary) / 16;
+
+    intern->element_ce = ce;
+    php_identifier_bit128_vector_reserve(intern, count);
+    if (count) {
+        memcpy(intern->data, ZSTR_VAL(binary), count * 16);
+    }
+    intern->count = count;
+}
+
+/**
+ * Sort the vector in place
+ *
+ * Orders the records by their binary value with a radix sort, without
+ * creating any objects.
+ *
+ * @param bool $descending Sort from highest to lowest
+ *
+ * @example
+ * $ids->sort();
+ * $index = $ids->binarySearch($needle);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, sort)
+{
+    bool descending = 0;
+
+    ZEND_PARSE_PARAMETERS_START(0, 1)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_BOOL(descending)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(getThis());
+
+    php_identifier_radix_sort(intern->data, intern->count, 16);
+    if (descending) {
+        php_identifier_reverse_records(intern->data, intern->count, 16);
+    }
+}
+
+/**
+ * Find an identifier in a sorted vector
+ *
+ * The vector must be in ascending order, e.g. after sort().
+ *
+ * @param Bit128 $needle The identifier to look for
+ * @return int|false Offset of a matching element, or false if not found
+ *
+ * @example
+ * $ids->sort();
+ * var_dump($ids->binarySearch($ids[3])); // int(3)
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Bit128Vector, binarySearch)
+{
+    zval *needle;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_OBJECT_OF_CLASS(needle, php_identifier_bit128_ce)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(getThis());
+    zend_long index = php_identifier_bsearch(intern->data, intern->count, PHP_IDENTIFIER_BIT128_OBJ_P(needle)->data);
+
+    if (index < 0) {
+        RETURN_FALSE;
+    }
+
+    RETURN_LONG(index);
+}
+
+/* Bit128Vector method entries */
+static const zend_function_entry php_identifier_bit128_vector_methods[] = {
+    PHP_ME(Identifier_Bit128Vector, __construct, arginfo_bit128_vector_construct, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Vector, append, arginfo_bit128_vector_append, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Vector, count, arginfo_bit128_vector_count, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Vector, offsetExists, arginfo_bit128_vector_offsetExists, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Vector, offsetGet, arginfo_bit128_vector_offsetGet, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Vector, offsetSet, arginfo_bit128_vector_offsetSet, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Vector, offsetUnset, arginfo_bit128_vector_offsetUnset, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Vector, getIterator, arginfo_bit128_vector_getIterator, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Vector, toBinary, arginfo_bit128_vector_toBinary, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Vector, fromBinary, arginfo_bit128_vector_fromBinary, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Bit128Vector, sort, arginfo_bit128_vector_sort, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Bit128Vector, binarySearch, arginfo_bit128_vector_binarySearch, ZEND_ACC_PUBLIC)
+    PHP_FE_END
+};
+
+/* Bit128Vector object creation */
+static zend_object *php_identifier_bit128_vector_create_object(zend_class_entry *ce)
+{
+    php_identifier_bit128_vector_obj *intern = zend_object_alloc(sizeof(php_identifier_bit128_vector_obj), ce);
+
+    zend_object_std_init(&intern->std, ce);
+    object_properties_init(&intern->std, ce);
+
+    intern->data = NULL;
+    intern->count = 0;
+    intern->capacity = 0;
+    intern->element_ce = php_identifier_bit128_ce;
+
+    intern->std.handlers = &php_identifier_bit128_vector_handlers;
+    return &intern->std;
+}
+
+/* Free vector object */
+static void php_identifier_bit128_vector_free_object(zend_object *object)
+{
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ(object);
+
+    if (intern->data) {
+        efree(intern->data);
+    }
+
+    zend_object_std_dtor(&intern->std);
+}
+
+/* Clone vector object */
+static zend_object *php_identifier_bit128_vector_clone_object(zend_object *object)
+{
+    php_identifier_bit128_vector_obj *old = PHP_IDENTIFIER_BIT128_VECTOR_OBJ(object);
+    zend_object *new_object = php_identifier_bit128_vector_create_object(object->ce);
+    php_identifier_bit128_vector_obj *intern = PHP_IDENTIFIER_BIT128_VECTOR_OBJ(new_object);
+
+    intern->element_ce = old->element_ce;
+    if (old->count) {
+        php_identifier_bit128_vector_reserve(intern, old->count);
+        memcpy(intern->data, old->data, old->count * 16);
+        intern->count = old->count;
+    }
+
+    zend_objects_clone_members(new_object, object);
+    return new_object;
+}
+
+/* count() without a method call */
+static zend_result php_identifier_bit128_vector_count_elements(zend_object *object, zend_long *count)
+{
+    *count = (zend_long)PHP_IDENTIFIER_BIT128_VECTOR_OBJ(object)->count;
+    return SUCCESS;
+}
+
+/* Register Bit128Vector class */
+void php_identifier_bit128_vector_register_class(void)
+{
+    zend_class_entry ce;
+
+    INIT_NS_CLASS_ENTRY(ce, "Identifier", "Bit128Vector", php_identifier_bit128_vector_methods);
+    php_identifier_bit128_vector_ce = zend_register_internal_class(&ce);
+    php_identifier_bit128_vector_ce->ce_flags |= ZEND_ACC_FINAL | ZEND_ACC_NOT_SERIALIZABLE;
+    php_identifier_bit128_vector_ce->create_object = php_identifier_bit128_vector_create_object;
+    php_identifier_bit128_vector_ce->get_iterator = php_identifier_bit128_vector_get_iterator;
+
+    zend_class_implements(php_identifier_bit128_vector_ce, 3, zend_ce_aggregate, zend_ce_arrayaccess, zend_ce_countable);
+
+    memcpy(&php_identifier_bit128_vector_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+    php_identifier_bit128_vector_handlers.offset = XtOffsetOf(php_identifier_bit128_vector_obj, std);
+    php_identifier_bit128_vector_handlers.free_obj = php_identifier_bit128_vector_free_object;
+    php_identifier_bit128_vector_handlers.clone_obj = php_identifier_bit128_vector_clone_object;
+    php_identifier_bit128_vector_handlers.count_elements = php_identifier_bit128_vector_count_elements;
+}
@@ -83,7 +83,12 @@ static PHP_METHOD(Identifier_Context_System, getInstance)
  */
 static PHP_METHOD(Identifier_Context_System, getTimestampMs)
 {
-    RETURN_LONG(php_identifier_get_timestamp_ms());
+    uint64_t timestamp_ms;
+
+    if (php_identifier_get_timestamp_ms(&timestamp_ms) == FAILURE) {
+        RETURN_THROWS();
+    }
+    RETURN_LONG((zend_long)timestamp_ms);
 }
 
 /**
@@ -104,7 +109,12 @@ static PHP_METHOD(Identifier_Context_System, getTimestampMs)
  */
 static PHP_METHOD(Identifier_Context_System, getGregorianEpochTime)
 {
-    RETURN_LONG(php_identifier_get_gregorian_epoch_time());
+    uint64_t timestamp_100ns;
+
+    if (php_identifier_get_gregorian_epoch_time(&timestamp_100ns) == FAILURE) {
+        RETURN_THROWS();
+    }
+    RETURN_LONG((zend_long)timestamp_100ns);
 }
 
 /**
@@ -0,0 +1,618 @@
+#include "php.h"
+#include "zend_exceptions.h"
+#include "php_identifier.h"
+#include <string.h>
+
+/* Frameless calls are available from PHP 8.4 onwards */
+#if PHP_VERSION_ID >= 80400
+#include "zend_frameless_function.h"
+#endif
+
+/* Pure functions may be evaluated by opcache when all arguments are literals (PHP 8.2+) */
+#ifdef ZEND_ACC_COMPILE_TIME_EVAL
+# define PHP_IDENTIFIER_ACC_PURE ZEND_ACC_COMPILE_TIME_EVAL
+#else
+# define PHP_IDENTIFIER_ACC_PURE 0
+#endif
+
+/* Arginfo declarations */
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_identifier_generate_string, 0, 0, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_identifier_uuid_is_valid, 0, 1, _IS_BOOL, 0)
+    ZEND_ARG_TYPE_INFO(0, uuid, IS_STRING, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, version, IS_LONG, 1, "null")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_identifier_ulid_is_valid, 0, 1, _IS_BOOL, 0)
+    ZEND_ARG_TYPE_INFO(0, ulid, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_identifier_uuid_to_bytes, 0, 1, IS_STRING, 0)
+    ZEND_ARG_TYPE_INFO(0, uuid, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_identifier_ulid_to_bytes, 0, 1, IS_STRING, 0)
+    ZEND_ARG_TYPE_INFO(0, ulid, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_identifier_from_bytes, 0, 1, IS_STRING, 0)
+    ZEND_ARG_TYPE_INFO(0, bytes, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_identifier_stats, 0, 0, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
+/* Copy 16 bytes into a new binary string */
+static zend_always_inline zend_string *php_identifier_bytes_string(const unsigned char *bytes)
+{
+    zend_string *result = zend_string_alloc(16, 0);
+
+    memcpy(ZSTR_VAL(result), bytes, 16);
+    ZSTR_VAL(result)[16] = '\0';
+
+    return result;
+}
+
+/* Format 16 bytes straight into a new string of the given length */
+static zend_always_inline zend_string *php_identifier_formatted_string(const unsigned char *bytes, size_t length,
+    void (*format)(const unsigned char *, char *))
+{
+    zend_string *result = zend_string_alloc(length, 0);
+
+    /* The formatters write a trailing NUL, which fits in the allocation */
+    format(bytes, ZSTR_VAL(result));
+
+    return result;
+}
+
+/* Shared bodies: each is called from the regular handler and, on PHP 8.4+,
+ * from the frameless one, so both paths behave identically. */
+
+static zend_always_inline void php_identifier_uuid4_impl(zval *return_value, bool binary)
+{
+    unsigned char bytes[16];
+    php_identifier_uuid_v4_fill(bytes);
+
+    RETURN_NEW_STR(binary
+        ? php_identifier_bytes_string(bytes)
+        : php_identifier_formatted_string(bytes, 36, php_identifier_format_uuid));
+}
+
+static zend_always_inline void php_identifier_uuid7_impl(zval *return_value, bool binary)
+{
+    unsigned char bytes[16];
+    uint64_t timestamp_ms;
+
+    if (php_identifier_get_timestamp_ms(&timestamp_ms) == FAILURE) {
+        RETURN_THROWS();
+    }
+    php_identifier_uuid_v7_fill(bytes, timestamp_ms);
+
+    RETURN_NEW_STR(binary
+        ? php_identifier_bytes_string(bytes)
+        : php_identifier_formatted_string(bytes, 36, php_identifier_format_uuid));
+}
+
+static zend_always_inline void php_identifier_ulid_impl(zval *return_value, bool binary)
+{
+    unsigned char bytes[16];
+    uint64_t timestamp_ms;
+
+    if (php_identifier_get_timestamp_ms(&timestamp_ms) == FAILURE
+            || php_identifier_ulid_generate(timestamp_ms, NULL, bytes) == FAILURE) {
+        RETURN_THROWS();
+    }
+
+    RETURN_NEW_STR(binary
+        ? php_identifier_bytes_string(bytes)
+        : php_identifier_formatted_string(bytes, 26, php_identifier_format_ulid));
+}
+
+static zend_always_inline void php_identifier_uuid_is_valid_impl(zval *return_value, const zend_string *uuid, bool any_version, zend_long version)
+{
+    unsigned char bytes[16];
+    if (php_identifier_parse_uuid(ZSTR_VAL(uuid), ZSTR_LEN(uuid), bytes) != PHP_IDENTIFIER_PARSE_OK) {
+        RETURN_FALSE;
+    }
+
+    RETURN_BOOL(any_version || ((bytes[6] >> 4) & 0x0F) == version);
+}
+
+static zend_always_inline void php_identifier_ulid_is_valid_impl(zval *return_value, const zend_string *ulid)
+{
+    unsigned char bytes[16];
+    RETURN_BOOL(php_identifier_parse_ulid(ZSTR_VAL(ulid), ZSTR_LEN(ulid), bytes) == PHP_IDENTIFIER_PARSE_OK);
+}
+
+static zend_always_inline void php_identifier_uuid_to_bytes_impl(zval *return_value, const zend_string *uuid)
+{
+    unsigned char bytes[16];
+    if (!php_identifier_uuid_parse_string(uuid, bytes)) {
+        RETURN_THROWS();
+    }
+
+    RETURN_NEW_STR(php_identifier_bytes_string(bytes));
+}
+
+static zend_always_inline void php_identifier_ulid_to_bytes_impl(zval *return_value, const zend_string *ulid)
+{
+    unsigned char bytes[16];
+    if (!php_identifier_ulid_parse_string(ulid, bytes)) {
+        RETURN_THROWS();
+    }
+
+    RETURN_NEW_STR(php_identifier_bytes_string(bytes));
+}
+
+static zend_always_inline void php_identifier_from_bytes_impl(zval *return_value, const zend_string *bytes, const char *kind,
+    size_t length, void (*format)(const unsigned char *, char *))
+{
+    if (ZSTR_LEN(bytes) != 16) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "%s bytes must be exactly 16 bytes", kind);
+        RETURN_THROWS();
+    }
+
+    RETURN_NEW_STR(php_identifier_formatted_string((const unsigned char *)ZSTR_VAL(bytes), length, format));
+}
+
+/**
+ * Generate a random UUID version 4 string
+ *
+ * Same as Version4::generate()->toString() without creating an object.
+ * Always uses the system CSPRNG.
+ *
+ * @return string UUID in "xxxxxxxx-xxxx-4xxx-xxxx-xxxxxxxxxxxx" form
+ *
+ * @example
+ * echo Identifier\uuid4(); // e.g., "f47ac10b-58cc-4372-a567-0e02b2c3d479"
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_uuid4)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_uuid4_impl(return_value, false);
+}
+
+/**
+ * Generate a random UUID version 4 as 16 raw bytes
+ *
+ * Same as Version4::generate()->getBytes() without creating an object.
+ *
+ * @return string 16-byte binary UUID
+ *
+ * @example
+ * $stmt->execute([Identifier\uuid4_bytes()]);
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_uuid4_bytes)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_uuid4_impl(return_value, true);
+}
+
+/**
+ * Generate a UUID version 7 string
+ *
+ * Same as Version7::generate()->toString() without creating an object.
+ * Uses the system clock and CSPRNG.
+ *
+ * @return string UUID in "xxxxxxxx-xxxx-7xxx-xxxx-xxxxxxxxxxxx" form
+ *
+ * @example
+ * echo Identifier\uuid7(); // e.g., "018c2e65-4b0a-7c3d-8f2e-1a4b5c6d7e8f"
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_uuid7)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_uuid7_impl(return_value, false);
+}
+
+/**
+ * Generate a UUID version 7 as 16 raw bytes
+ *
+ * Same as Version7::generate()->getBytes() without creating an object.
+ *
+ * @return string 16-byte binary UUID
+ *
+ * @example
+ * $stmt->execute([Identifier\uuid7_bytes()]);
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_uuid7_bytes)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_uuid7_impl(return_value, true);
+}
+
+/**
+ * Generate a ULID string
+ *
+ * Same as Ulid::generate()->toString() without creating an object, and
+ * monotonic with it: both share the same per-thread state.
+ *
+ * @return string 26-character Crockford Base32 ULID
+ * @throws OutOfBoundsException If the randomness overflows within one millisecond
+ *
+ * @example
+ * echo Identifier\ulid(); // e.g., "01ARZ3NDEKTSV4RRFFQ69G5FAV"
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_ulid)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_ulid_impl(return_value, false);
+}
+
+/**
+ * Generate a ULID as 16 raw bytes
+ *
+ * Same as Ulid::generate()->getBytes() without creating an object.
+ *
+ * @return string 16-byte binary ULID
+ * @throws OutOfBoundsException If the randomness overflows within one millisecond
+ *
+ * @example
+ * $stmt->execute([Identifier\ulid_bytes()]);
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_ulid_bytes)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_ulid_impl(return_value, true);
+}
+
+/**
+ * Check whether a string is a valid UUID
+ *
+ * Same as Uuid::isValid(). Pure: with a literal argument opcache can fold
+ * the call at compile time.
+ *
+ * @param string $uuid String to validate
+ * @param int|null $version Required UUID version, or null for any
+ * @return bool True if the string is a valid UUID
+ *
+ * @example
+ * var_dump(Identifier\uuid_is_valid($input, 7));
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_uuid_is_valid)
+{
+    zend_string *uuid;
+    zend_long version = 0;
+    bool version_is_null = true;
+
+    ZEND_PARSE_PARAMETERS_START(1, 2)
+        Z_PARAM_STR(uuid)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_LONG_OR_NULL(version, version_is_null)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_uuid_is_valid_impl(return_value, uuid, version_is_null, version);
+}
+
+/**
+ * Check whether a string is a valid ULID
+ *
+ * Same as Ulid::isValid(). Pure: with a literal argument opcache can fold
+ * the call at compile time.
+ *
+ * @param string $ulid String to validate
+ * @return bool True if the string is a valid ULID
+ *
+ * @example
+ * var_dump(Identifier\ulid_is_valid($input));
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_ulid_is_valid)
+{
+    zend_string *ulid;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(ulid)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_ulid_is_valid_impl(return_value, ulid);
+}
+
+/**
+ * Convert a UUID string to its 16 raw bytes
+ *
+ * Same as Uuid::fromString($uuid)->getBytes() without creating an object.
+ * Pure: a literal UUID is converted once, at compile time.
+ *
+ * @param string $uuid UUID string in format "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx"
+ * @return string 16-byte binary UUID
+ * @throws Exception If the string is not a valid UUID
+ *
+ * @example
+ * $stmt->execute([Identifier\uuid_to_bytes('550e8400-e29b-41d4-a716-446655440000')]);
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_uuid_to_bytes)
+{
+    zend_string *uuid;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(uuid)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_uuid_to_bytes_impl(return_value, uuid);
+}
+
+/**
+ * Convert 16 raw bytes to a UUID string
+ *
+ * Same as Uuid::fromBytes($bytes)->toString() without creating an object.
+ *
+ * @param string $bytes Exactly 16 bytes of binary data
+ * @return string UUID in "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" form
+ * @throws Exception If bytes is not exactly 16 bytes
+ *
+ * @example
+ * echo Identifier\uuid_from_bytes($row['id']);
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_uuid_from_bytes)
+{
+    zend_string *bytes;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(bytes)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_from_bytes_impl(return_value, bytes, "UUID", 36, php_identifier_format_uuid);
+}
+
+/**
+ * Convert a ULID string to its 16 raw bytes
+ *
+ * Same as Ulid::fromString($ulid)->getBytes() without creating an object.
+ * Pure: a literal ULID is converted once, at compile time.
+ *
+ * @param string $ulid ULID string in Crockford Base32 format (26 characters)
+ * @return string 16-byte binary ULID
+ * @throws Exception If the string is not a valid ULID
+ *
+ * @example
+ * $stmt->execute([Identifier\ulid_to_bytes($input)]);
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_ulid_to_bytes)
+{
+    zend_string *ulid;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(ulid)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_ulid_to_bytes_impl(return_value, ulid);
+}
+
+/**
+ * Convert 16 raw bytes to a ULID string
+ *
+ * Same as Ulid::fromBytes($bytes)->toString() without creating an object.
+ *
+ * @param string $bytes Exactly 16 bytes of binary data
+ * @return string 26-character Crockford Base32 ULID
+ * @throws Exception If bytes is not exactly 16 bytes
+ *
+ * @example
+ * echo Identifier\ulid_from_bytes($row['id']);
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_ulid_from_bytes)
+{
+    zend_string *bytes;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(bytes)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_from_bytes_impl(return_value, bytes, "ULID", 26, php_identifier_format_ulid);
+}
+
+/**
+ * Get generator counters for the calling thread
+ *
+ * Reports which monotonic scope is active (identifier.monotonic_scope) and,
+ * for the shared scopes, how many reservations this thread made and how
+ * many of its compare-and-swap or lock attempts lost to another writer.
+ * ulid_overflow counts how often each identifier.ulid_overflow policy
+ * fired. clock_regression counts how often the system clock stepped
+ * backwards and the largest step, whatever identifier.clock_regression did
+ * about it. The counters live for the lifetime of the worker, across requests.
+ *
+ * @return array{monotonic: array{scope: string, reservations: int, retries: int}, ulid_overflow: array{policy: string, throws: int, advances: int, waits: int}, clock_regression: array{policy: string, events: int, max_jump_ms: int}}
+ *
+ * @example
+ * $stats = Identifier\stats();
+ * printf("%.2f retries per ULID\n", $stats['monotonic']['retries'] / max(1, $stats['monotonic']['reservations']));
+ *
+ * @since 0.3.0
+ */
+PHP_FUNCTION(identifier_stats)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    array_init(return_value);
+    php_identifier_monotonic_stats(return_value);
+    php_identifier_ulid_overflow_stats(return_value);
+    php_identifier_clock_regression_stats(return_value);
+}
+
+#if PHP_VERSION_ID >= 80400
+/* Frameless variants: called straight from the VM/JIT without a call frame */
+
+ZEND_FRAMELESS_FUNCTION(identifier_uuid4, 0)
+{
+    php_identifier_uuid4_impl(return_value, false);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_uuid4_bytes, 0)
+{
+    php_identifier_uuid4_impl(return_value, true);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_uuid7, 0)
+{
+    php_identifier_uuid7_impl(return_value, false);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_uuid7_bytes, 0)
+{
+    php_identifier_uuid7_impl(return_value, true);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_ulid, 0)
+{
+    php_identifier_ulid_impl(return_value, false);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_ulid_bytes, 0)
+{
+    php_identifier_ulid_impl(return_value, true);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_uuid_is_valid, 1)
+{
+    zval uuid_tmp;
+    zend_string *uuid;
+
+    Z_FLF_PARAM_STR(1, uuid, uuid_tmp);
+
+    php_identifier_uuid_is_valid_impl(return_value, uuid, true, 0);
+
+flf_clean:
+    Z_FLF_PARAM_FREE_STR(1, uuid_tmp);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_ulid_is_valid, 1)
+{
+    zval ulid_tmp;
+    zend_string *ulid;
+
+    Z_FLF_PARAM_STR(1, ulid, ulid_tmp);
+
+    php_identifier_ulid_is_valid_impl(return_value, ulid);
+
+flf_clean:
+    Z_FLF_PARAM_FREE_STR(1, ulid_tmp);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_uuid_to_bytes, 1)
+{
+    zval uuid_tmp;
+    zend_string *uuid;
+
+    Z_FLF_PARAM_STR(1, uuid, uuid_tmp);
+
+    php_identifier_uuid_to_bytes_impl(return_value, uuid);
+
+flf_clean:
+    Z_FLF_PARAM_FREE_STR(1, uuid_tmp);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_uuid_from_bytes, 1)
+{
+    zval bytes_tmp;
+    zend_string *bytes;
+
+    Z_FLF_PARAM_STR(1, bytes, bytes_tmp);
+
+    php_identifier_from_bytes_impl(return_value, bytes, "UUID", 36, php_identifier_format_uuid);
+
+flf_clean:
+    Z_FLF_PARAM_FREE_STR(1, bytes_tmp);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_ulid_to_bytes, 1)
+{
+    zval ulid_tmp;
+    zend_string *ulid;
+
+    Z_FLF_PARAM_STR(1, ulid, ulid_tmp);
+
+    php_identifier_ulid_to_bytes_impl(return_value, ulid);
+
+flf_clean:
+    Z_FLF_PARAM_FREE_STR(1, ulid_tmp);
+}
+
+ZEND_FRAMELESS_FUNCTION(identifier_ulid_from_bytes, 1)
+{
+    zval bytes_tmp;
+    zend_string *bytes;
+
+    Z_FLF_PARAM_STR(1, bytes, bytes_tmp);
+
+    php_identifier_from_bytes_impl(return_value, bytes, "ULID", 26, php_identifier_format_ulid);
+
+flf_clean:
+    Z_FLF_PARAM_FREE_STR(1, bytes_tmp);
+}
+
+# define PHP_IDENTIFIER_FRAMELESS_INFOS(name, arity) \
+    static const zend_frameless_function_info frameless_function_infos_identifier_##name[] = { \
+        { ZEND_FRAMELESS_FUNCTION_NAME(identifier_##name, arity), arity }, \
+        { 0 }, \
+    };
+
+PHP_IDENTIFIER_FRAMELESS_INFOS(uuid4, 0)
+PHP_IDENTIFIER_FRAMELESS_INFOS(uuid4_bytes, 0)
+PHP_IDENTIFIER_FRAMELESS_INFOS(uuid7, 0)
+PHP_IDENTIFIER_FRAMELESS_INFOS(uuid7_bytes, 0)
+PHP_IDENTIFIER_FRAMELESS_INFOS(ulid, 0)
+PHP_IDENTIFIER_FRAMELESS_INFOS(ulid_bytes, 0)
+PHP_IDENTIFIER_FRAMELESS_INFOS(uuid_is_valid, 1)
+PHP_IDENTIFIER_FRAMELESS_INFOS(ulid_is_valid, 1)
+PHP_IDENTIFIER_FRAMELESS_INFOS(uuid_to_bytes, 1)
+PHP_IDENTIFIER_FRAMELESS_INFOS(uuid_from_bytes, 1)
+PHP_IDENTIFIER_FRAMELESS_INFOS(ulid_to_bytes, 1)
+PHP_IDENTIFIER_FRAMELESS_INFOS(ulid_from_bytes, 1)
+
+# define PHP_IDENTIFIER_FE(name, arg_info, flags) \
+    ZEND_RAW_FENTRY(ZEND_NS_NAME("Identifier", #name), ZEND_FN(identifier_##name), arg_info, flags, \
+        frameless_function_infos_identifier_##name, NULL)
+#else
+# define PHP_IDENTIFIER_FE(name, arg_info, flags) \
+    ZEND_RAW_FENTRY(ZEND_NS_NAME("Identifier", #name), ZEND_FN(identifier_##name), arg_info, flags)
+#endif
+
+/* Function entries, registered through identifier_module_entry */
+const zend_function_entry php_identifier_functions[] = {
+    PHP_IDENTIFIER_FE(uuid4, arginfo_identifier_generate_string, 0)
+    PHP_IDENTIFIER_FE(uuid4_bytes, arginfo_identifier_generate_string, 0)
+    PHP_IDENTIFIER_FE(uuid7, arginfo_identifier_generate_string, 0)
+    PHP_IDENTIFIER_FE(uuid7_bytes, arginfo_identifier_generate_string, 0)
+    PHP_IDENTIFIER_FE(ulid, arginfo_identifier_generate_string, 0)
+    PHP_IDENTIFIER_FE(ulid_bytes, arginfo_identifier_generate_string, 0)
+    PHP_IDENTIFIER_FE(uuid_is_valid, arginfo_identifier_uuid_is_valid, PHP_IDENTIFIER_ACC_PURE)
+    PHP_IDENTIFIER_FE(ulid_is_valid, arginfo_identifier_ulid_is_valid, PHP_IDENTIFIER_ACC_PURE)
+    PHP_IDENTIFIER_FE(uuid_to_bytes, arginfo_identifier_uuid_to_bytes, PHP_IDENTIFIER_ACC_PURE)
+    PHP_IDENTIFIER_FE(uuid_from_bytes, arginfo_identifier_from_bytes, PHP_IDENTIFIER_ACC_PURE)
+    PHP_IDENTIFIER_FE(ulid_to_bytes, arginfo_identifier_ulid_to_bytes, PHP_IDENTIFIER_ACC_PURE)
+    PHP_IDENTIFIER_FE(ulid_from_bytes, arginfo_identifier_from_bytes, PHP_IDENTIFIER_ACC_PURE)
+    ZEND_NS_NAMED_FE("Identifier", stats, ZEND_FN(identifier_stats), arginfo_identifier_stats)
+    PHP_FE_END
+};
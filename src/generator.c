@@ -0,0 +1,563 @@
+#include "php.h"
+#include "zend_exceptions.h"
+#include "zend_interfaces.h"
+#include "php_identifier.h"
+#include <string.h>
+
+/* Arginfo declarations */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_generator_construct, 0, 0, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, class, IS_STRING, 0, "Identifier\\Ulid::class")
+    ZEND_ARG_OBJ_INFO_WITH_DEFAULT_VALUE(0, context, Identifier\\Context, 1, "null")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, monotonic, _IS_BOOL, 0, "true")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, bufferSize, IS_LONG, 0, "64")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_generator_next, 0, 0, Identifier\\Bit128, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_generator_nextString, 0, 0, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_generator_nextBytes, 0, 0, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_generator_getClass, 0, 0, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+/* Generator object handlers */
+static zend_object_handlers php_identifier_generator_handlers;
+
+/* Default entropy buffer, in identifiers (16 bytes each) */
+#define PHP_IDENTIFIER_GENERATOR_BUFFER_DEFAULT 64
+#define PHP_IDENTIFIER_GENERATOR_BUFFER_MAX 4096
+
+/* UUID epoch is 122192928000000000 100ns units before Unix epoch */
+#define PHP_IDENTIFIER_GREGORIAN_OFFSET 122192928000000000ULL
+
+/* Random bytes from the bound context, or from the generator's buffer of
+ * CSPRNG output, refilled in one call when it runs dry */
+static zend_result php_identifier_generator_random(php_identifier_generator_obj *gen, unsigned char *out, size_t length)
+{
+    if (Z_TYPE(gen->context) == IS_OBJECT) {
+        zval result;
+        zval param;
+
+        ZVAL_LONG(&param, (zend_long)length);
+        zend_call_method(Z_OBJ(gen->context), Z_OBJCE(gen->context), &gen->random_fn,
+            "getrandombytes", sizeof("getrandombytes") - 1, &result, 1, &param, NULL);
+
+        if (EG(exception)) {
+            zval_ptr_dtor(&result);
+            return FAILURE;
+        }
+        if (Z_TYPE(result) != IS_STRING || Z_STRLEN(result) != length) {
+            zval_ptr_dtor(&result);
+            zend_throw_exception_ex(zend_ce_exception, 0, "Context getRandomBytes did not return %zu bytes", length);
+            return FAILURE;
+        }
+
+        memcpy(out, Z_STRVAL(result), length);
+        zval_ptr_dtor(&result);
+        return SUCCESS;
+    }
+
+    if (gen->entropy_pos + length > gen->entropy_size) {
+        if (!gen->entropy) {
+            gen->entropy_size = PHP_IDENTIFIER_GENERATOR_BUFFER_DEFAULT * 16;
+            gen->entropy = emalloc(gen->entropy_size);
+        }
+        php_identifier_generate_random_bytes(gen->entropy, gen->entropy_size);
+        gen->entropy_pos = 0;
+    }
+
+    memcpy(out, gen->entropy + gen->entropy_pos, length);
+    /* Handed-out bytes do not linger in the buffer */
+    ZEND_SECURE_ZERO(gen->entropy + gen->entropy_pos, length);
+    gen->entropy_pos += length;
+
+    return SUCCESS;
+}
+
+/* Current time in milliseconds from the bound context or the system clock */
+static zend_result php_identifier_generator_time(php_identifier_generator_obj *gen, uint64_t *timestamp_ms)
+{
+    if (Z_TYPE(gen->context) != IS_OBJECT) {
+        return php_identifier_get_timestamp_ms(timestamp_ms);
+    }
+
+    zval result;
+    zend_call_method(Z_OBJ(gen->context), Z_OBJCE(gen->context), &gen->time_fn,
+        "gettimestampms", sizeof("gettimestampms") - 1, &result, 0, NULL, NULL);
+
+    if (EG(exception)) {
+        zval_ptr_dtor(&result);
+        return FAILURE;
+    }
+    if (Z_TYPE(result) != IS_LONG) {
+        zval_ptr_dtor(&result);
+        zend_throw_exception(zend_ce_exception, "Context getTimestampMs did not return a number", 0);
+        return FAILURE;
+    }
+
+    *timestamp_ms = (uint64_t)Z_LVAL(result);
+    return SUCCESS;
+}
+
+/* Write the 48-bit millisecond timestamp shared by UUIDv7 and ULID */
+static zend_always_inline void php_identifier_generator_put_ms(unsigned char *bytes, uint64_t timestamp_ms)
+{
+    bytes[0] = (timestamp_ms >> 40) & 0xFF;
+    bytes[1] = (timestamp_ms >> 32) & 0xFF;
+    bytes[2] = (timestamp_ms >> 24) & 0xFF;
+    bytes[3] = (timestamp_ms >> 16) & 0xFF;
+    bytes[4] = (timestamp_ms >> 8) & 0xFF;
+    bytes[5] = timestamp_ms & 0xFF;
+}
+
+/* Step the 74-bit rand_a/rand_b field of a UUIDv7 tail (bytes 6-15) forward
+ * by step. Returns false if the field would overflow or carry into the
+ * worker ID. */
+static bool php_identifier_generator_v7_step(unsigned char *tail, uint32_t step)
+{
+    uint64_t rand_a = ((uint64_t)(tail[0] & 0x0F) << 8) | tail[1];
+    uint64_t rand_b = (uint64_t)(tail[2] & 0x3F) << 56;
+
+    for (int i = 3; i < 10; i++) {
+        rand_b |= (uint64_t)tail[i] << ((9 - i) * 8);
+    }
+
+    rand_b += (uint64_t)step + 1;
+    if (rand_b >> 62) {
+        rand_b &= (UINT64_C(1) << 62) - 1;
+        if (++rand_a > php_identifier_worker_v7_max()) {
+            return false;
+        }
+    }
+
+    tail[0] = 0x70 | ((rand_a >> 8) & 0x0F);
+    tail[1] = rand_a & 0xFF;
+    tail[2] = 0x80 | ((rand_b >> 56) & 0x3F);
+    for (int i = 3; i < 10; i++) {
+        tail[i] = (rand_b >> ((9 - i) * 8)) & 0xFF;
+    }
+
+    return true;
+}
+
+/* Produce the next identifier of the generator's type into bytes */
+static zend_result php_identifier_generator_fill(php_identifier_generator_obj *gen, unsigned char *bytes)
+{
+    php_identifier_ulid_state *state = &gen->state;
+    uint64_t timestamp_ms;
+    uint64_t clock_ms;
+
+    switch (gen->type) {
+        case PHP_IDENTIFIER_GENERATOR_UUID4:
+            if (php_identifier_generator_random(gen, bytes, 16) == FAILURE) {
+                return FAILURE;
+            }
+            bytes[6] = (bytes[6] & 0x0F) | 0x40;
+            bytes[8] = (bytes[8] & 0x3F) | 0x80;
+            return SUCCESS;
+
+        case PHP_IDENTIFIER_GENERATOR_UUID7:
+            if (php_identifier_generator_time(gen, &timestamp_ms) == FAILURE) {
+                return FAILURE;
+            }
+
+            clock_ms = timestamp_ms;
+            if (gen->monotonic && php_identifier_ulid_state_continues(state, timestamp_ms)) {
+                /* Same millisecond, or behind a borrowed one: step forward from the last UUID */
+                unsigned char step[4];
+                if (php_identifier_generator_random(gen, step, sizeof(step)) == FAILURE) {
+                    return FAILURE;
+                }
+
+                timestamp_ms = state->last_timestamp;
+                memcpy(bytes + 6, state->last_randomness, 10);
+                if (!php_identifier_generator_v7_step(bytes + 6,
+                        ((uint32_t)step[0] << 24) | ((uint32_t)step[1] << 16) | ((uint32_t)step[2] << 8) | step[3])) {
+                    /* Counter exhausted: identifier.ulid_overflow decides */
+                    if (php_identifier_ulid_overflow(&timestamp_ms) == FAILURE) {
+                        return FAILURE;
+                    }
+                    if (php_identifier_generator_random(gen, bytes + 6, 10) == FAILURE) {
+                        return FAILURE;
+                    }
+                }
+            } else if (php_identifier_generator_random(gen, bytes + 6, 10) == FAILURE) {
+                return FAILURE;
+            }
+
+            php_identifier_generator_put_ms(bytes, timestamp_ms);
+            bytes[6] = (bytes[6] & 0x0F) | 0x70;
+            bytes[8] = (bytes[8] & 0x3F) | 0x80;
+            php_identifier_worker_stamp_v7(bytes);
+
+            state->last_timestamp = timestamp_ms;
+            state->last_clock = clock_ms;
+            memcpy(state->last_randomness, bytes + 6, 10);
+            state->initialized = true;
+            return SUCCESS;
+
+        case PHP_IDENTIFIER_GENERATOR_ULID:
+            if (php_identifier_generator_time(gen, &timestamp_ms) == FAILURE) {
+                return FAILURE;
+            }
+
+            clock_ms = timestamp_ms;
+            if (gen->monotonic && php_identifier_ulid_state_continues(state, timestamp_ms)) {
+                /* Same millisecond, or behind an advanced one: increment the last randomness */
+                timestamp_ms = state->last_timestamp;
+                memcpy(bytes + 6, state->last_randomness, 10);
+                if (!php_identifier_ulid_increment(bytes + 6)) {
+                    if (php_identifier_ulid_overflow(&timestamp_ms) == FAILURE
+                            || php_identifier_generator_random(gen, bytes + 6, 10) == FAILURE) {
+                        return FAILURE;
+                    }
+                }
+            } else if (php_identifier_generator_random(gen, bytes + 6, 10) == FAILURE) {
+                return FAILURE;
+            }
+
+            php_identifier_generator_put_ms(bytes, timestamp_ms);
+            php_identifier_worker_stamp_ulid(bytes + 6);
+
+            state->last_timestamp = timestamp_ms;
+            state->last_clock = clock_ms;
+            memcpy(state->last_randomness, bytes + 6, 10);
+            state->initialized = true;
+            return SUCCESS;
+
+        case PHP_IDENTIFIER_GENERATOR_UUID1:
+        case PHP_IDENTIFIER_GENERATOR_UUID6: {
+            uint64_t timestamp_100ns;
+            uint16_t clock_seq = gen->clock_seq;
+            unsigned char node[6];
+
+            if (php_identifier_generator_time(gen, &timestamp_ms) == FAILURE) {
+                return FAILURE;
+            }
+            timestamp_100ns = (timestamp_ms * 10000) + PHP_IDENTIFIER_GREGORIAN_OFFSET;
+
+            if (gen->monotonic) {
+                /* One node and clock sequence per generator; ticks keep it unique */
+                if (timestamp_100ns <= gen->last_100ns) {
+                    timestamp_100ns = gen->last_100ns + 1;
+                }
+                gen->last_100ns = timestamp_100ns;
+                memcpy(node, gen->node, 6);
+            } else {
+                unsigned char random_data[8];
+                if (php_identifier_generator_random(gen, random_data, sizeof(random_data)) == FAILURE) {
+                    return FAILURE;
+                }
+                clock_seq = ((random_data[0] << 8) | random_data[1]) & 0x3FFF;
+                memcpy(node, random_data + 2, 6);
+                node[0] |= 0x01;
+            }
+
+            if (gen->type == PHP_IDENTIFIER_GENERATOR_UUID1) {
+                php_identifier_uuid_v1_layout(bytes, timestamp_100ns, clock_seq, node);
+            } else {
+                php_identifier_uuid_v6_layout(bytes, timestamp_100ns, clock_seq, node);
+            }
+            return SUCCESS;
+        }
+    }
+
+    return FAILURE;
+}
+
+/* Generator methods */
+
+/**
+ * Create an identifier generator
+ *
+ * Binds the identifier class, context and ordering mode once, so that each
+ * call to next() skips argument parsing and context checks. Every generator
+ * owns its own monotonic state and entropy buffer: several independent,
+ * individually ordered streams can run side by side in one process.
+ *
+ * @param string $class Identifier class: Version1, Version4, Version6, Version7 or Ulid
+ * @param Context|null $context Optional context for time and randomness
+ * @param bool $monotonic Keep identifiers strictly ascending within this generator
+ * @param int $bufferSize Identifiers' worth of CSPRNG output fetched per refill (1-4096)
+ * @throws Exception If the class is not supported or bufferSize is out of range
+ *
+ * @example
+ * $orders = new Generator(Ulid::class);
+ * $events = new Generator(Version7::class, bufferSize: 1024);
+ * $id = $orders->next();
+ * $key = $events->nextBytes();
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Generator, __construct)
+{
+    zend_string *class_name = NULL;
+    zval *context = NULL;
+    bool monotonic = 1;
+    zend_long buffer_size = PHP_IDENTIFIER_GENERATOR_BUFFER_DEFAULT;
+
+    ZEND_PARSE_PARAMETERS_START(0, 4)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_STR(class_name)
+        Z_PARAM_OBJECT_OF_CLASS_OR_NULL(context, php_identifier_context_ce)
+        Z_PARAM_BOOL(monotonic)
+        Z_PARAM_LONG(buffer_size)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_generator_obj *gen = PHP_IDENTIFIER_GENERATOR_OBJ_P(getThis());
+
+    if (class_name) {
+        zend_class_entry *ce = zend_lookup_class(class_name);
+
+        if (ce == php_identifier_uuid_version1_ce) {
+            gen->type = PHP_IDENTIFIER_GENERATOR_UUID1;
+        } else if (ce == php_identifier_uuid_version4_ce) {
+            gen->type = PHP_IDENTIFIER_GENERATOR_UUID4;
+        } else if (ce == php_identifier_uuid_version6_ce) {
+            gen->type = PHP_IDENTIFIER_GENERATOR_UUID6;
+        } else if (ce == php_identifier_uuid_version7_ce) {
+            gen->type = PHP_IDENTIFIER_GENERATOR_UUID7;
+        } else if (ce == php_identifier_ulid_ce) {
+            gen->type = PHP_IDENTIFIER_GENERATOR_ULID;
+        } else {
+            zend_throw_exception(zend_ce_exception, "Generator class must be Version1, Version4, Version6, Version7 or Ulid", 0);
+            RETURN_THROWS();
+        }
+        gen->element_ce = ce;
+    }
+
+    if (buffer_size < 1 || buffer_size > PHP_IDENTIFIER_GENERATOR_BUFFER_MAX) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Generator buffer size must be between 1 and %d", PHP_IDENTIFIER_GENERATOR_BUFFER_MAX);
+        RETURN_THROWS();
+    }
+
+    gen->monotonic = monotonic;
+
+    /* Context\System is the default behaviour: use the native fast path */
+    zval_ptr_dtor(&gen->context);
+    ZVAL_UNDEF(&gen->context);
+    gen->time_fn = NULL;
+    gen->random_fn = NULL;
+    if (context && Z_OBJCE_P(context) != php_identifier_context_system_ce) {
+        ZVAL_COPY(&gen->context, context);
+    }
+
+    if (gen->entropy) {
+        ZEND_SECURE_ZERO(gen->entropy, gen->entropy_size);
+        efree(gen->entropy);
+    }
+    gen->entropy_size = (size_t)buffer_size * 16;
+    gen->entropy = emalloc(gen->entropy_size);
+    gen->entropy_pos = gen->entropy_size; /* filled on first use */
+
+    memset(&gen->state, 0, sizeof(gen->state));
+    gen->last_100ns = 0;
+
+    if (gen->type == PHP_IDENTIFIER_GENERATOR_UUID1 || gen->type == PHP_IDENTIFIER_GENERATOR_UUID6) {
+        unsigned char random_data[8];
+        if (php_identifier_generator_random(gen, random_data, sizeof(random_data)) == FAILURE) {
+            RETURN_THROWS();
+        }
+        gen->clock_seq = ((random_data[0] << 8) | random_data[1]) & 0x3FFF;
+        /* identifier.state_file carries the clock sequence across restarts */
+        if (Z_TYPE(gen->context) != IS_OBJECT) {
+            php_identifier_state_clock_seq(&gen->clock_seq);
+        }
+        memcpy(gen->node, random_data + 2, 6);
+        /* Set multicast bit for random node (RFC 4122 requirement) */
+        gen->node[0] |= 0x01;
+    }
+}
+
+/**
+ * Generate the next identifier as an object
+ *
+ * @return Bit128 Instance of the class the generator was built with
+ * @throws OutOfBoundsException If a monotonic ULID or UUIDv7 stream overflows and identifier.ulid_overflow is "throw"
+ *
+ * @example
+ * $generator = new Generator(Version7::class);
+ * $uuid = $generator->next();
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Generator, next)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_generator_obj *gen = PHP_IDENTIFIER_GENERATOR_OBJ_P(getThis());
+    unsigned char bytes[16];
+
+    if (php_identifier_generator_fill(gen, bytes) == FAILURE) {
+        RETURN_THROWS();
+    }
+
+    object_init_ex(return_value, gen->element_ce);
+    php_identifier_bit128_fill(PHP_IDENTIFIER_BIT128_OBJ_P(return_value), bytes);
+}
+
+/**
+ * Generate the next identifier as its canonical string
+ *
+ * Returns the 26-character Crockford Base32 form for ULIDs and the
+ * 36-character hyphenated form for UUIDs, without creating an object.
+ *
+ * @return string Canonical string form
+ * @throws OutOfBoundsException If a monotonic ULID or UUIDv7 stream overflows and identifier.ulid_overflow is "throw"
+ *
+ * @example
+ * $generator = new Generator(Ulid::class);
+ * echo $generator->nextString(); // e.g., "01ARZ3NDEKTSV4RRFFQ69G5FAV"
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Generator, nextString)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_generator_obj *gen = PHP_IDENTIFIER_GENERATOR_OBJ_P(getThis());
+    unsigned char bytes[16];
+    zend_string *result;
+
+    if (php_identifier_generator_fill(gen, bytes) == FAILURE) {
+        RETURN_THROWS();
+    }
+
+    if (gen->type == PHP_IDENTIFIER_GENERATOR_ULID) {
+        result = zend_string_alloc(26, 0);
+        php_identifier_format_ulid(bytes, ZSTR_VAL(result));
+    } else {
+        result = zend_string_alloc(36, 0);
+        php_identifier_format_uuid(bytes, ZSTR_VAL(result));
+    }
+
+    RETURN_NEW_STR(result);
+}
+
+/**
+ * Generate the next identifier as 16 raw bytes
+ *
+ * @return string 16-byte binary identifier
+ * @throws OutOfBoundsException If a monotonic ULID or UUIDv7 stream overflows and identifier.ulid_overflow is "throw"
+ *
+ * @example
+ * $generator = new Generator(Version7::class);
+ * $stmt->execute([$generator->nextBytes()]);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Generator, nextBytes)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_generator_obj *gen = PHP_IDENTIFIER_GENERATOR_OBJ_P(getThis());
+    zend_string *result = zend_string_alloc(16, 0);
+
+    if (php_identifier_generator_fill(gen, (unsigned char *)ZSTR_VAL(result)) == FAILURE) {
+        zend_string_efree(result);
+        RETURN_THROWS();
+    }
+
+    ZSTR_VAL(result)[16] = '\0';
+    RETURN_NEW_STR(result);
+}
+
+/**
+ * Get the identifier class this generator produces
+ *
+ * @return string Fully qualified class name
+ *
+ * @example
+ * echo (new Generator(Version4::class))->getClass(); // "Identifier\Uuid\Version4"
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Generator, getClass)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_STR_COPY(PHP_IDENTIFIER_GENERATOR_OBJ_P(getThis())->element_ce->name);
+}
+
+/* Generator method entries */
+static const zend_function_entry php_identifier_generator_methods[] = {
+    PHP_ME(Identifier_Generator, __construct, arginfo_generator_construct, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Generator, next, arginfo_generator_next, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Generator, nextString, arginfo_generator_nextString, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Generator, nextBytes, arginfo_generator_nextBytes, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Generator, getClass, arginfo_generator_getClass, ZEND_ACC_PUBLIC)
+    PHP_FE_END
+};
+
+/* Generator object creation */
+static zend_object *php_identifier_generator_create_object(zend_class_entry *ce)
+{
+    php_identifier_generator_obj *intern = zend_object_alloc(sizeof(php_identifier_generator_obj), ce);
+
+    zend_object_std_init(&intern->std, ce);
+    object_properties_init(&intern->std, ce);
+
+    intern->type = PHP_IDENTIFIER_GENERATOR_ULID;
+    intern->element_ce = php_identifier_ulid_ce;
+    intern->monotonic = true;
+    ZVAL_UNDEF(&intern->context);
+    intern->time_fn = NULL;
+    intern->random_fn = NULL;
+    memset(&intern->state, 0, sizeof(intern->state));
+    intern->last_100ns = 0;
+    intern->clock_seq = 0;
+    memset(intern->node, 0, sizeof(intern->node));
+    intern->entropy = NULL;
+    intern->entropy_size = 0;
+    intern->entropy_pos = 0;
+
+    intern->std.handlers = &php_identifier_generator_handlers;
+    return &intern->std;
+}
+
+/* Free generator object */
+static void php_identifier_generator_free_object(zend_object *object)
+{
+    php_identifier_generator_obj *intern = PHP_IDENTIFIER_GENERATOR_OBJ(object);
+
+    if (intern->entropy) {
+        ZEND_SECURE_ZERO(intern->entropy, intern->entropy_size);
+        efree(intern->entropy);
+    }
+    zval_ptr_dtor(&intern->context);
+
+    zend_object_std_dtor(&intern->std);
+}
+
+/* Expose the bound context to the cycle collector */
+static HashTable *php_identifier_generator_get_gc(zend_object *object, zval **table, int *n)
+{
+    php_identifier_generator_obj *intern = PHP_IDENTIFIER_GENERATOR_OBJ(object);
+
+    *table = &intern->context;
+    *n = Z_TYPE(intern->context) == IS_OBJECT ? 1 : 0;
+
+    return zend_std_get_properties(object);
+}
+
+/* Register Generator class */
+void php_identifier_generator_register_class(void)
+{
+    zend_class_entry ce;
+
+    INIT_NS_CLASS_ENTRY(ce, "Identifier", "Generator", php_identifier_generator_methods);
+    php_identifier_generator_ce = zend_register_internal_class(&ce);
+    php_identifier_generator_ce->ce_flags |= ZEND_ACC_FINAL | ZEND_ACC_NOT_SERIALIZABLE;
+    php_identifier_generator_ce->create_object = php_identifier_generator_create_object;
+
+    /* A clone would replay the same monotonic stream, so cloning is not supported */
+    memcpy(&php_identifier_generator_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+    php_identifier_generator_handlers.offset = XtOffsetOf(php_identifier_generator_obj, std);
+    php_identifier_generator_handlers.free_obj = php_identifier_generator_free_object;
+    php_identifier_generator_handlers.get_gc = php_identifier_generator_get_gc;
+    php_identifier_generator_handlers.clone_obj = NULL;
+}
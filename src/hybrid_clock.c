@@ -0,0 +1,422 @@
+#include "php.h"
+#include "zend_exceptions.h"
+#include "zend_interfaces.h"
+#include "php_identifier.h"
+#include <string.h>
+
+/* Arginfo declarations */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_hybrid_clock_construct, 0, 0, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, class, IS_STRING, 0, "Identifier\\Uuid\\Version7::class")
+    ZEND_ARG_OBJ_INFO_WITH_DEFAULT_VALUE(0, context, Identifier\\Context, 1, "null")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, maxDrift, IS_LONG, 0, "60000")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_hybrid_clock_next, 0, 0, Identifier\\Bit128, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_hybrid_clock_observe, 0, 1, IS_VOID, 0)
+    ZEND_ARG_OBJ_INFO(0, remoteId, Identifier\\Bit128, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_hybrid_clock_getTimestamp, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_hybrid_clock_getCounter, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+/* HybridClock object handlers */
+static zend_object_handlers php_identifier_hybrid_clock_handlers;
+
+/* Largest logical counter of a layout: rand_a of a UUIDv7, or the first 16
+ * randomness bits of a ULID, less the bits identifier.worker_bits reserves */
+static zend_always_inline uint32_t php_identifier_hybrid_clock_counter_max(bool ulid)
+{
+    return (ulid ? 0xFFFFU : 0xFFFU) >> php_identifier_worker_bits();
+}
+
+/* Place a remote counter field, worker ID bits included, on this clock's
+ * timeline as *physical and *logical. With identifier.worker_bits the
+ * worker ID sits above the counter, so a remote identifier of a lower
+ * worker ID sorts below every identifier of ours in its millisecond, and
+ * one of a higher worker ID above all of them: only the next millisecond
+ * sorts after it. Counters compare directly within one worker ID. */
+static void php_identifier_hybrid_clock_place(bool ulid, uint32_t field, uint64_t *physical, uint32_t *logical)
+{
+    uint32_t counter_max = php_identifier_hybrid_clock_counter_max(ulid);
+    uint32_t own = php_identifier_worker_bits()
+        ? php_identifier_worker_id() << ((ulid ? 16 : 12) - php_identifier_worker_bits())
+        : 0;
+    uint32_t remote = field & ~counter_max;
+
+    if (remote > own) {
+        (*physical)++;
+        *logical = 0;
+    } else if (remote < own) {
+        *logical = 0;
+    } else {
+        *logical = field & counter_max;
+    }
+}
+
+/* Current time in milliseconds from the bound context or the system clock */
+static zend_result php_identifier_hybrid_clock_time(php_identifier_hybrid_clock_obj *hlc, uint64_t *timestamp_ms)
+{
+    if (Z_TYPE(hlc->context) != IS_OBJECT) {
+        return php_identifier_get_timestamp_ms(timestamp_ms);
+    }
+
+    zval result;
+    zend_call_method(Z_OBJ(hlc->context), Z_OBJCE(hlc->context), &hlc->time_fn,
+        "gettimestampms", sizeof("gettimestampms") - 1, &result, 0, NULL, NULL);
+
+    if (EG(exception)) {
+        zval_ptr_dtor(&result);
+        return FAILURE;
+    }
+    if (Z_TYPE(result) != IS_LONG) {
+        zval_ptr_dtor(&result);
+        zend_throw_exception(zend_ce_exception, "Context getTimestampMs did not return a number", 0);
+        return FAILURE;
+    }
+
+    *timestamp_ms = (uint64_t)Z_LVAL(result);
+    return SUCCESS;
+}
+
+/* Random bytes from the bound context or the CSPRNG */
+static zend_result php_identifier_hybrid_clock_random(php_identifier_hybrid_clock_obj *hlc, unsigned char *out, size_t length)
+{
+    if (Z_TYPE(hlc->context) != IS_OBJECT) {
+        php_identifier_generate_random_bytes(out, length);
+        return SUCCESS;
+    }
+
+    zval result;
+    zval param;
+
+    ZVAL_LONG(&param, (zend_long)length);
+    zend_call_method(Z_OBJ(hlc->context), Z_OBJCE(hlc->context), &hlc->random_fn,
+        "getrandombytes", sizeof("getrandombytes") - 1, &result, 1, &param, NULL);
+
+    if (EG(exception)) {
+        zval_ptr_dtor(&result);
+        return FAILURE;
+    }
+    if (Z_TYPE(result) != IS_STRING || Z_STRLEN(result) != length) {
+        zval_ptr_dtor(&result);
+        zend_throw_exception_ex(zend_ce_exception, 0, "Context getRandomBytes did not return %zu bytes", length);
+        return FAILURE;
+    }
+
+    memcpy(out, Z_STRVAL(result), length);
+    zval_ptr_dtor(&result);
+    return SUCCESS;
+}
+
+/* HybridClock methods */
+
+/**
+ * Create a hybrid logical clock
+ *
+ * A hybrid logical clock pairs the physical time in milliseconds with a
+ * logical counter. Every identifier it issues is greater than the previous
+ * one and than every identifier passed to observe(), so identifiers sort
+ * in causal order across hosts whose clocks disagree, without a central
+ * sequencer. The pair is encoded in a standard layout: the time is the
+ * 48-bit timestamp, and the counter is rand_a of a UUIDv7 or the first 16
+ * randomness bits of a ULID, below any identifier.worker_bits. Keep one
+ * clock per worker and pass it every identifier the worker receives.
+ *
+ * @param string $class Identifier class: Version7 or Ulid
+ * @param Context|null $context Optional context for time and randomness
+ * @param int $maxDrift Largest lead over the local clock, in milliseconds, that observe() accepts; 0 for no limit
+ * @throws Exception If the class is not supported or maxDrift is negative
+ *
+ * @example
+ * $clock = new HybridClock(Version7::class);
+ * $clock->observe(Version7::fromString($message['id']));
+ * $reply = $clock->next(); // sorts after $message['id']
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_HybridClock, __construct)
+{
+    zend_string *class_name = NULL;
+    zval *context = NULL;
+    zend_long max_drift = 60000;
+
+    ZEND_PARSE_PARAMETERS_START(0, 3)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_STR(class_name)
+        Z_PARAM_OBJECT_OF_CLASS_OR_NULL(context, php_identifier_context_ce)
+        Z_PARAM_LONG(max_drift)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_hybrid_clock_obj *hlc = PHP_IDENTIFIER_HYBRID_CLOCK_OBJ_P(getThis());
+
+    if (class_name) {
+        zend_class_entry *ce = zend_lookup_class(class_name);
+
+        if (ce != php_identifier_uuid_version7_ce && ce != php_identifier_ulid_ce) {
+            zend_throw_exception(zend_ce_exception, "HybridClock class must be Version7 or Ulid", 0);
+            RETURN_THROWS();
+        }
+        hlc->element_ce = ce;
+    }
+
+    if (max_drift < 0) {
+        zend_throw_exception(zend_ce_exception, "HybridClock maximum drift must not be negative", 0);
+        RETURN_THROWS();
+    }
+    hlc->max_drift = (uint64_t)max_drift;
+
+    /* Context\System is the default behaviour: use the native fast path */
+    zval_ptr_dtor(&hlc->context);
+    ZVAL_UNDEF(&hlc->context);
+    hlc->time_fn = NULL;
+    hlc->random_fn = NULL;
+    if (context && Z_OBJCE_P(context) != php_identifier_context_system_ce) {
+        ZVAL_COPY(&hlc->context, context);
+    }
+
+    hlc->physical = 0;
+    hlc->logical = 0;
+}
+
+/**
+ * Issue the next identifier
+ *
+ * Takes the physical time if it is ahead of the clock, and otherwise keeps
+ * the clock's time and increments the counter. A full counter moves the
+ * clock one millisecond ahead of the physical time.
+ *
+ * @return Bit128 Instance of the class the clock was built with
+ *
+ * @example
+ * $clock = new HybridClock(Ulid::class);
+ * $id = $clock->next();
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_HybridClock, next)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_hybrid_clock_obj *hlc = PHP_IDENTIFIER_HYBRID_CLOCK_OBJ_P(getThis());
+    bool ulid = hlc->element_ce == php_identifier_ulid_ce;
+    unsigned char bytes[16];
+    uint64_t now;
+
+    if (php_identifier_hybrid_clock_time(hlc, &now) == FAILURE) {
+        RETURN_THROWS();
+    }
+
+    if (now > hlc->physical) {
+        hlc->physical = now;
+        hlc->logical = 0;
+    } else if (++hlc->logical > php_identifier_hybrid_clock_counter_max(ulid)) {
+        hlc->physical++;
+        hlc->logical = 0;
+    }
+
+    /* An observed clock can run ahead of ours: keep the persisted horizon above it */
+    if (Z_TYPE(hlc->context) != IS_OBJECT && hlc->physical > now) {
+        php_identifier_state_guard(hlc->physical);
+    }
+
+    if (php_identifier_hybrid_clock_random(hlc, bytes + 8, 8) == FAILURE) {
+        RETURN_THROWS();
+    }
+
+    bytes[0] = (hlc->physical >> 40) & 0xFF;
+    bytes[1] = (hlc->physical >> 32) & 0xFF;
+    bytes[2] = (hlc->physical >> 24) & 0xFF;
+    bytes[3] = (hlc->physical >> 16) & 0xFF;
+    bytes[4] = (hlc->physical >> 8) & 0xFF;
+    bytes[5] = hlc->physical & 0xFF;
+
+    if (ulid) {
+        bytes[6] = (hlc->logical >> 8) & 0xFF;
+        bytes[7] = hlc->logical & 0xFF;
+        php_identifier_worker_stamp_ulid(bytes + 6);
+    } else {
+        bytes[6] = 0x70 | ((hlc->logical >> 8) & 0x0F);
+        bytes[7] = hlc->logical & 0xFF;
+        bytes[8] = (bytes[8] & 0x3F) | 0x80;
+        php_identifier_worker_stamp_v7(bytes);
+    }
+
+    object_init_ex(return_value, hlc->element_ce);
+    php_identifier_bit128_fill(PHP_IDENTIFIER_BIT128_OBJ_P(return_value), bytes);
+}
+
+/**
+ * Merge the time of a received identifier into the clock
+ *
+ * Moves the clock up to the identifier's time and counter if they are
+ * ahead, so that the next identifier sorts after it. Both UUIDv7 and ULID
+ * layouts are understood, whichever class the clock issues. With
+ * identifier.worker_bits, an identifier of a higher worker ID moves the
+ * clock to the following millisecond.
+ *
+ * @param Bit128 $remoteId Version7 UUID or ULID received from another node
+ * @throws Exception If the identifier is neither, or leads the local clock by more than maxDrift
+ *
+ * @example
+ * $clock->observe(Ulid::fromString($event['id']));
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_HybridClock, observe)
+{
+    zval *remote;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_OBJECT_OF_CLASS(remote, php_identifier_bit128_ce)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_hybrid_clock_obj *hlc = PHP_IDENTIFIER_HYBRID_CLOCK_OBJ_P(getThis());
+    const unsigned char *data = PHP_IDENTIFIER_BIT128_OBJ_P(remote)->data;
+    uint64_t physical = 0;
+    uint32_t logical;
+    uint32_t field;
+    bool ulid;
+    uint64_t now;
+
+    for (int i = 0; i < 6; i++) {
+        physical = (physical << 8) | data[i];
+    }
+
+    if (instanceof_function(Z_OBJCE_P(remote), php_identifier_ulid_ce)) {
+        ulid = true;
+        field = ((uint32_t)data[6] << 8) | data[7];
+    } else if ((data[6] >> 4) == 7 && (data[8] & 0xC0) == 0x80) {
+        ulid = false;
+        field = ((uint32_t)(data[6] & 0x0F) << 8) | data[7];
+    } else {
+        zend_throw_exception(zend_ce_exception, "Remote identifier must be a Version7 UUID or a ULID", 0);
+        RETURN_THROWS();
+    }
+
+    if (php_identifier_hybrid_clock_time(hlc, &now) == FAILURE) {
+        RETURN_THROWS();
+    }
+
+    if (hlc->max_drift && physical > now && physical - now > hlc->max_drift) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Remote identifier is " ZEND_LONG_FMT " ms ahead of the local clock", (zend_long)(physical - now));
+        RETURN_THROWS();
+    }
+
+    php_identifier_hybrid_clock_place(ulid, field, &physical, &logical);
+
+    /* next() increments past the larger of the two */
+    if (physical > hlc->physical) {
+        hlc->physical = physical;
+        hlc->logical = logical;
+    } else if (physical == hlc->physical && logical > hlc->logical) {
+        hlc->logical = logical;
+    }
+}
+
+/**
+ * Get the time of the last identifier issued or observed
+ *
+ * @return int Milliseconds since the Unix epoch; 0 before the first call
+ *
+ * @example
+ * $lag = $clock->getTimestamp() - (int)(microtime(true) * 1000);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_HybridClock, getTimestamp)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_LONG((zend_long)PHP_IDENTIFIER_HYBRID_CLOCK_OBJ_P(getThis())->physical);
+}
+
+/**
+ * Get the logical counter of the last identifier issued or observed
+ *
+ * @return int Counter within the current millisecond
+ *
+ * @example
+ * echo $clock->getCounter();
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_HybridClock, getCounter)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_LONG((zend_long)PHP_IDENTIFIER_HYBRID_CLOCK_OBJ_P(getThis())->logical);
+}
+
+/* HybridClock method entries */
+static const zend_function_entry php_identifier_hybrid_clock_methods[] = {
+    PHP_ME(Identifier_HybridClock, __construct, arginfo_hybrid_clock_construct, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_HybridClock, next, arginfo_hybrid_clock_next, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_HybridClock, observe, arginfo_hybrid_clock_observe, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_HybridClock, getTimestamp, arginfo_hybrid_clock_getTimestamp, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_HybridClock, getCounter, arginfo_hybrid_clock_getCounter, ZEND_ACC_PUBLIC)
+    PHP_FE_END
+};
+
+/* HybridClock object creation */
+static zend_object *php_identifier_hybrid_clock_create_object(zend_class_entry *ce)
+{
+    php_identifier_hybrid_clock_obj *intern = zend_object_alloc(sizeof(php_identifier_hybrid_clock_obj), ce);
+
+    zend_object_std_init(&intern->std, ce);
+    object_properties_init(&intern->std, ce);
+
+    intern->element_ce = php_identifier_uuid_version7_ce;
+    intern->physical = 0;
+    intern->logical = 0;
+    intern->max_drift = 60000;
+    ZVAL_UNDEF(&intern->context);
+    intern->time_fn = NULL;
+    intern->random_fn = NULL;
+
+    intern->std.handlers = &php_identifier_hybrid_clock_handlers;
+    return &intern->std;
+}
+
+/* Free HybridClock object */
+static void php_identifier_hybrid_clock_free_object(zend_object *object)
+{
+    php_identifier_hybrid_clock_obj *intern = PHP_IDENTIFIER_HYBRID_CLOCK_OBJ(object);
+
+    zval_ptr_dtor(&intern->context);
+
+    zend_object_std_dtor(&intern->std);
+}
+
+/* Expose the bound context to the cycle collector */
+static HashTable *php_identifier_hybrid_clock_get_gc(zend_object *object, zval **table, int *n)
+{
+    php_identifier_hybrid_clock_obj *intern = PHP_IDENTIFIER_HYBRID_CLOCK_OBJ(object);
+
+    *table = &intern->context;
+    *n = Z_TYPE(intern->context) == IS_OBJECT ? 1 : 0;
+
+    return zend_std_get_properties(object);
+}
+
+/* Register HybridClock class */
+void php_identifier_hybrid_clock_register_class(void)
+{
+    zend_class_entry ce;
+
+    INIT_NS_CLASS_ENTRY(ce, "Identifier", "HybridClock", php_identifier_hybrid_clock_methods);
+    php_identifier_hybrid_clock_ce = zend_register_internal_class(&ce);
+    php_identifier_hybrid_clock_ce->ce_flags |= ZEND_ACC_FINAL | ZEND_ACC_NOT_SERIALIZABLE;
+    php_identifier_hybrid_clock_ce->create_object = php_identifier_hybrid_clock_create_object;
+
+    /* A clone would issue the same time and counter twice */
+    memcpy(&php_identifier_hybrid_clock_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+    php_identifier_hybrid_clock_handlers.offset = XtOffsetOf(php_identifier_hybrid_clock_obj, std);
+    php_identifier_hybrid_clock_handlers.free_obj = php_identifier_hybrid_clock_free_object;
+    php_identifier_hybrid_clock_handlers.get_gc = php_identifier_hybrid_clock_get_gc;
+    php_identifier_hybrid_clock_handlers.clone_obj = NULL;
+}
@@ -0,0 +1,356 @@
+#include "php.h"
+#include "zend_exceptions.h"
+#include "php_identifier.h"
+#include <string.h>
+
+#ifndef PHP_WIN32
+# include <sys/mman.h>
+# include <signal.h>
+# include <unistd.h>
+# include <errno.h>
+# if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#  define MAP_ANONYMOUS MAP_ANON
+# endif
+#endif
+
+/* Shared scopes need the GCC/Clang atomic builtins */
+#if defined(__GNUC__) || defined(__clang__)
+# define PHP_IDENTIFIER_MONOTONIC_SHARED 1
+#endif
+
+/* The last issued ULID is one 128-bit word: swap it with a 16-byte CAS where
+ * the compiler can inline one (config.m4 passes -mcx16 on x86-64), else
+ * guard it with a spin lock that recovers from a holder that died */
+#if defined(PHP_IDENTIFIER_MONOTONIC_SHARED) && defined(__SIZEOF_INT128__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+# define PHP_IDENTIFIER_MONOTONIC_CAS128 1
+typedef unsigned __int128 php_identifier_u128;
+#endif
+
+typedef struct _php_identifier_monotonic_cell {
+#ifdef PHP_IDENTIFIER_MONOTONIC_CAS128
+    php_identifier_u128 word;       /* timestamp << 80 | randomness */
+#else
+    uint64_t lock;                  /* generation << 32 | pid of the holder; pid 0 when free */
+    uint64_t hi;                    /* timestamp << 16 | randomness[0..1] */
+    uint64_t lo;                    /* randomness[2..9] */
+#endif
+} php_identifier_monotonic_cell;
+
+/* Host scope keeps one cell per worker ID, each on a cache line of its own */
+#define PHP_IDENTIFIER_MONOTONIC_STRIDE 64
+
+static php_identifier_monotonic_scope php_identifier_monotonic_active = PHP_IDENTIFIER_MONOTONIC_THREAD;
+static php_identifier_monotonic_cell *php_identifier_monotonic_cell_ptr = NULL;
+static size_t php_identifier_monotonic_mapped = 0;
+
+/* Process scope: one cell for all threads, on a cache line of its own */
+#ifdef PHP_IDENTIFIER_MONOTONIC_SHARED
+static php_identifier_monotonic_cell php_identifier_monotonic_process_cell __attribute__((aligned(64)));
+#endif
+
+static const char *php_identifier_monotonic_scope_names[] = {
+    "thread",
+    "process",
+    "host"
+};
+
+static zend_always_inline void php_identifier_monotonic_pause(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+#if defined(PHP_IDENTIFIER_MONOTONIC_SHARED) && !defined(PHP_IDENTIFIER_MONOTONIC_CAS128)
+/* Pauses on an unchanged lock word between checks on its holder: the
+ * critical section is a few stores, so a lock held this long belongs to a
+ * stalled or dead worker */
+# define PHP_IDENTIFIER_MONOTONIC_SPIN_LIMIT (1 << 20)
+
+/* Whether the process holding the lock is gone. A worker killed inside the
+ * critical section (SIGKILL, request timeout, segfault) never releases it. */
+static bool php_identifier_monotonic_holder_dead(uint64_t lock)
+{
+#ifndef PHP_WIN32
+    pid_t pid = (pid_t)(uint32_t)lock;
+
+    return pid != 0 && kill(pid, 0) != 0 && errno == ESRCH;
+#else
+    (void)lock;
+    return false;
+#endif
+}
+
+/* Take the cell lock and return the lock word this writer holds. The word
+ * names the holder from the moment it is taken, so a waiter that finds it
+ * unchanged for the whole spin limit can check on the holder, and takes
+ * the lock over only once that process is gone. */
+static uint64_t php_identifier_monotonic_lock(php_identifier_monotonic_cell *cell, zend_long *retries)
+{
+    uint64_t pid = (uint64_t)(uint32_t)php_identifier_current_pid();
+    uint64_t seen = 0;
+    uint32_t spins = 0;
+
+    for (;;) {
+        uint64_t lock = __atomic_load_n(&cell->lock, __ATOMIC_RELAXED);
+        uint64_t desired = (((lock >> 32) + 1) << 32) | pid;
+        bool take = (uint32_t)lock == 0;
+
+        if (lock != seen) {
+            seen = lock;
+            spins = 0;
+        } else if (!take && ++spins >= PHP_IDENTIFIER_MONOTONIC_SPIN_LIMIT) {
+            spins = 0;
+            take = php_identifier_monotonic_holder_dead(lock);
+        }
+
+        if (take && __atomic_compare_exchange_n(&cell->lock, &lock, desired,
+                false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return desired;
+        }
+
+        (*retries)++;
+        php_identifier_monotonic_pause();
+    }
+}
+
+/* Release the cell lock held with lock. The CAS leaves a lock that was taken
+ * over from this writer alone: it belongs to the writer that took it. */
+static zend_always_inline void php_identifier_monotonic_unlock(php_identifier_monotonic_cell *cell, uint64_t lock)
+{
+    uint64_t expected = lock;
+
+    __atomic_compare_exchange_n(&cell->lock, &expected, lock & ~UINT64_C(0xFFFFFFFF),
+        false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+}
+#endif
+
+/* Compute the range [first, first + count) that follows the last ULID for
+ * timestamp, and store its final ULID into hi/lo. fresh holds randomness for
+ * a new millisecond, or NULL if none was drawn yet. Returns 1 on success, 0
+ * if fresh randomness is needed, -1 if the 80-bit randomness would overflow
+ * or carry into the worker ID. */
+static int php_identifier_monotonic_advance(uint64_t *hi, uint64_t *lo, uint64_t timestamp, uint64_t count,
+    const unsigned char *fresh, unsigned char *first)
+{
+    uint64_t last_timestamp = *hi >> 16;
+    uint64_t rand_hi;
+    uint64_t rand_lo;
+
+    if ((*hi == 0 && *lo == 0) || timestamp > last_timestamp) {
+        if (!fresh) {
+            return 0;
+        }
+        rand_hi = ((uint64_t)fresh[0] << 8) | fresh[1];
+        rand_lo = 0;
+        for (int i = 2; i < 10; i++) {
+            rand_lo = (rand_lo << 8) | fresh[i];
+        }
+    } else {
+        /* Same millisecond, or a clock that lags the host's last ULID */
+        timestamp = last_timestamp;
+        rand_hi = *hi & 0xFFFF;
+        rand_lo = *lo + 1;
+        if (rand_lo == 0 && ++rand_hi > php_identifier_worker_ulid_max()) {
+            return -1;
+        }
+    }
+
+    first[0] = (timestamp >> 40) & 0xFF;
+    first[1] = (timestamp >> 32) & 0xFF;
+    first[2] = (timestamp >> 24) & 0xFF;
+    first[3] = (timestamp >> 16) & 0xFF;
+    first[4] = (timestamp >> 8) & 0xFF;
+    first[5] = timestamp & 0xFF;
+    first[6] = (rand_hi >> 8) & 0xFF;
+    first[7] = rand_hi & 0xFF;
+    for (int i = 0; i < 8; i++) {
+        first[8 + i] = (rand_lo >> ((7 - i) * 8)) & 0xFF;
+    }
+
+    /* Reserve the rest of the range */
+    uint64_t end_lo = rand_lo + (count - 1);
+    if (end_lo < rand_lo && ++rand_hi > php_identifier_worker_ulid_max()) {
+        return -1;
+    }
+
+    *hi = (timestamp << 16) | rand_hi;
+    *lo = end_lo;
+    return 1;
+}
+
+/* The shared cell of the calling worker. A ULID continued from the cell
+ * keeps the worker ID of whoever issued the last one, so workers with
+ * distinct IDs of identifier.worker_bits need cells of their own. The
+ * threads of one process share its worker ID, and so the process cell. */
+static zend_always_inline php_identifier_monotonic_cell *php_identifier_monotonic_cell_get(void)
+{
+    if (php_identifier_monotonic_active != PHP_IDENTIFIER_MONOTONIC_HOST) {
+        return php_identifier_monotonic_cell_ptr;
+    }
+
+    return (php_identifier_monotonic_cell *)((char *)php_identifier_monotonic_cell_ptr
+        + (size_t)php_identifier_worker_id() * PHP_IDENTIFIER_MONOTONIC_STRIDE);
+}
+
+/* Reserve count consecutive ULIDs after the last one issued in the shared
+ * scope and write the first into bytes. Returns FAILURE with an exception set
+ * if the randomness of the current millisecond is exhausted and
+ * identifier.ulid_overflow is "throw". */
+zend_result php_identifier_ulid_reserve(uint64_t timestamp, uint64_t count, unsigned char *bytes)
+{
+#ifdef PHP_IDENTIFIER_MONOTONIC_SHARED
+    php_identifier_monotonic_cell *cell = php_identifier_monotonic_cell_get();
+    unsigned char fresh[10];
+    bool have_fresh = false;
+    zend_long retries = 0;
+    int result;
+
+    ZEND_ASSERT(cell != NULL && count > 0);
+
+    IDENTIFIER_G(monotonic_reservations)++;
+
+    for (;;) {
+        uint64_t hi, lo;
+
+#ifdef PHP_IDENTIFIER_MONOTONIC_CAS128
+        /* A torn read only costs one failed CAS, which returns the real value */
+        php_identifier_u128 expected = cell->word;
+
+        for (;;) {
+            php_identifier_u128 desired;
+            php_identifier_u128 seen;
+
+            hi = (uint64_t)(expected >> 64);
+            lo = (uint64_t)expected;
+            result = php_identifier_monotonic_advance(&hi, &lo, timestamp, count, have_fresh ? fresh : NULL, bytes);
+            if (result != 1) {
+                break;
+            }
+
+            desired = ((php_identifier_u128)hi << 64) | lo;
+            seen = __sync_val_compare_and_swap(&cell->word, expected, desired);
+            if (seen == expected) {
+                IDENTIFIER_G(monotonic_retries) += retries;
+                return SUCCESS;
+            }
+            expected = seen;
+            retries++;
+            php_identifier_monotonic_pause();
+        }
+#else
+        uint64_t lock = php_identifier_monotonic_lock(cell, &retries);
+
+        hi = cell->hi;
+        lo = cell->lo;
+        result = php_identifier_monotonic_advance(&hi, &lo, timestamp, count, have_fresh ? fresh : NULL, bytes);
+        if (result == 1) {
+            cell->hi = hi;
+            cell->lo = lo;
+        }
+        php_identifier_monotonic_unlock(cell, lock);
+
+        if (result == 1) {
+            IDENTIFIER_G(monotonic_retries) += retries;
+            return SUCCESS;
+        }
+#endif
+
+        if (result < 0) {
+            /* Continue after the exhausted millisecond, as the policy says */
+            uint64_t exhausted = MAX(timestamp, hi >> 16);
+
+            if (php_identifier_ulid_overflow(&exhausted) == FAILURE) {
+                IDENTIFIER_G(monotonic_retries) += retries;
+                return FAILURE;
+            }
+            timestamp = exhausted;
+            have_fresh = false;
+            continue;
+        }
+
+        /* A new millisecond: draw its randomness outside the critical section */
+        php_identifier_generate_random_bytes(fresh, sizeof(fresh));
+        php_identifier_worker_stamp_ulid(fresh);
+        have_fresh = true;
+    }
+#else
+    return php_identifier_ulid_next(&IDENTIFIER_G(ulid_state), timestamp, NULL, bytes);
+#endif
+}
+
+/* Which monotonic state Ulid::generate() and ulid() use without a context */
+php_identifier_monotonic_scope php_identifier_monotonic_scope_get(void)
+{
+    return php_identifier_monotonic_active;
+}
+
+/* Parse identifier.monotonic_scope and set up the shared cell. Runs in MINIT
+ * after the worker ID is resolved, so a host-scope mapping with a cell for
+ * every worker ID exists before a process manager forks workers. */
+void php_identifier_monotonic_startup(const char *scope)
+{
+    php_identifier_monotonic_active = PHP_IDENTIFIER_MONOTONIC_THREAD;
+
+    if (!scope || !*scope || strcmp(scope, "thread") == 0) {
+        return;
+    }
+
+    if (strcmp(scope, "process") != 0 && strcmp(scope, "host") != 0) {
+        php_error_docref(NULL, E_WARNING, "Unknown identifier.monotonic_scope \"%s\", using \"thread\"", scope);
+        return;
+    }
+
+#ifdef PHP_IDENTIFIER_MONOTONIC_SHARED
+    if (strcmp(scope, "process") == 0) {
+        memset(&php_identifier_monotonic_process_cell, 0, sizeof(php_identifier_monotonic_process_cell));
+        php_identifier_monotonic_cell_ptr = &php_identifier_monotonic_process_cell;
+        php_identifier_monotonic_active = PHP_IDENTIFIER_MONOTONIC_PROCESS;
+        return;
+    }
+#endif
+
+#if defined(PHP_IDENTIFIER_MONOTONIC_SHARED) && !defined(PHP_WIN32) && defined(MAP_ANONYMOUS)
+    size_t size = (size_t)PHP_IDENTIFIER_MONOTONIC_STRIDE << php_identifier_worker_bits();
+    void *mapped = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (mapped == MAP_FAILED) {
+        php_error_docref(NULL, E_WARNING, "Failed to map shared ULID state, using identifier.monotonic_scope \"thread\"");
+        return;
+    }
+
+    memset(mapped, 0, size);
+    php_identifier_monotonic_cell_ptr = mapped;
+    php_identifier_monotonic_mapped = size;
+    php_identifier_monotonic_active = PHP_IDENTIFIER_MONOTONIC_HOST;
+#else
+    php_error_docref(NULL, E_WARNING, "identifier.monotonic_scope \"%s\" is not supported on this platform, using \"thread\"", scope);
+#endif
+}
+
+/* Unmap the shared cell at module shutdown */
+void php_identifier_monotonic_shutdown(void)
+{
+#if defined(PHP_IDENTIFIER_MONOTONIC_SHARED) && !defined(PHP_WIN32) && defined(MAP_ANONYMOUS)
+    if (php_identifier_monotonic_mapped) {
+        munmap(php_identifier_monotonic_cell_ptr, php_identifier_monotonic_mapped);
+    }
+#endif
+    php_identifier_monotonic_cell_ptr = NULL;
+    php_identifier_monotonic_mapped = 0;
+    php_identifier_monotonic_active = PHP_IDENTIFIER_MONOTONIC_THREAD;
+}
+
+/* Add the monotonic state counters of the calling thread to stats */
+void php_identifier_monotonic_stats(zval *stats)
+{
+    zval monotonic;
+
+    array_init_size(&monotonic, 3);
+    add_assoc_string(&monotonic, "scope", (char *)php_identifier_monotonic_scope_names[php_identifier_monotonic_active]);
+    add_assoc_long(&monotonic, "reservations", IDENTIFIER_G(monotonic_reservations));
+    add_assoc_long(&monotonic, "retries", IDENTIFIER_G(monotonic_retries));
+    add_assoc_zval(stats, "monotonic", &monotonic);
+}
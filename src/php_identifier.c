@@ -4,11 +4,29 @@
 
 #include "php.h"
 #include "php_ini.h"
+#include "zend_exceptions.h"
 #include "ext/standard/info.h"
 #include "php_identifier.h"
 #include <sys/time.h>
 #include <time.h>
 
+#ifdef PHP_WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+/* Cache the pid and refresh it in forked children, so fork checks stay syscall-free */
+#if defined(HAVE_PTHREAD_H) && !defined(PHP_WIN32)
+# define PHP_IDENTIFIER_PID_ATFORK 1
+# include <pthread.h>
+static zend_long php_identifier_pid;
+static void php_identifier_pid_atfork_child(void)
+{
+    php_identifier_pid = (zend_long)getpid();
+}
+#endif
+
 /* Include random headers - compatibility across PHP versions */
 #if PHP_VERSION_ID >= 80200
 #include "ext/random/php_random.h"
@@ -22,6 +40,8 @@ zend_class_entry *php_identifier_context_ce;
 zend_class_entry *php_identifier_context_system_ce;
 zend_class_entry *php_identifier_context_fixed_ce;
 zend_class_entry *php_identifier_bit128_ce;
+zend_class_entry *php_identifier_bit128_vector_ce;
+zend_class_entry *php_identifier_bit128_set_ce;
 zend_class_entry *php_identifier_uuid_ce;
 zend_class_entry *php_identifier_uuid_version1_ce;
 zend_class_entry *php_identifier_uuid_version3_ce;
@@ -31,21 +51,97 @@ zend_class_entry *php_identifier_uuid_version6_ce;
 zend_class_entry *php_identifier_uuid_version7_ce;
 zend_class_entry *php_identifier_ulid_ce;
 zend_class_entry *php_identifier_codec_ce;
+zend_class_entry *php_identifier_generator_ce;
+zend_class_entry *php_identifier_reservoir_ce;
+zend_class_entry *php_identifier_snowflake_ce;
+zend_class_entry *php_identifier_sequence_allocator_ce;
+zend_class_entry *php_identifier_hybrid_clock_ce;
+
+/* Map identifier.ulid_overflow onto its policy */
+static ZEND_INI_MH(OnUpdateUlidOverflow)
+{
+    php_identifier_ulid_overflow_policy policy;
+
+    if (zend_string_equals_literal_ci(new_value, "throw")) {
+        policy = PHP_IDENTIFIER_ULID_OVERFLOW_THROW;
+    } else if (zend_string_equals_literal_ci(new_value, "advance")) {
+        policy = PHP_IDENTIFIER_ULID_OVERFLOW_ADVANCE;
+    } else if (zend_string_equals_literal_ci(new_value, "wait")) {
+        policy = PHP_IDENTIFIER_ULID_OVERFLOW_WAIT;
+    } else {
+        return FAILURE;
+    }
+
+    IDENTIFIER_G(ulid_overflow) = policy;
+    return SUCCESS;
+}
+
+/* Map identifier.clock_regression onto its policy */
+static ZEND_INI_MH(OnUpdateClockRegression)
+{
+    php_identifier_clock_regression_policy policy;
+
+    if (zend_string_equals_literal_ci(new_value, "clamp")) {
+        policy = PHP_IDENTIFIER_CLOCK_REGRESSION_CLAMP;
+    } else if (zend_string_equals_literal_ci(new_value, "wait")) {
+        policy = PHP_IDENTIFIER_CLOCK_REGRESSION_WAIT;
+    } else if (zend_string_equals_literal_ci(new_value, "throw")) {
+        policy = PHP_IDENTIFIER_CLOCK_REGRESSION_THROW;
+    } else {
+        return FAILURE;
+    }
+
+    IDENTIFIER_G(clock_regression) = policy;
+    return SUCCESS;
+}
+
+/* {{{ INI entries */
+PHP_INI_BEGIN()
+    STD_PHP_INI_BOOLEAN("identifier.string_cache", "0", PHP_INI_ALL, OnUpdateBool, string_cache, zend_identifier_globals, identifier_globals)
+    STD_PHP_INI_ENTRY("identifier.reservoir", "0", PHP_INI_SYSTEM|PHP_INI_PERDIR, OnUpdateLong, reservoir_size, zend_identifier_globals, identifier_globals)
+    STD_PHP_INI_ENTRY("identifier.monotonic_scope", "thread", PHP_INI_SYSTEM, OnUpdateString, monotonic_scope, zend_identifier_globals, identifier_globals)
+    STD_PHP_INI_ENTRY("identifier.ulid_streams", "1024", PHP_INI_ALL, OnUpdateLong, ulid_streams_max, zend_identifier_globals, identifier_globals)
+    PHP_INI_ENTRY("identifier.ulid_overflow", "throw", PHP_INI_ALL, OnUpdateUlidOverflow)
+    PHP_INI_ENTRY("identifier.clock_regression", "clamp", PHP_INI_ALL, OnUpdateClockRegression)
+    STD_PHP_INI_ENTRY("identifier.worker_bits", "0", PHP_INI_SYSTEM, OnUpdateLong, worker_bits, zend_identifier_globals, identifier_globals)
+    STD_PHP_INI_ENTRY("identifier.worker_id", "", PHP_INI_SYSTEM, OnUpdateString, worker_id, zend_identifier_globals, identifier_globals)
+    STD_PHP_INI_ENTRY("identifier.sequence_file", "", PHP_INI_SYSTEM, OnUpdateString, sequence_file, zend_identifier_globals, identifier_globals)
+    STD_PHP_INI_ENTRY("identifier.state_file", "", PHP_INI_SYSTEM, OnUpdateString, state_file, zend_identifier_globals, identifier_globals)
+    STD_PHP_INI_ENTRY("identifier.state_interval", "100", PHP_INI_SYSTEM, OnUpdateLong, state_interval, zend_identifier_globals, identifier_globals)
+PHP_INI_END()
+/* }}} */
 
-/* Forward declaration for globals initialization */
+/* Forward declarations for globals initialization and cleanup */
 static void php_identifier_init_globals(zend_identifier_globals *identifier_globals);
+static void php_identifier_shutdown_globals(zend_identifier_globals *identifier_globals);
 
 /* {{{ PHP_MINIT_FUNCTION */
 PHP_MINIT_FUNCTION(identifier)
 {
     /* Initialize globals */
-    ZEND_INIT_MODULE_GLOBALS(identifier, php_identifier_init_globals, NULL);
+    ZEND_INIT_MODULE_GLOBALS(identifier, php_identifier_init_globals, php_identifier_shutdown_globals);
+    REGISTER_INI_ENTRIES();
+#ifdef PHP_IDENTIFIER_PID_ATFORK
+    php_identifier_pid = (zend_long)getpid();
+    pthread_atfork(NULL, NULL, php_identifier_pid_atfork_child);
+#endif
+    php_identifier_worker_startup(IDENTIFIER_G(worker_bits), IDENTIFIER_G(worker_id));
+    php_identifier_monotonic_startup(IDENTIFIER_G(monotonic_scope));
+    php_identifier_sequence_startup(IDENTIFIER_G(sequence_file));
+    php_identifier_state_startup(IDENTIFIER_G(state_file), IDENTIFIER_G(state_interval));
 
     /* Register all classes */
     php_identifier_context_register_classes();
     php_identifier_bit128_register_class();
     php_identifier_uuid_register_classes();
     php_identifier_ulid_register_class();
+    php_identifier_bit128_vector_register_class();
+    php_identifier_bit128_set_register_class();
+    php_identifier_generator_register_class();
+    php_identifier_reservoir_register_class();
+    php_identifier_snowflake_register_class();
+    php_identifier_sequence_register_class();
+    php_identifier_hybrid_clock_register_class();
     php_identifier_codec_init();
 
     return SUCCESS;
@@ -55,6 +151,39 @@ PHP_MINIT_FUNCTION(identifier)
 /* {{{ PHP_MSHUTDOWN_FUNCTION */
 PHP_MSHUTDOWN_FUNCTION(identifier)
 {
+    php_identifier_monotonic_shutdown();
+    php_identifier_sequence_shutdown();
+    php_identifier_state_shutdown();
+    UNREGISTER_INI_ENTRIES();
+#ifndef ZTS
+    php_identifier_shutdown_globals(&identifier_globals);
+#endif
+
+    return SUCCESS;
+}
+/* }}} */
+
+/* {{{ PHP_RINIT_FUNCTION */
+PHP_RINIT_FUNCTION(identifier)
+{
+#if defined(ZTS) && defined(COMPILE_DL_IDENTIFIER)
+    ZEND_TSRMLS_CACHE_UPDATE();
+#endif
+
+    if (IDENTIFIER_G(reservoir_size) > 0) {
+        php_identifier_reservoir_fill((size_t)MIN(IDENTIFIER_G(reservoir_size), PHP_IDENTIFIER_RESERVOIR_MAX));
+    }
+
+    return SUCCESS;
+}
+/* }}} */
+
+/* {{{ PHP_RSHUTDOWN_FUNCTION */
+PHP_RSHUTDOWN_FUNCTION(identifier)
+{
+    php_identifier_uuid_release_well_known();
+    php_identifier_reservoir_release();
+
     return SUCCESS;
 }
 /* }}} */
@@ -66,6 +195,8 @@ PHP_MINFO_FUNCTION(identifier)
     php_info_print_table_header(2, "identifier support", "enabled");
     php_info_print_table_row(2, "Version", PHP_IDENTIFIER_VERSION);
     php_info_print_table_end();
+
+    DISPLAY_INI_ENTRIES();
 }
 /* }}} */
 
@@ -73,11 +204,11 @@ PHP_MINFO_FUNCTION(identifier)
 zend_module_entry identifier_module_entry = {
     STANDARD_MODULE_HEADER,
     "identifier",
-    NULL, /* functions */
+    php_identifier_functions,
     PHP_MINIT(identifier),
     PHP_MSHUTDOWN(identifier),
-    NULL, /* PHP_RINIT */
-    NULL, /* PHP_RSHUTDOWN */
+    PHP_RINIT(identifier),
+    PHP_RSHUTDOWN(identifier),
     PHP_MINFO(identifier),
     PHP_IDENTIFIER_VERSION,
     STANDARD_MODULE_PROPERTIES
@@ -97,9 +228,19 @@ ZEND_DECLARE_MODULE_GLOBALS(identifier)
 static void php_identifier_init_globals(zend_identifier_globals *identifier_globals)
 {
     memset(identifier_globals, 0, sizeof(zend_identifier_globals));
-    identifier_globals->ulid_last_timestamp = 0;
-    memset(identifier_globals->ulid_last_randomness, 0, 10);
-    identifier_globals->ulid_randomness_initialized = 0;
+    identifier_globals->ulid_state.last_timestamp = 0;
+    memset(identifier_globals->ulid_state.last_randomness, 0, 10);
+    identifier_globals->ulid_state.initialized = false;
+}
+
+/* Globals cleanup function: free the persistent per-stream ULID states */
+static void php_identifier_shutdown_globals(zend_identifier_globals *identifier_globals)
+{
+    if (identifier_globals->ulid_streams) {
+        zend_hash_destroy(identifier_globals->ulid_streams);
+        pefree(identifier_globals->ulid_streams, 1);
+        identifier_globals->ulid_streams = NULL;
+    }
 }
 
 #ifdef COMPILE_DL_IDENTIFIER
@@ -114,6 +255,11 @@ ZEND_GET_MODULE(identifier)
 /* Generate cryptographically secure random bytes using PHP's random_bytes */
 void php_identifier_generate_random_bytes(unsigned char *buffer, size_t length)
 {
+    /* Prefilled entropy first: no syscall on the request path */
+    if (php_identifier_reservoir_take(buffer, length)) {
+        return;
+    }
+
     /* Try to use PHP's secure random_bytes function */
     if (php_random_bytes(buffer, length, 1) == SUCCESS) {
         return;
@@ -127,8 +273,20 @@ void php_identifier_generate_random_bytes(unsigned char *buffer, size_t length)
     }
 }
 
-/* Get current timestamp in milliseconds using PHP's time functions */
-uint64_t php_identifier_get_timestamp_ms(void)
+/* Pid of the calling process without a syscall, for state that must not be
+ * shared with forked children */
+zend_long php_identifier_current_pid(void)
+{
+#ifdef PHP_IDENTIFIER_PID_ATFORK
+    return php_identifier_pid;
+#else
+    return (zend_long)getpid();
+#endif
+}
+
+/* Read the system clock in milliseconds, as gettimeofday() reports it,
+ * without identifier.clock_regression or the identifier.state_file floor */
+uint64_t php_identifier_read_clock_ms(void)
 {
     /* Use PHP's microtime for consistency with userland code */
     struct timeval tv;
@@ -140,8 +298,94 @@ uint64_t php_identifier_get_timestamp_ms(void)
     return (uint64_t)time(NULL) * 1000ULL;
 }
 
-/* Get current timestamp in 100-nanosecond intervals since Gregorian epoch */
-uint64_t php_identifier_get_gregorian_epoch_time(void)
+/* Keep the system clock from going backwards for this thread. A reading
+ * below the latest one is a regression: identifier.clock_regression then
+ * clamps it to the latest reading, sleeps until the clock catches up, or
+ * throws. Generators count on within a clamped millisecond as they do
+ * within a real one. Returns FAILURE with an exception set on "throw". */
+static zend_result php_identifier_clock_check(uint64_t *timestamp_ms)
+{
+    uint64_t high = IDENTIFIER_G(clock_high_ms);
+    uint64_t now = *timestamp_ms;
+
+    if (EXPECTED(now >= high)) {
+        IDENTIFIER_G(clock_high_ms) = now;
+        IDENTIFIER_G(clock_last_ms) = now;
+        return SUCCESS;
+    }
+
+    uint64_t jump = high - now;
+
+    /* One event per step back, not one per reading that trails it */
+    if (now < IDENTIFIER_G(clock_last_ms)) {
+        IDENTIFIER_G(clock_regressions)++;
+    }
+    if (jump > (uint64_t)IDENTIFIER_G(clock_max_regression)) {
+        IDENTIFIER_G(clock_max_regression) = (zend_long)jump;
+    }
+    IDENTIFIER_G(clock_last_ms) = now;
+
+    switch (IDENTIFIER_G(clock_regression)) {
+        case PHP_IDENTIFIER_CLOCK_REGRESSION_WAIT:
+            if (jump <= PHP_IDENTIFIER_CLOCK_WAIT_MAX) {
+                while (now < high) {
+#ifdef PHP_WIN32
+                    Sleep(1);
+#else
+                    usleep(1000);
+#endif
+                    now = php_identifier_read_clock_ms();
+                }
+                IDENTIFIER_G(clock_high_ms) = now;
+                IDENTIFIER_G(clock_last_ms) = now;
+                *timestamp_ms = now;
+                return SUCCESS;
+            }
+            break;
+
+        case PHP_IDENTIFIER_CLOCK_REGRESSION_THROW:
+            zend_throw_exception_ex(zend_ce_exception, 0, "System clock moved backwards by " ZEND_LONG_FMT " ms", (zend_long)jump);
+            return FAILURE;
+
+        default:
+            break;
+    }
+
+    *timestamp_ms = high;
+    return SUCCESS;
+}
+
+/* Get current timestamp in milliseconds using PHP's time functions.
+ * Returns FAILURE with an exception set when identifier.clock_regression
+ * is "throw" and the clock stepped backwards. */
+zend_result php_identifier_get_timestamp_ms(uint64_t *timestamp_ms)
+{
+    uint64_t now = php_identifier_read_clock_ms();
+
+    if (php_identifier_clock_check(&now) == FAILURE) {
+        return FAILURE;
+    }
+
+    *timestamp_ms = php_identifier_state_guard(now);
+    return SUCCESS;
+}
+
+/* Add the clock regression counters of the calling thread to stats */
+void php_identifier_clock_regression_stats(zval *stats)
+{
+    static const char *policies[] = {"clamp", "wait", "throw"};
+    zval regression;
+
+    array_init_size(&regression, 3);
+    add_assoc_string(&regression, "policy", (char *)policies[IDENTIFIER_G(clock_regression)]);
+    add_assoc_long(&regression, "events", IDENTIFIER_G(clock_regressions));
+    add_assoc_long(&regression, "max_jump_ms", IDENTIFIER_G(clock_max_regression));
+    add_assoc_zval(stats, "clock_regression", &regression);
+}
+
+/* Get current timestamp in 100-nanosecond intervals since Gregorian epoch.
+ * Fails like php_identifier_get_timestamp_ms(). */
+zend_result php_identifier_get_gregorian_epoch_time(uint64_t *timestamp_100ns)
 {
     /* Gregorian epoch: October 15, 1582 00:00:00 UTC */
     /* Unix epoch: January 1, 1970 00:00:00 UTC */
@@ -152,5 +396,17 @@ uint64_t php_identifier_get_gregorian_epoch_time(void)
     gettimeofday(&tv, NULL);
     
     uint64_t unix_100ns = (uint64_t)tv.tv_sec * 10000000ULL + (uint64_t)tv.tv_usec * 10ULL;
-    return unix_100ns + GREGORIAN_TO_UNIX_100NS;
+    uint64_t guarded_ms = unix_100ns / 10000ULL;
+
+    if (php_identifier_clock_check(&guarded_ms) == FAILURE) {
+        return FAILURE;
+    }
+    guarded_ms = php_identifier_state_guard(guarded_ms);
+
+    /* Clamped after a regression, or below the floor of identifier.state_file */
+    if (guarded_ms > unix_100ns / 10000ULL) {
+        unix_100ns = guarded_ms * 10000ULL;
+    }
+    *timestamp_100ns = unix_100ns + GREGORIAN_TO_UNIX_100NS;
+    return SUCCESS;
 }
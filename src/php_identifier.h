@@ -4,7 +4,7 @@
 extern zend_module_entry identifier_module_entry;
 #define phpext_identifier_ptr &identifier_module_entry
 
-#define PHP_IDENTIFIER_VERSION "0.1.0"
+#define PHP_IDENTIFIER_VERSION "0.2.1" /* x-release-please-version */
 
 #ifdef PHP_WIN32
 #	define PHP_IDENTIFIER_API __declspec(dllexport)
@@ -18,11 +18,104 @@ extern zend_module_entry identifier_module_entry;
 #include "TSRM.h"
 #endif
 
+/* Shared per-request UUID instances: nil, max and the RFC 9562 namespaces */
+typedef enum _php_identifier_uuid_well_known_id {
+    PHP_IDENTIFIER_UUID_WELL_KNOWN_NIL = 0,
+    PHP_IDENTIFIER_UUID_WELL_KNOWN_MAX,
+    PHP_IDENTIFIER_UUID_WELL_KNOWN_DNS,
+    PHP_IDENTIFIER_UUID_WELL_KNOWN_URL,
+    PHP_IDENTIFIER_UUID_WELL_KNOWN_OID,
+    PHP_IDENTIFIER_UUID_WELL_KNOWN_X500,
+    PHP_IDENTIFIER_UUID_WELL_KNOWN_COUNT
+} php_identifier_uuid_well_known_id;
+
+#define PHP_IDENTIFIER_UUID_NAMESPACE_COUNT 4
+
+/* Monotonic ULID state: the last timestamp and the randomness issued with it */
+typedef struct _php_identifier_ulid_state {
+    uint64_t last_timestamp;
+    uint64_t last_clock;           /* timestamp the clock gave for it */
+    unsigned char last_randomness[10]; /* ULID_RANDOMNESS_BYTES */
+    bool initialized;
+} php_identifier_ulid_state;
+
+/* Snowflake sequence state: the last millisecond and the sequence issued in it */
+typedef struct _php_identifier_snowflake_state {
+    uint64_t last_ms;
+    uint64_t sequence;
+    bool initialized;
+} php_identifier_snowflake_state;
+
+/* Prefilled CSPRNG output, consumed from the end; owned by the pid that filled it */
+typedef struct _php_identifier_reservoir {
+    unsigned char *bytes;
+    size_t capacity;                /* in bytes */
+    size_t available;               /* in bytes */
+    zend_long pid;
+    zend_long hits;
+    zend_long misses;
+} php_identifier_reservoir;
+
+/* Upper bound for Reservoir::fill() and identifier.reservoir, in identifiers */
+#define PHP_IDENTIFIER_RESERVOIR_MAX 65536
+
+/* Upper bound for identifier.worker_bits: the width of UUIDv7 rand_a */
+#define PHP_IDENTIFIER_WORKER_MAX_BITS 12
+
+/* Where the monotonic ULID state lives (identifier.monotonic_scope) */
+typedef enum _php_identifier_monotonic_scope {
+    PHP_IDENTIFIER_MONOTONIC_THREAD = 0,    /* per thread, in module globals */
+    PHP_IDENTIFIER_MONOTONIC_PROCESS,       /* one atomic word for all threads */
+    PHP_IDENTIFIER_MONOTONIC_HOST           /* shared mapping inherited by forked workers */
+} php_identifier_monotonic_scope;
+
+/* What happens when a millisecond's ULID randomness is used up (identifier.ulid_overflow) */
+typedef enum _php_identifier_ulid_overflow_policy {
+    PHP_IDENTIFIER_ULID_OVERFLOW_THROW = 0, /* OutOfBoundsException */
+    PHP_IDENTIFIER_ULID_OVERFLOW_ADVANCE,   /* continue in the next logical millisecond */
+    PHP_IDENTIFIER_ULID_OVERFLOW_WAIT       /* spin until the clock ticks */
+} php_identifier_ulid_overflow_policy;
+
+/* What happens when the system clock steps backwards (identifier.clock_regression) */
+typedef enum _php_identifier_clock_regression_policy {
+    PHP_IDENTIFIER_CLOCK_REGRESSION_CLAMP = 0, /* keep the last timestamp and count within it */
+    PHP_IDENTIFIER_CLOCK_REGRESSION_WAIT,      /* sleep until the clock catches up */
+    PHP_IDENTIFIER_CLOCK_REGRESSION_THROW      /* Exception */
+} php_identifier_clock_regression_policy;
+
+/* Longest backwards step the "wait" policy sleeps through; larger ones are clamped */
+#define PHP_IDENTIFIER_CLOCK_WAIT_MAX 1000
+
 /* Thread-safe globals for ULID monotonic state */
 ZEND_BEGIN_MODULE_GLOBALS(identifier)
-    uint64_t ulid_last_timestamp;
-    unsigned char ulid_last_randomness[10]; /* ULID_RANDOMNESS_BYTES */
-    int ulid_randomness_initialized;
+    php_identifier_ulid_state ulid_state;
+    php_identifier_ulid_state ulid_context_state; /* calls that pass a Context */
+    HashTable *ulid_streams;       /* Ulid::generateFor() states, oldest first */
+    zend_long ulid_streams_max;    /* identifier.ulid_streams */
+    php_identifier_ulid_overflow_policy ulid_overflow; /* identifier.ulid_overflow */
+    zend_long ulid_overflow_throws;
+    zend_long ulid_overflow_advances;
+    zend_long ulid_overflow_waits;
+    bool string_cache;             /* identifier.string_cache */
+    zend_long reservoir_size;      /* identifier.reservoir */
+    char *monotonic_scope;         /* identifier.monotonic_scope */
+    zend_long monotonic_reservations; /* shared-scope reservations by this thread */
+    zend_long monotonic_retries;   /* failed CAS or lock attempts among them */
+    php_identifier_snowflake_state snowflake_state;
+    uint64_t snowflake_clock_offset; /* wall clock minus CLOCK_MONOTONIC, in ms */
+    bool snowflake_clock_anchored;
+    zend_long worker_bits;         /* identifier.worker_bits */
+    char *worker_id;               /* identifier.worker_id */
+    char *sequence_file;           /* identifier.sequence_file */
+    php_identifier_clock_regression_policy clock_regression; /* identifier.clock_regression */
+    uint64_t clock_high_ms;        /* latest system time this thread has read */
+    uint64_t clock_last_ms;        /* previous raw reading */
+    zend_long clock_regressions;   /* backwards steps seen by this thread */
+    zend_long clock_max_regression; /* largest of them, in ms */
+    char *state_file;              /* identifier.state_file */
+    zend_long state_interval;      /* identifier.state_interval, in ms */
+    php_identifier_reservoir reservoir;
+    zend_object *uuid_well_known[PHP_IDENTIFIER_UUID_WELL_KNOWN_COUNT];
 ZEND_END_MODULE_GLOBALS(identifier)
 
 #ifdef ZTS
@@ -38,6 +131,8 @@ extern zend_class_entry *php_identifier_context_ce;
 extern zend_class_entry *php_identifier_context_system_ce;
 extern zend_class_entry *php_identifier_context_fixed_ce;
 extern zend_class_entry *php_identifier_bit128_ce;
+extern zend_class_entry *php_identifier_bit128_vector_ce;
+extern zend_class_entry *php_identifier_bit128_set_ce;
 extern zend_class_entry *php_identifier_uuid_ce;
 extern zend_class_entry *php_identifier_uuid_version1_ce;
 extern zend_class_entry *php_identifier_uuid_version3_ce;
@@ -47,13 +142,150 @@ extern zend_class_entry *php_identifier_uuid_version6_ce;
 extern zend_class_entry *php_identifier_uuid_version7_ce;
 extern zend_class_entry *php_identifier_ulid_ce;
 extern zend_class_entry *php_identifier_codec_ce;
+extern zend_class_entry *php_identifier_generator_ce;
+extern zend_class_entry *php_identifier_reservoir_ce;
+extern zend_class_entry *php_identifier_snowflake_ce;
+extern zend_class_entry *php_identifier_sequence_allocator_ce;
+extern zend_class_entry *php_identifier_hybrid_clock_ce;
 
 /* Object structures */
+/* String formats of a Bit128 payload */
+typedef enum _php_identifier_format {
+    PHP_IDENTIFIER_FORMAT_HEX = 0,
+    PHP_IDENTIFIER_FORMAT_UUID,
+    PHP_IDENTIFIER_FORMAT_ULID
+} php_identifier_format;
+
 typedef struct _php_identifier_bit128_obj {
     unsigned char data[16];
+    uint8_t str_cache_format;      /* php_identifier_format of str_cache */
+    bool initialized;              /* set once the payload is stored */
+    zend_string *str_cache;        /* lazily built canonical string */
+    zend_string *bytes_cache;      /* lazily built 16-byte string */
     zend_object std;
 } php_identifier_bit128_obj;
 
+typedef struct _php_identifier_bit128_vector_obj {
+    unsigned char *data;            /* count * 16 bytes, back to back */
+    size_t count;
+    size_t capacity;
+    zend_class_entry *element_ce;   /* class used to materialize elements */
+    zend_object std;
+} php_identifier_bit128_vector_obj;
+
+typedef struct _php_identifier_bit128_set_obj {
+    unsigned char *slots;           /* capacity * 16 bytes, followed by ctrl */
+    uint8_t *ctrl;                  /* capacity + group width control bytes */
+    size_t capacity;                /* power of two, 0 until first insert */
+    size_t size;
+    size_t growth_left;             /* inserts left before a rehash */
+    zend_object std;
+} php_identifier_bit128_set_obj;
+
+/* Outcome of the allocation-free parsers; the throwing callers map each to a message */
+typedef enum _php_identifier_parse_result {
+    PHP_IDENTIFIER_PARSE_OK = 0,
+    PHP_IDENTIFIER_PARSE_LENGTH,
+    PHP_IDENTIFIER_PARSE_FORMAT,
+    PHP_IDENTIFIER_PARSE_CHARACTER,
+    PHP_IDENTIFIER_PARSE_OVERFLOW
+} php_identifier_parse_result;
+
+/* Output of the generateBatch() methods (Bit128::BATCH_* constants) */
+typedef enum _php_identifier_batch_format {
+    PHP_IDENTIFIER_BATCH_OBJECTS = 0,
+    PHP_IDENTIFIER_BATCH_STRINGS,
+    PHP_IDENTIFIER_BATCH_BINARY
+} php_identifier_batch_format;
+
+/* Batches re-read the clock once per this many identifiers (power of two) */
+#define PHP_IDENTIFIER_BATCH_CLOCK_STRIDE 256
+
+/* Upper bound for the generateBatch() threads argument */
+#define PHP_IDENTIFIER_BATCH_MAX_THREADS 64
+
+/* Fills count identifiers at bytes (item start of the batch) from a worker
+ * thread; returns false if entropy could not be read */
+typedef bool (*php_identifier_batch_fill_fn)(unsigned char *bytes, size_t start, size_t count, const void *arg);
+
+/* Sort record: a 16-byte big-endian key and the position it came from */
+typedef struct _php_identifier_sort_record {
+    unsigned char key[16];
+    uint32_t index;
+} php_identifier_sort_record;
+
+/* Identifier kinds a Generator can produce */
+typedef enum _php_identifier_generator_type {
+    PHP_IDENTIFIER_GENERATOR_UUID1 = 0,
+    PHP_IDENTIFIER_GENERATOR_UUID4,
+    PHP_IDENTIFIER_GENERATOR_UUID6,
+    PHP_IDENTIFIER_GENERATOR_UUID7,
+    PHP_IDENTIFIER_GENERATOR_ULID
+} php_identifier_generator_type;
+
+typedef struct _php_identifier_generator_obj {
+    php_identifier_generator_type type;
+    zend_class_entry *element_ce;
+    bool monotonic;
+    zval context;                   /* IS_UNDEF for the system clock and CSPRNG */
+    zend_function *time_fn;         /* cached Context::getTimestampMs() */
+    zend_function *random_fn;       /* cached Context::getRandomBytes() */
+    php_identifier_ulid_state state;/* last timestamp and random tail */
+    uint64_t last_100ns;            /* last Gregorian timestamp (v1/v6) */
+    uint16_t clock_seq;             /* fixed per generator (v1/v6) */
+    unsigned char node[6];
+    unsigned char *entropy;         /* buffered CSPRNG output */
+    size_t entropy_size;
+    size_t entropy_pos;
+    zend_object std;
+} php_identifier_generator_obj;
+
+/* Clock sources of a Snowflake (Snowflake::CLOCK_* constants) */
+typedef enum _php_identifier_snowflake_clock {
+    PHP_IDENTIFIER_SNOWFLAKE_CLOCK_REALTIME = 0,
+    PHP_IDENTIFIER_SNOWFLAKE_CLOCK_MONOTONIC
+} php_identifier_snowflake_clock;
+
+typedef struct _php_identifier_snowflake_obj {
+    uint64_t epoch;                 /* Unix milliseconds */
+    uint64_t worker_id;
+    uint8_t timestamp_bits;
+    uint8_t worker_bits;
+    uint8_t sequence_bits;
+    php_identifier_snowflake_clock clock;
+    zval context;                   /* IS_UNDEF for the selected system clock */
+    zend_function *time_fn;         /* cached Context::getTimestampMs() */
+    php_identifier_snowflake_state state; /* used with a context */
+    zend_object std;
+} php_identifier_snowflake_obj;
+
+/* Hybrid logical clock: physical milliseconds and a logical counter */
+typedef struct _php_identifier_hybrid_clock_obj {
+    zend_class_entry *element_ce;   /* Version7 or Ulid */
+    uint64_t physical;              /* Unix milliseconds of the last identifier */
+    uint32_t logical;               /* counter within physical */
+    uint64_t max_drift;             /* largest accepted remote lead, 0 for none */
+    zval context;                   /* IS_UNDEF for the system clock and CSPRNG */
+    zend_function *time_fn;         /* cached Context::getTimestampMs() */
+    zend_function *random_fn;       /* cached Context::getRandomBytes() */
+    zend_object std;
+} php_identifier_hybrid_clock_obj;
+
+/* Longest SequenceAllocator name */
+#define PHP_IDENTIFIER_SEQUENCE_NAME_MAX 48
+
+typedef struct _php_identifier_sequence_slot php_identifier_sequence_slot;
+
+typedef struct _php_identifier_sequence_obj {
+    php_identifier_sequence_slot *slot; /* named counter in the shared segment */
+    zend_string *name;
+    uint64_t block_size;
+    uint64_t current;               /* next value of the leased block */
+    uint64_t end;                   /* first value past the leased block */
+    zend_long pid;                  /* process that leased the block */
+    zend_object std;
+} php_identifier_sequence_obj;
+
 typedef struct _php_identifier_context_system_obj {
     zend_object std;
 } php_identifier_context_system_obj;
@@ -69,6 +301,39 @@ typedef struct _php_identifier_context_fixed_obj {
 #define PHP_IDENTIFIER_BIT128_OBJ_P(zv) \
     ((php_identifier_bit128_obj*)((char*)(Z_OBJ_P(zv)) - XtOffsetOf(php_identifier_bit128_obj, std)))
 
+#define PHP_IDENTIFIER_BIT128_OBJ(obj) \
+    ((php_identifier_bit128_obj*)((char*)(obj) - XtOffsetOf(php_identifier_bit128_obj, std)))
+
+#define PHP_IDENTIFIER_BIT128_VECTOR_OBJ(obj) \
+    ((php_identifier_bit128_vector_obj*)((char*)(obj) - XtOffsetOf(php_identifier_bit128_vector_obj, std)))
+
+#define PHP_IDENTIFIER_BIT128_VECTOR_OBJ_P(zv) PHP_IDENTIFIER_BIT128_VECTOR_OBJ(Z_OBJ_P(zv))
+
+#define PHP_IDENTIFIER_BIT128_SET_OBJ(obj) \
+    ((php_identifier_bit128_set_obj*)((char*)(obj) - XtOffsetOf(php_identifier_bit128_set_obj, std)))
+
+#define PHP_IDENTIFIER_BIT128_SET_OBJ_P(zv) PHP_IDENTIFIER_BIT128_SET_OBJ(Z_OBJ_P(zv))
+
+#define PHP_IDENTIFIER_GENERATOR_OBJ(obj) \
+    ((php_identifier_generator_obj*)((char*)(obj) - XtOffsetOf(php_identifier_generator_obj, std)))
+
+#define PHP_IDENTIFIER_GENERATOR_OBJ_P(zv) PHP_IDENTIFIER_GENERATOR_OBJ(Z_OBJ_P(zv))
+
+#define PHP_IDENTIFIER_SNOWFLAKE_OBJ(obj) \
+    ((php_identifier_snowflake_obj*)((char*)(obj) - XtOffsetOf(php_identifier_snowflake_obj, std)))
+
+#define PHP_IDENTIFIER_SNOWFLAKE_OBJ_P(zv) PHP_IDENTIFIER_SNOWFLAKE_OBJ(Z_OBJ_P(zv))
+
+#define PHP_IDENTIFIER_HYBRID_CLOCK_OBJ(obj) \
+    ((php_identifier_hybrid_clock_obj*)((char*)(obj) - XtOffsetOf(php_identifier_hybrid_clock_obj, std)))
+
+#define PHP_IDENTIFIER_HYBRID_CLOCK_OBJ_P(zv) PHP_IDENTIFIER_HYBRID_CLOCK_OBJ(Z_OBJ_P(zv))
+
+#define PHP_IDENTIFIER_SEQUENCE_OBJ(obj) \
+    ((php_identifier_sequence_obj*)((char*)(obj) - XtOffsetOf(php_identifier_sequence_obj, std)))
+
+#define PHP_IDENTIFIER_SEQUENCE_OBJ_P(zv) PHP_IDENTIFIER_SEQUENCE_OBJ(Z_OBJ_P(zv))
+
 #define PHP_IDENTIFIER_CONTEXT_SYSTEM_OBJ_P(zv) \
     ((php_identifier_context_system_obj*)((char*)(Z_OBJ_P(zv)) - XtOffsetOf(php_identifier_context_system_obj, std)))
 
@@ -78,6 +343,7 @@ typedef struct _php_identifier_context_fixed_obj {
 /* Function declarations */
 PHP_MINIT_FUNCTION(identifier);
 PHP_MSHUTDOWN_FUNCTION(identifier);
+PHP_RSHUTDOWN_FUNCTION(identifier);
 PHP_MINFO_FUNCTION(identifier);
 
 /* Context functions */
@@ -85,17 +351,137 @@ void php_identifier_context_register_classes(void);
 
 /* Bit128 functions */
 void php_identifier_bit128_register_class(void);
+zend_string *php_identifier_bit128_to_string(zend_object *object);
+zend_string *php_identifier_bit128_format(php_identifier_bit128_obj *intern, php_identifier_format format);
+zend_string *php_identifier_bit128_bytes(php_identifier_bit128_obj *intern);
+void php_identifier_bit128_reset_cache(php_identifier_bit128_obj *intern);
+/* Store the 16 bytes of a new identifier. Identifiers are values, so this
+ * also marks it initialized: __construct() and __unserialize() reject it */
+static zend_always_inline void php_identifier_bit128_fill(php_identifier_bit128_obj *intern, const void *bytes)
+{
+    memcpy(intern->data, bytes, 16);
+    intern->initialized = true;
+}
+void php_identifier_sort_key(zend_object *object, bool by_time, unsigned char *key);
+void php_identifier_radix_sort(void *base, size_t count, size_t size);
+void php_identifier_reverse_records(void *base, size_t count, size_t size);
+zend_long php_identifier_bsearch(const unsigned char *records, size_t count, const unsigned char *needle);
+
+/* Parsing helpers: never allocate or throw */
+extern const int8_t php_identifier_hex_values[256];
+php_identifier_parse_result php_identifier_parse_hex(const char *str, size_t len, unsigned char *bytes);
+php_identifier_parse_result php_identifier_parse_hex_dashed(const char *str, size_t len, unsigned char *bytes);
+php_identifier_parse_result php_identifier_parse_uuid(const char *str, size_t len, unsigned char *bytes);
+php_identifier_parse_result php_identifier_parse_ulid(const char *str, size_t len, unsigned char *bytes);
+bool php_identifier_parse_hex_string(const zend_string *str, const char *kind, unsigned char *bytes);
+
+/* Formatting helpers (output buffers need room for a trailing NUL) */
+void php_identifier_format_hex(const unsigned char *bytes, char *output);  /* 32 chars */
+void php_identifier_format_uuid(const unsigned char *bytes, char *output); /* 36 chars */
+void php_identifier_format_ulid(const unsigned char *bytes, char *output); /* 26 chars */
+
+/* Batch generation helpers */
+zend_string *php_identifier_batch_alloc(zend_long count, zend_long format);
+void php_identifier_batch_return(zval *return_value, zend_string *packed, zend_class_entry *ce, zend_long format, php_identifier_format string_format);
+uint32_t php_identifier_batch_threads(zend_long requested, size_t count);
+bool php_identifier_batch_random(unsigned char *buffer, size_t length);
+zend_result php_identifier_batch_parallel(unsigned char *bytes, size_t count, uint32_t threads,
+    php_identifier_batch_fill_fn fill, const void *arg);
+
+/* Bit128Vector functions */
+void php_identifier_bit128_vector_register_class(void);
+void php_identifier_bit128_vector_push(php_identifier_bit128_vector_obj *intern, const unsigned char *bytes);
+void php_identifier_bit128_vector_materialize(php_identifier_bit128_vector_obj *intern, size_t index, zval *out);
+
+/* Bit128Set functions */
+void php_identifier_bit128_set_register_class(void);
+void php_identifier_bit128_set_reserve(php_identifier_bit128_set_obj *set, size_t count);
+int php_identifier_bit128_set_insert(php_identifier_bit128_set_obj *set, const unsigned char *key);
+int php_identifier_bit128_set_contains(const php_identifier_bit128_set_obj *set, const unsigned char *key);
 
 /* UUID functions */
 void php_identifier_uuid_register_classes(void);
+void php_identifier_uuid_v4_fill(unsigned char *bytes);
+void php_identifier_uuid_v1_layout(unsigned char *bytes, uint64_t timestamp_100ns, uint16_t clock_seq, const unsigned char *node);
+void php_identifier_uuid_v6_layout(unsigned char *bytes, uint64_t timestamp_100ns, uint16_t clock_seq, const unsigned char *node);
+void php_identifier_uuid_v7_fill(unsigned char *bytes, uint64_t timestamp_ms);
+zend_class_entry *php_identifier_uuid_class_for_version(int version);
+extern const unsigned char php_identifier_uuid_namespaces[PHP_IDENTIFIER_UUID_NAMESPACE_COUNT][16];
+int php_identifier_uuid_namespace_index(const unsigned char *bytes);
+void php_identifier_uuid_release_well_known(void);
+bool php_identifier_uuid_parse_string(const zend_string *str, unsigned char *bytes);
 
 /* ULID functions */
 void php_identifier_ulid_register_class(void);
+bool php_identifier_ulid_parse_string(const zend_string *str, unsigned char *bytes);
+/* Whether timestamp continues state: the same millisecond, or one still
+ * behind a logical millisecond the overflow policy moved ahead. A clock that
+ * goes back in time, such as a Context, starts over at its own timestamp. */
+static zend_always_inline bool php_identifier_ulid_state_continues(const php_identifier_ulid_state *state, uint64_t timestamp)
+{
+    return state->initialized && timestamp <= state->last_timestamp && timestamp >= state->last_clock;
+}
+
+zend_result php_identifier_ulid_next(php_identifier_ulid_state *state, uint64_t timestamp, zval *context, unsigned char *bytes);
+int php_identifier_ulid_increment(unsigned char *randomness);
+void php_identifier_ulid_throw_overflow(void);
+zend_result php_identifier_ulid_overflow(uint64_t *timestamp);
+void php_identifier_ulid_overflow_stats(zval *stats);
+
+zend_result php_identifier_ulid_generate(uint64_t timestamp, zval *context, unsigned char *bytes);
+
+/* Monotonic state functions */
+void php_identifier_monotonic_startup(const char *scope);
+void php_identifier_monotonic_shutdown(void);
+php_identifier_monotonic_scope php_identifier_monotonic_scope_get(void);
+zend_result php_identifier_ulid_reserve(uint64_t timestamp, uint64_t count, unsigned char *bytes);
+void php_identifier_monotonic_stats(zval *stats);
+
+/* Worker partition functions */
+void php_identifier_worker_startup(zend_long bits, const char *id);
+uint32_t php_identifier_worker_bits(void);
+uint32_t php_identifier_worker_id(void);
+void php_identifier_worker_stamp_ulid(unsigned char *randomness);
+void php_identifier_worker_stamp_v7(unsigned char *bytes);
+uint32_t php_identifier_worker_ulid_max(void);
+uint32_t php_identifier_worker_v7_max(void);
 
 /* Utility functions */
 void php_identifier_generate_random_bytes(unsigned char *buffer, size_t length);
-uint64_t php_identifier_get_timestamp_ms(void);
-uint64_t php_identifier_get_gregorian_epoch_time(void);
+zend_long php_identifier_current_pid(void);
+uint64_t php_identifier_read_clock_ms(void);
+zend_result php_identifier_get_timestamp_ms(uint64_t *timestamp_ms);
+zend_result php_identifier_get_gregorian_epoch_time(uint64_t *timestamp_100ns);
+void php_identifier_clock_regression_stats(zval *stats);
+
+/* Generator functions */
+void php_identifier_generator_register_class(void);
+
+/* Snowflake functions */
+void php_identifier_snowflake_register_class(void);
+
+/* HybridClock functions */
+void php_identifier_hybrid_clock_register_class(void);
+
+/* SequenceAllocator functions */
+void php_identifier_sequence_register_class(void);
+void php_identifier_sequence_startup(const char *path);
+void php_identifier_sequence_shutdown(void);
+
+/* Persisted generator state (identifier.state_file) */
+void php_identifier_state_startup(const char *path, zend_long interval);
+void php_identifier_state_shutdown(void);
+uint64_t php_identifier_state_guard(uint64_t timestamp_ms);
+bool php_identifier_state_clock_seq(uint16_t *clock_seq);
+
+/* Reservoir functions */
+void php_identifier_reservoir_register_class(void);
+size_t php_identifier_reservoir_fill(size_t count);
+bool php_identifier_reservoir_take(unsigned char *buffer, size_t length);
+void php_identifier_reservoir_release(void);
+
+/* Procedural functions */
+extern const zend_function_entry php_identifier_functions[];
 
 /* Codec initialization */
 void php_identifier_codec_init(void);
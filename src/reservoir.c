@@ -0,0 +1,269 @@
+#include "php.h"
+#include "zend_exceptions.h"
+#include "php_identifier.h"
+#include <string.h>
+
+/* Include random headers - compatibility across PHP versions */
+#if PHP_VERSION_ID >= 80200
+#include "ext/random/php_random.h"
+#else
+#include "ext/standard/php_random.h"
+#endif
+
+/* Arginfo declarations */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_reservoir_construct, 0, 0, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_reservoir_fill, 0, 1, IS_LONG, 0)
+    ZEND_ARG_TYPE_INFO(0, count, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_reservoir_available, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_reservoir_clear, 0, 0, IS_VOID, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_reservoir_stats, 0, 0, IS_ARRAY, 0)
+ZEND_END_ARG_INFO()
+
+/* Drop the reservoir contents, leaving the counters alone */
+static void php_identifier_reservoir_discard(php_identifier_reservoir *reservoir)
+{
+    if (reservoir->bytes) {
+        ZEND_SECURE_ZERO(reservoir->bytes, reservoir->capacity);
+        efree(reservoir->bytes);
+    }
+    reservoir->bytes = NULL;
+    reservoir->capacity = 0;
+    reservoir->available = 0;
+}
+
+/* Top the reservoir up by count identifiers' worth of CSPRNG output, capped
+ * at PHP_IDENTIFIER_RESERVOIR_MAX. Returns the number of identifiers held,
+ * or 0 with an exception if the CSPRNG failed. */
+size_t php_identifier_reservoir_fill(size_t count)
+{
+    php_identifier_reservoir *reservoir = &IDENTIFIER_G(reservoir);
+    zend_long pid = php_identifier_current_pid();
+    size_t target;
+
+    /* Entries filled before a fork belong to the parent */
+    if (reservoir->pid != pid) {
+        php_identifier_reservoir_discard(reservoir);
+        reservoir->pid = pid;
+    }
+
+    target = reservoir->available + MIN(count, (size_t)PHP_IDENTIFIER_RESERVOIR_MAX) * 16;
+    if (target > (size_t)PHP_IDENTIFIER_RESERVOIR_MAX * 16) {
+        target = (size_t)PHP_IDENTIFIER_RESERVOIR_MAX * 16;
+    }
+
+    if (target > reservoir->capacity) {
+        unsigned char *bytes = emalloc(target);
+
+        if (reservoir->available) {
+            memcpy(bytes, reservoir->bytes, reservoir->available);
+        }
+        if (reservoir->bytes) {
+            ZEND_SECURE_ZERO(reservoir->bytes, reservoir->capacity);
+            efree(reservoir->bytes);
+        }
+        reservoir->bytes = bytes;
+        reservoir->capacity = target;
+    }
+
+    if (target > reservoir->available) {
+        if (php_random_bytes(reservoir->bytes + reservoir->available, target - reservoir->available, 1) == FAILURE) {
+            return 0;
+        }
+        reservoir->available = target;
+    }
+
+    return reservoir->available / 16;
+}
+
+/* Pop length bytes off the reservoir. Returns false, counting a miss, if it
+ * is enabled but too empty or was filled by another process. */
+bool php_identifier_reservoir_take(unsigned char *buffer, size_t length)
+{
+    php_identifier_reservoir *reservoir = &IDENTIFIER_G(reservoir);
+
+    if (EXPECTED(reservoir->capacity == 0)) {
+        return false;
+    }
+
+    if (UNEXPECTED(reservoir->pid != php_identifier_current_pid())) {
+        php_identifier_reservoir_discard(reservoir);
+        reservoir->misses++;
+        return false;
+    }
+
+    if (reservoir->available < length) {
+        reservoir->misses++;
+        return false;
+    }
+
+    reservoir->available -= length;
+    memcpy(buffer, reservoir->bytes + reservoir->available, length);
+    /* Scrub the slot so popped entropy cannot be served twice */
+    ZEND_SECURE_ZERO(reservoir->bytes + reservoir->available, length);
+    reservoir->hits++;
+
+    return true;
+}
+
+/* Free the reservoir and reset its counters at request shutdown */
+void php_identifier_reservoir_release(void)
+{
+    php_identifier_reservoir *reservoir = &IDENTIFIER_G(reservoir);
+
+    php_identifier_reservoir_discard(reservoir);
+    reservoir->hits = 0;
+    reservoir->misses = 0;
+}
+
+/* Reservoir methods */
+
+/**
+ * Reservoir is a static facade and cannot be instantiated
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Reservoir, __construct)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+}
+
+/**
+ * Prefill the reservoir with entropy for count identifiers
+ *
+ * Identifier generation draws its random bytes from the reservoir while it
+ * holds enough, so the work and the getrandom() syscall move out of the
+ * latency-critical section. Entries are tied to the filling process: a
+ * forked worker discards what it inherited instead of reusing it. The
+ * reservoir is emptied at the end of every request; the
+ * identifier.reservoir setting refills it when a request starts.
+ *
+ * @param int $count Identifiers' worth of entropy to add (0-65536)
+ * @return int Identifiers' worth of entropy now held
+ * @throws Exception If count is out of range
+ *
+ * @example
+ * Reservoir::fill(1000);
+ * // ... latency-sensitive work ...
+ * $id = Version4::generate(); // served from the reservoir
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Reservoir, fill)
+{
+    zend_long count;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_LONG(count)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (count < 0 || count > PHP_IDENTIFIER_RESERVOIR_MAX) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Reservoir count must be between 0 and %d", PHP_IDENTIFIER_RESERVOIR_MAX);
+        RETURN_THROWS();
+    }
+
+    size_t available = php_identifier_reservoir_fill((size_t)count);
+    if (EG(exception)) {
+        RETURN_THROWS();
+    }
+
+    RETURN_LONG((zend_long)available);
+}
+
+/**
+ * Get the number of identifiers the reservoir can still serve
+ *
+ * @return int Identifiers' worth of entropy held by this process
+ *
+ * @example
+ * if (Reservoir::available() < 100) {
+ *     Reservoir::fill(1000);
+ * }
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Reservoir, available)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_reservoir *reservoir = &IDENTIFIER_G(reservoir);
+
+    if (reservoir->pid != php_identifier_current_pid()) {
+        RETURN_LONG(0);
+    }
+
+    RETURN_LONG((zend_long)(reservoir->available / 16));
+}
+
+/**
+ * Empty the reservoir and zero its contents
+ *
+ * Generation falls back to the CSPRNG on every call until the next fill().
+ * The hit and miss counters are kept.
+ *
+ * @example
+ * Reservoir::clear();
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Reservoir, clear)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_reservoir_discard(&IDENTIFIER_G(reservoir));
+}
+
+/**
+ * Get reservoir statistics for the current request
+ *
+ * Hits count random reads served from the reservoir; misses count reads
+ * that fell back to the CSPRNG while the reservoir was enabled.
+ *
+ * @return array{capacity: int, available: int, hits: int, misses: int}
+ *
+ * @example
+ * $stats = Reservoir::stats();
+ * printf("%d hits, %d misses\n", $stats['hits'], $stats['misses']);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Reservoir, stats)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_reservoir *reservoir = &IDENTIFIER_G(reservoir);
+    bool owned = reservoir->pid == php_identifier_current_pid();
+
+    array_init_size(return_value, 4);
+    add_assoc_long(return_value, "capacity", owned ? (zend_long)(reservoir->capacity / 16) : 0);
+    add_assoc_long(return_value, "available", owned ? (zend_long)(reservoir->available / 16) : 0);
+    add_assoc_long(return_value, "hits", reservoir->hits);
+    add_assoc_long(return_value, "misses", reservoir->misses);
+}
+
+/* Reservoir method entries */
+static const zend_function_entry php_identifier_reservoir_methods[] = {
+    PHP_ME(Identifier_Reservoir, __construct, arginfo_reservoir_construct, ZEND_ACC_PRIVATE)
+    PHP_ME(Identifier_Reservoir, fill, arginfo_reservoir_fill, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Reservoir, available, arginfo_reservoir_available, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Reservoir, clear, arginfo_reservoir_clear, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Reservoir, stats, arginfo_reservoir_stats, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_FE_END
+};
+
+/* Register Reservoir class */
+void php_identifier_reservoir_register_class(void)
+{
+    zend_class_entry ce;
+
+    INIT_NS_CLASS_ENTRY(ce, "Identifier", "Reservoir", php_identifier_reservoir_methods);
+    php_identifier_reservoir_ce = zend_register_internal_class(&ce);
+    php_identifier_reservoir_ce->ce_flags |= ZEND_ACC_FINAL | ZEND_ACC_NOT_SERIALIZABLE;
+}
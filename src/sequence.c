@@ -0,0 +1,469 @@
+#include "php.h"
+#include "zend_exceptions.h"
+#include "ext/spl/spl_exceptions.h"
+#include "php_identifier.h"
+#include <string.h>
+#include <fcntl.h>
+
+#ifndef PHP_WIN32
+# include <errno.h>
+# include <signal.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#  define MAP_ANONYMOUS MAP_ANON
+# endif
+#endif
+
+/* Leasing needs the GCC/Clang atomic builtins and a shared mapping */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(PHP_WIN32) && defined(MAP_ANONYMOUS)
+# define PHP_IDENTIFIER_SEQUENCE_SHARED 1
+#endif
+
+/* Arginfo declarations */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_sequence_construct, 0, 0, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, name, IS_STRING, 0, "\"default\"")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, blockSize, IS_LONG, 0, "1000")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_sequence_next, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_sequence_remaining, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_sequence_getName, 0, 0, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_sequence_getBlockSize, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+/* SequenceAllocator object handlers */
+static zend_object_handlers php_identifier_sequence_handlers;
+
+#define PHP_IDENTIFIER_SEQUENCE_MAGIC UINT64_C(0x3151534449504850) /* "PHPIDSQ1" */
+#define PHP_IDENTIFIER_SEQUENCE_SLOTS 64
+#define PHP_IDENTIFIER_SEQUENCE_BLOCK_MAX (1 << 24)
+
+/* Slot states: claimed slots are never released, so a name always
+ * resolves to the first slot on its probe path that holds it. A claiming
+ * slot carries the claimer's pid above the two state bits. */
+#define PHP_IDENTIFIER_SEQUENCE_EMPTY 0
+#define PHP_IDENTIFIER_SEQUENCE_CLAIMING 1
+#define PHP_IDENTIFIER_SEQUENCE_READY 2
+#define PHP_IDENTIFIER_SEQUENCE_STATE_MASK 3
+
+/* Probes of a claiming slot before checking on its claimer, and how long a
+ * live claimer may hold it before the lookup gives up */
+#define PHP_IDENTIFIER_SEQUENCE_SPIN_LIMIT 4096
+#define PHP_IDENTIFIER_SEQUENCE_CLAIM_TIMEOUT_MS 1000
+
+/* One cache line per named counter */
+struct _php_identifier_sequence_slot {
+    uint64_t next;                  /* first value not yet leased */
+    uint32_t state;
+    uint32_t length;
+    char name[PHP_IDENTIFIER_SEQUENCE_NAME_MAX];
+};
+
+typedef struct _php_identifier_sequence_segment {
+    uint64_t magic;
+    uint64_t reserved[7];
+    php_identifier_sequence_slot slots[PHP_IDENTIFIER_SEQUENCE_SLOTS];
+} php_identifier_sequence_segment;
+
+static php_identifier_sequence_segment *php_identifier_sequence_segment_ptr = NULL;
+
+/* Map the counter segment in MINIT, before a process manager forks its
+ * workers. With identifier.sequence_file the mapping is backed by that file,
+ * so counters carry over to the next start; writes reach the file through
+ * the page cache, without fsync. */
+void php_identifier_sequence_startup(const char *path)
+{
+#ifdef PHP_IDENTIFIER_SEQUENCE_SHARED
+    size_t size = sizeof(php_identifier_sequence_segment);
+    void *mapped;
+
+    if (path && *path) {
+        struct stat st;
+        int fd = open(path, O_RDWR | O_CREAT, 0600);
+
+        if (fd < 0 || fstat(fd, &st) != 0 || ((size_t)st.st_size < size && ftruncate(fd, (off_t)size) != 0)) {
+            php_error_docref(NULL, E_WARNING, "Failed to open identifier.sequence_file \"%s\", sequences will not persist", path);
+            if (fd >= 0) {
+                close(fd);
+            }
+        } else {
+            mapped = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+
+            if (mapped == MAP_FAILED) {
+                php_error_docref(NULL, E_WARNING, "Failed to map identifier.sequence_file \"%s\", sequences will not persist", path);
+            } else if (st.st_size > 0 && ((php_identifier_sequence_segment *)mapped)->magic != PHP_IDENTIFIER_SEQUENCE_MAGIC) {
+                php_error_docref(NULL, E_WARNING, "identifier.sequence_file \"%s\" is not a sequence file, sequences will not persist", path);
+                munmap(mapped, size);
+            } else {
+                php_identifier_sequence_segment *segment = mapped;
+
+                /* A process that died while claiming a name left its slot half written */
+                for (int i = 0; i < PHP_IDENTIFIER_SEQUENCE_SLOTS; i++) {
+                    if ((segment->slots[i].state & PHP_IDENTIFIER_SEQUENCE_STATE_MASK) == PHP_IDENTIFIER_SEQUENCE_CLAIMING) {
+                        segment->slots[i].state = PHP_IDENTIFIER_SEQUENCE_EMPTY;
+                    }
+                }
+                segment->magic = PHP_IDENTIFIER_SEQUENCE_MAGIC;
+                php_identifier_sequence_segment_ptr = segment;
+                return;
+            }
+        }
+    }
+
+    mapped = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) {
+        php_error_docref(NULL, E_WARNING, "Failed to map shared sequence state, SequenceAllocator is unavailable");
+        return;
+    }
+
+    memset(mapped, 0, size);
+    php_identifier_sequence_segment_ptr = mapped;
+    php_identifier_sequence_segment_ptr->magic = PHP_IDENTIFIER_SEQUENCE_MAGIC;
+#else
+    (void)path;
+#endif
+}
+
+/* Unmap the counter segment at module shutdown */
+void php_identifier_sequence_shutdown(void)
+{
+#ifdef PHP_IDENTIFIER_SEQUENCE_SHARED
+    if (php_identifier_sequence_segment_ptr) {
+        munmap(php_identifier_sequence_segment_ptr, sizeof(php_identifier_sequence_segment));
+    }
+#endif
+    php_identifier_sequence_segment_ptr = NULL;
+}
+
+#ifdef PHP_IDENTIFIER_SEQUENCE_SHARED
+/* Whether the process that moved a slot to claiming state is gone. Slots
+ * of the anonymous mapping are never cleaned up at startup, so a claimer
+ * that died mid-claim would otherwise block its slot for good. */
+static bool php_identifier_sequence_claimer_dead(uint32_t state)
+{
+    pid_t pid = (pid_t)(state >> 2);
+
+    /* 0: claimed by a build that did not record its pid */
+    return pid == 0 || (kill(pid, 0) != 0 && errno == ESRCH);
+}
+
+/* Move slot from state to claiming and write name into it */
+static bool php_identifier_sequence_slot_claim(php_identifier_sequence_slot *slot, uint32_t *state, const zend_string *name)
+{
+    uint32_t claiming = PHP_IDENTIFIER_SEQUENCE_CLAIMING | ((uint32_t)php_identifier_current_pid() << 2);
+
+    if (!__atomic_compare_exchange_n(&slot->state, state, claiming,
+            false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+
+    memcpy(slot->name, ZSTR_VAL(name), ZSTR_LEN(name));
+    slot->length = (uint32_t)ZSTR_LEN(name);
+    __atomic_store_n(&slot->next, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->state, PHP_IDENTIFIER_SEQUENCE_READY, __ATOMIC_RELEASE);
+    return true;
+}
+
+/* Find the slot of name, claiming one on first use. Every process probes
+ * the same path, so two processes racing for a new name meet at the same
+ * empty slot and only one claims it. Returns NULL with an exception set if
+ * the table is full or a live process holds a slot past the timeout. */
+static php_identifier_sequence_slot *php_identifier_sequence_slot_find(const zend_string *name)
+{
+    uint32_t start = (uint32_t)zend_string_hash_val((zend_string *)name) % PHP_IDENTIFIER_SEQUENCE_SLOTS;
+
+    for (uint32_t i = 0; i < PHP_IDENTIFIER_SEQUENCE_SLOTS; i++) {
+        php_identifier_sequence_slot *slot = &php_identifier_sequence_segment_ptr->slots[(start + i) % PHP_IDENTIFIER_SEQUENCE_SLOTS];
+        uint32_t state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE);
+        uint32_t spins = 0;
+        uint32_t waited_ms = 0;
+
+        for (;;) {
+            if (state == PHP_IDENTIFIER_SEQUENCE_EMPTY) {
+                if (php_identifier_sequence_slot_claim(slot, &state, name)) {
+                    return slot;
+                }
+                continue;
+            }
+
+            if ((state & PHP_IDENTIFIER_SEQUENCE_STATE_MASK) != PHP_IDENTIFIER_SEQUENCE_CLAIMING) {
+                break;
+            }
+
+            /* Another process is writing the name: it is ready within a few stores */
+            if (++spins < PHP_IDENTIFIER_SEQUENCE_SPIN_LIMIT) {
+                state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE);
+                continue;
+            }
+            spins = 0;
+
+            /* Unless it died before publishing: take the slot over */
+            if (php_identifier_sequence_claimer_dead(state)) {
+                if (php_identifier_sequence_slot_claim(slot, &state, name)) {
+                    return slot;
+                }
+                continue;
+            }
+
+            if (waited_ms++ >= PHP_IDENTIFIER_SEQUENCE_CLAIM_TIMEOUT_MS) {
+                zend_throw_exception(zend_ce_exception, "Timed out waiting for another process to claim a sequence slot", 0);
+                return NULL;
+            }
+            usleep(1000);
+            state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE);
+        }
+
+        if (slot->length == ZSTR_LEN(name) && memcmp(slot->name, ZSTR_VAL(name), ZSTR_LEN(name)) == 0) {
+            return slot;
+        }
+    }
+
+    zend_throw_exception_ex(zend_ce_exception, 0, "Sequence table is full (%d names)", PHP_IDENTIFIER_SEQUENCE_SLOTS);
+    return NULL;
+}
+#endif
+
+/* SequenceAllocator methods */
+
+/**
+ * Create an allocator for a named host-wide sequence
+ *
+ * The sequence counter lives in shared memory mapped at startup, so every
+ * worker forked from the same master draws from it. Values are leased in
+ * blocks of blockSize with one atomic fetch-add, then handed out by next()
+ * from the local block without touching shared memory (the hi/lo pattern).
+ * Values are unique and ascending per allocator; across allocators they
+ * interleave by block, and values left in a block when its allocator is
+ * destroyed are skipped. With identifier.sequence_file the counters
+ * survive restarts.
+ *
+ * @param string $name Sequence name (1-48 bytes); up to 64 names per host
+ * @param int $blockSize Values leased at a time (1-16777216)
+ * @throws Exception If an argument is out of range, the sequence table is full, a slot stays claimed by another process, or shared memory is unavailable
+ *
+ * @example
+ * $orders = new SequenceAllocator("orders", blockSize: 500);
+ * $id = $orders->next(); // e.g., 1501
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_SequenceAllocator, __construct)
+{
+    zend_string *name = NULL;
+    zend_long block_size = 1000;
+
+    ZEND_PARSE_PARAMETERS_START(0, 2)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_STR(name)
+        Z_PARAM_LONG(block_size)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_sequence_obj *seq = PHP_IDENTIFIER_SEQUENCE_OBJ_P(getThis());
+
+    if (name && (ZSTR_LEN(name) == 0 || ZSTR_LEN(name) > PHP_IDENTIFIER_SEQUENCE_NAME_MAX)) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Sequence name must be 1 to %d bytes", PHP_IDENTIFIER_SEQUENCE_NAME_MAX);
+        RETURN_THROWS();
+    }
+
+    if (block_size < 1 || block_size > PHP_IDENTIFIER_SEQUENCE_BLOCK_MAX) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Sequence block size must be between 1 and %d", PHP_IDENTIFIER_SEQUENCE_BLOCK_MAX);
+        RETURN_THROWS();
+    }
+
+#ifdef PHP_IDENTIFIER_SEQUENCE_SHARED
+    if (!php_identifier_sequence_segment_ptr) {
+        zend_throw_exception(zend_ce_exception, "Shared sequence state is unavailable", 0);
+        RETURN_THROWS();
+    }
+
+    if (seq->name) {
+        zend_string_release(seq->name);
+    }
+    seq->name = name ? zend_string_copy(name) : zend_string_init("default", sizeof("default") - 1, 0);
+
+    seq->slot = php_identifier_sequence_slot_find(seq->name);
+    if (!seq->slot) {
+        RETURN_THROWS();
+    }
+
+    seq->block_size = (uint64_t)block_size;
+    seq->current = 0;
+    seq->end = 0;
+#else
+    zend_throw_exception(zend_ce_exception, "SequenceAllocator is not supported on this platform", 0);
+    RETURN_THROWS();
+#endif
+}
+
+/**
+ * Get the next value of the sequence
+ *
+ * Leases a new block from the shared counter when the local one is used
+ * up, or when the allocator was inherited by a forked child, which must
+ * not hand out its parent's block.
+ *
+ * @return int Next value, starting at 1
+ * @throws OutOfBoundsException If the sequence has reached PHP_INT_MAX
+ *
+ * @example
+ * $sequence = new SequenceAllocator("invoices");
+ * $number = $sequence->next();
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_SequenceAllocator, next)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_sequence_obj *seq = PHP_IDENTIFIER_SEQUENCE_OBJ_P(getThis());
+
+    if (UNEXPECTED(!seq->slot)) {
+        zend_throw_exception(zend_ce_exception, "SequenceAllocator is not initialized", 0);
+        RETURN_THROWS();
+    }
+
+#ifdef PHP_IDENTIFIER_SEQUENCE_SHARED
+    if (UNEXPECTED(seq->current == seq->end || seq->pid != php_identifier_current_pid())) {
+        uint64_t start = __atomic_fetch_add(&seq->slot->next, seq->block_size, __ATOMIC_RELAXED);
+
+        if (start > (uint64_t)ZEND_LONG_MAX - seq->block_size) {
+            zend_throw_exception(spl_ce_OutOfBoundsException, "Sequence exhausted", 0);
+            RETURN_THROWS();
+        }
+
+        seq->current = start;
+        seq->end = start + seq->block_size;
+        seq->pid = php_identifier_current_pid();
+    }
+
+#endif
+
+    RETURN_LONG((zend_long)seq->current++);
+}
+
+/**
+ * Get the number of values left in the leased block
+ *
+ * @return int Values next() returns before it leases another block
+ *
+ * @example
+ * $sequence = new SequenceAllocator("orders", blockSize: 100);
+ * $sequence->next();
+ * echo $sequence->remaining(); // 99
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_SequenceAllocator, remaining)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_sequence_obj *seq = PHP_IDENTIFIER_SEQUENCE_OBJ_P(getThis());
+
+    RETURN_LONG(seq->pid == php_identifier_current_pid() ? (zend_long)(seq->end - seq->current) : 0);
+}
+
+/**
+ * Get the sequence name
+ *
+ * @return string Name passed to the constructor
+ *
+ * @example
+ * echo (new SequenceAllocator("orders"))->getName(); // "orders"
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_SequenceAllocator, getName)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_sequence_obj *seq = PHP_IDENTIFIER_SEQUENCE_OBJ_P(getThis());
+
+    if (!seq->name) {
+        RETURN_STRINGL("default", sizeof("default") - 1);
+    }
+    RETURN_STR_COPY(seq->name);
+}
+
+/**
+ * Get the number of values leased at a time
+ *
+ * @return int Block size
+ *
+ * @example
+ * echo (new SequenceAllocator("orders", blockSize: 500))->getBlockSize(); // 500
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_SequenceAllocator, getBlockSize)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    RETURN_LONG((zend_long)PHP_IDENTIFIER_SEQUENCE_OBJ_P(getThis())->block_size);
+}
+
+/* SequenceAllocator method entries */
+static const zend_function_entry php_identifier_sequence_methods[] = {
+    PHP_ME(Identifier_SequenceAllocator, __construct, arginfo_sequence_construct, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_SequenceAllocator, next, arginfo_sequence_next, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_SequenceAllocator, remaining, arginfo_sequence_remaining, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_SequenceAllocator, getName, arginfo_sequence_getName, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_SequenceAllocator, getBlockSize, arginfo_sequence_getBlockSize, ZEND_ACC_PUBLIC)
+    PHP_FE_END
+};
+
+/* SequenceAllocator object creation */
+static zend_object *php_identifier_sequence_create_object(zend_class_entry *ce)
+{
+    php_identifier_sequence_obj *intern = zend_object_alloc(sizeof(php_identifier_sequence_obj), ce);
+
+    zend_object_std_init(&intern->std, ce);
+    object_properties_init(&intern->std, ce);
+
+    intern->slot = NULL;
+    intern->name = NULL;
+    intern->block_size = 0;
+    intern->current = 0;
+    intern->end = 0;
+    intern->pid = 0;
+
+    intern->std.handlers = &php_identifier_sequence_handlers;
+    return &intern->std;
+}
+
+/* Free SequenceAllocator object; the rest of its block is skipped */
+static void php_identifier_sequence_free_object(zend_object *object)
+{
+    php_identifier_sequence_obj *intern = PHP_IDENTIFIER_SEQUENCE_OBJ(object);
+
+    if (intern->name) {
+        zend_string_release(intern->name);
+    }
+
+    zend_object_std_dtor(&intern->std);
+}
+
+/* Register SequenceAllocator class */
+void php_identifier_sequence_register_class(void)
+{
+    zend_class_entry ce;
+
+    INIT_NS_CLASS_ENTRY(ce, "Identifier", "SequenceAllocator", php_identifier_sequence_methods);
+    php_identifier_sequence_allocator_ce = zend_register_internal_class(&ce);
+    php_identifier_sequence_allocator_ce->ce_flags |= ZEND_ACC_FINAL | ZEND_ACC_NOT_SERIALIZABLE;
+    php_identifier_sequence_allocator_ce->create_object = php_identifier_sequence_create_object;
+
+    /* A clone would hand out the same leased block twice */
+    memcpy(&php_identifier_sequence_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+    php_identifier_sequence_handlers.offset = XtOffsetOf(php_identifier_sequence_obj, std);
+    php_identifier_sequence_handlers.free_obj = php_identifier_sequence_free_object;
+    php_identifier_sequence_handlers.clone_obj = NULL;
+}
@@ -0,0 +1,502 @@
+#include "php.h"
+#include "zend_exceptions.h"
+#include "zend_interfaces.h"
+#include "php_identifier.h"
+#include <string.h>
+#include <time.h>
+
+/* Arginfo declarations */
+ZEND_BEGIN_ARG_INFO_EX(arginfo_snowflake_construct, 0, 0, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, workerId, IS_LONG, 0, "0")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, epoch, IS_LONG, 0, "Identifier\\Snowflake::DEFAULT_EPOCH")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, timestampBits, IS_LONG, 0, "41")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, workerBits, IS_LONG, 0, "10")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, sequenceBits, IS_LONG, 0, "12")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, clock, IS_LONG, 0, "Identifier\\Snowflake::CLOCK_REALTIME")
+    ZEND_ARG_OBJ_INFO_WITH_DEFAULT_VALUE(0, context, Identifier\\Context, 1, "null")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_snowflake_next, 0, 0, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_snowflake_nextBatch, 0, 1, IS_ARRAY, 0)
+    ZEND_ARG_TYPE_INFO(0, count, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_snowflake_getTimestamp, 0, 1, IS_LONG, 0)
+    ZEND_ARG_TYPE_INFO(0, id, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_snowflake_getWorkerId, 0, 1, IS_LONG, 0)
+    ZEND_ARG_TYPE_INFO(0, id, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_snowflake_getSequence, 0, 1, IS_LONG, 0)
+    ZEND_ARG_TYPE_INFO(0, id, IS_LONG, 0)
+ZEND_END_ARG_INFO()
+
+/* Snowflake object handlers */
+static zend_object_handlers php_identifier_snowflake_handlers;
+
+/* 2010-11-04 01:42:54.657 UTC, the epoch of the original Snowflake */
+#define PHP_IDENTIFIER_SNOWFLAKE_DEFAULT_EPOCH INT64_C(1288834974657)
+
+/* Milliseconds since the Unix epoch from the monotonic clock, anchored to
+ * the wall clock on first use so that NTP steps cannot move it backwards.
+ * The anchor is the raw reading: identifier.clock_regression does not
+ * apply to a clock that cannot step back, and a clamped reading would
+ * offset every later timestamp. */
+static zend_result php_identifier_snowflake_monotonic_ms(uint64_t *timestamp_ms)
+{
+#if defined(CLOCK_MONOTONIC) && !defined(PHP_WIN32)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+        uint64_t monotonic_ms = (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000ULL;
+
+        if (!IDENTIFIER_G(snowflake_clock_anchored)) {
+            IDENTIFIER_G(snowflake_clock_offset) = php_identifier_read_clock_ms() - monotonic_ms;
+            IDENTIFIER_G(snowflake_clock_anchored) = true;
+        }
+        *timestamp_ms = php_identifier_state_guard(monotonic_ms + IDENTIFIER_G(snowflake_clock_offset));
+        return SUCCESS;
+    }
+#endif
+    return php_identifier_get_timestamp_ms(timestamp_ms);
+}
+
+/* Current time in milliseconds from the bound context or the selected clock */
+static zend_result php_identifier_snowflake_time(php_identifier_snowflake_obj *sf, uint64_t *timestamp_ms)
+{
+    if (Z_TYPE(sf->context) != IS_OBJECT) {
+        return sf->clock == PHP_IDENTIFIER_SNOWFLAKE_CLOCK_MONOTONIC
+            ? php_identifier_snowflake_monotonic_ms(timestamp_ms)
+            : php_identifier_get_timestamp_ms(timestamp_ms);
+    }
+
+    zval result;
+    zend_call_method(Z_OBJ(sf->context), Z_OBJCE(sf->context), &sf->time_fn,
+        "gettimestampms", sizeof("gettimestampms") - 1, &result, 0, NULL, NULL);
+
+    if (EG(exception)) {
+        zval_ptr_dtor(&result);
+        return FAILURE;
+    }
+    if (Z_TYPE(result) != IS_LONG) {
+        zval_ptr_dtor(&result);
+        zend_throw_exception(zend_ce_exception, "Context getTimestampMs did not return a number", 0);
+        return FAILURE;
+    }
+
+    *timestamp_ms = (uint64_t)Z_LVAL(result);
+    return SUCCESS;
+}
+
+/* Sequence state: per thread for the system clocks, per object with a
+ * context so deterministic tests never disturb the production sequence */
+static zend_always_inline php_identifier_snowflake_state *php_identifier_snowflake_state_get(php_identifier_snowflake_obj *sf)
+{
+    return Z_TYPE(sf->context) == IS_OBJECT ? &sf->state : &IDENTIFIER_G(snowflake_state);
+}
+
+/* Build the next ID for timestamp_ms into *id. Within a millisecond the
+ * sequence counts up; once it is used up, the next millisecond is awaited
+ * on the system clocks and taken logically with a context or a clock that
+ * lags the last ID by more than a tick. */
+static zend_result php_identifier_snowflake_step(php_identifier_snowflake_obj *sf, php_identifier_snowflake_state *state,
+    uint64_t timestamp_ms, zend_long *id)
+{
+    uint64_t sequence_max = (UINT64_C(1) << sf->sequence_bits) - 1;
+    uint64_t sequence = 0;
+    uint64_t elapsed;
+
+    if (state->initialized && timestamp_ms <= state->last_ms) {
+        timestamp_ms = state->last_ms;
+        sequence = state->sequence + 1;
+
+        if (sequence > sequence_max) {
+            if (Z_TYPE(sf->context) != IS_OBJECT) {
+                uint64_t now;
+
+                if (php_identifier_snowflake_time(sf, &now) == FAILURE) {
+                    return FAILURE;
+                }
+                if (now + 1 >= timestamp_ms) {
+                    while (now <= timestamp_ms) {
+                        if (php_identifier_snowflake_time(sf, &now) == FAILURE) {
+                            return FAILURE;
+                        }
+                    }
+                }
+            }
+            timestamp_ms++;
+            sequence = 0;
+        }
+    }
+
+    if (timestamp_ms < sf->epoch) {
+        zend_throw_exception(zend_ce_exception, "Snowflake clock is before the epoch", 0);
+        return FAILURE;
+    }
+
+    elapsed = timestamp_ms - sf->epoch;
+    if (elapsed >> sf->timestamp_bits) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Snowflake timestamp does not fit in %d bits", (int)sf->timestamp_bits);
+        return FAILURE;
+    }
+
+    state->last_ms = timestamp_ms;
+    state->sequence = sequence;
+    state->initialized = true;
+
+    *id = (zend_long)((elapsed << (sf->worker_bits + sf->sequence_bits)) | (sf->worker_id << sf->sequence_bits) | sequence);
+    return SUCCESS;
+}
+
+/* Snowflake methods */
+
+/**
+ * Create a Snowflake generator
+ *
+ * Snowflake IDs are 63-bit integers: the milliseconds since epoch, then the
+ * worker ID, then a per-millisecond sequence. They fit a signed BIGINT
+ * column, half the size of a 16-byte identifier, and sort by time. The
+ * sequence state is shared by all generators of a thread that use the
+ * system clocks; generators with a context keep their own.
+ *
+ * CLOCK_REALTIME reads the wall clock. CLOCK_MONOTONIC anchors a monotonic
+ * clock to the wall clock once per thread, so NTP steps cannot move IDs
+ * backwards.
+ *
+ * @param int $workerId Worker ID, less than 2 ** $workerBits
+ * @param int $epoch Epoch in milliseconds since the Unix epoch
+ * @param int $timestampBits Bits for the milliseconds since epoch (1-63)
+ * @param int $workerBits Bits for the worker ID
+ * @param int $sequenceBits Bits for the per-millisecond sequence
+ * @param int $clock Snowflake::CLOCK_REALTIME or Snowflake::CLOCK_MONOTONIC
+ * @param Context|null $context Optional context for time, overriding the clock
+ * @throws Exception If the bit split exceeds 63 bits, or an argument is out of range
+ *
+ * @example
+ * $snowflake = new Snowflake(workerId: 7);
+ * $id = $snowflake->next(); // e.g., 1789213054482886656
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Snowflake, __construct)
+{
+    zend_long worker_id = 0;
+    zend_long epoch = PHP_IDENTIFIER_SNOWFLAKE_DEFAULT_EPOCH;
+    zend_long timestamp_bits = 41;
+    zend_long worker_bits = 10;
+    zend_long sequence_bits = 12;
+    zend_long clock = PHP_IDENTIFIER_SNOWFLAKE_CLOCK_REALTIME;
+    zval *context = NULL;
+
+    ZEND_PARSE_PARAMETERS_START(0, 7)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_LONG(worker_id)
+        Z_PARAM_LONG(epoch)
+        Z_PARAM_LONG(timestamp_bits)
+        Z_PARAM_LONG(worker_bits)
+        Z_PARAM_LONG(sequence_bits)
+        Z_PARAM_LONG(clock)
+        Z_PARAM_OBJECT_OF_CLASS_OR_NULL(context, php_identifier_context_ce)
+    ZEND_PARSE_PARAMETERS_END();
+
+#if SIZEOF_ZEND_LONG < 8
+    zend_throw_exception(zend_ce_exception, "Snowflake requires 64-bit integers", 0);
+    RETURN_THROWS();
+#endif
+
+    if (timestamp_bits < 1 || worker_bits < 0 || sequence_bits < 0
+            || timestamp_bits + worker_bits + sequence_bits > 63) {
+        zend_throw_exception(zend_ce_exception, "Snowflake bit split must give the timestamp at least 1 bit and total at most 63 bits", 0);
+        RETURN_THROWS();
+    }
+
+    if (worker_id < 0 || (zend_ulong)worker_id >> worker_bits) {
+        zend_throw_exception_ex(zend_ce_exception, 0, "Snowflake worker ID must be between 0 and %" ZEND_LONG_FMT_SPEC,
+            (zend_long)((UINT64_C(1) << worker_bits) - 1));
+        RETURN_THROWS();
+    }
+
+    if (epoch < 0) {
+        zend_throw_exception(zend_ce_exception, "Snowflake epoch must not be negative", 0);
+        RETURN_THROWS();
+    }
+
+    if (clock != PHP_IDENTIFIER_SNOWFLAKE_CLOCK_REALTIME && clock != PHP_IDENTIFIER_SNOWFLAKE_CLOCK_MONOTONIC) {
+        zend_throw_exception(zend_ce_exception, "Snowflake clock must be CLOCK_REALTIME or CLOCK_MONOTONIC", 0);
+        RETURN_THROWS();
+    }
+
+    php_identifier_snowflake_obj *sf = PHP_IDENTIFIER_SNOWFLAKE_OBJ_P(getThis());
+
+    sf->epoch = (uint64_t)epoch;
+    sf->timestamp_bits = (uint8_t)timestamp_bits;
+    sf->worker_bits = (uint8_t)worker_bits;
+    sf->sequence_bits = (uint8_t)sequence_bits;
+    sf->worker_id = (uint64_t)worker_id;
+    sf->clock = (php_identifier_snowflake_clock)clock;
+
+    /* Context\System is the default behaviour: use the native fast path */
+    zval_ptr_dtor(&sf->context);
+    ZVAL_UNDEF(&sf->context);
+    sf->time_fn = NULL;
+    if (context && Z_OBJCE_P(context) != php_identifier_context_system_ce) {
+        ZVAL_COPY(&sf->context, context);
+    }
+
+    memset(&sf->state, 0, sizeof(sf->state));
+}
+
+/**
+ * Generate the next Snowflake ID
+ *
+ * @return int Positive 63-bit ID, strictly greater than the previous one
+ * @throws Exception If the clock is before the epoch or past the timestamp bits
+ *
+ * @example
+ * $snowflake = new Snowflake(workerId: 7);
+ * $stmt->execute([$snowflake->next()]);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Snowflake, next)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_snowflake_obj *sf = PHP_IDENTIFIER_SNOWFLAKE_OBJ_P(getThis());
+    uint64_t timestamp_ms;
+    zend_long id;
+
+    if (php_identifier_snowflake_time(sf, &timestamp_ms) == FAILURE
+            || php_identifier_snowflake_step(sf, php_identifier_snowflake_state_get(sf), timestamp_ms, &id) == FAILURE) {
+        RETURN_THROWS();
+    }
+
+    RETURN_LONG(id);
+}
+
+/**
+ * Generate many Snowflake IDs in one call
+ *
+ * Reads the clock once per 256 IDs rather than once per ID. The batch
+ * continues the same sequence as next(), so it is strictly ascending.
+ *
+ * @param int $count Number of IDs to generate
+ * @return array List of ints
+ * @throws Exception If count is negative, or as next()
+ *
+ * @example
+ * $ids = (new Snowflake(workerId: 7))->nextBatch(1000);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Snowflake, nextBatch)
+{
+    zend_long count;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_LONG(count)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (count < 0 || (zend_ulong)count > HT_MAX_SIZE) {
+        zend_throw_exception(zend_ce_exception, "Batch count must be a non-negative integer", 0);
+        RETURN_THROWS();
+    }
+
+    php_identifier_snowflake_obj *sf = PHP_IDENTIFIER_SNOWFLAKE_OBJ_P(getThis());
+    php_identifier_snowflake_state *state = php_identifier_snowflake_state_get(sf);
+    uint64_t timestamp_ms = 0;
+    bool failed = false;
+
+    array_init_size(return_value, (uint32_t)count);
+    if (count == 0) {
+        return;
+    }
+
+    zend_hash_real_init_packed(Z_ARRVAL_P(return_value));
+
+    ZEND_HASH_FILL_PACKED(Z_ARRVAL_P(return_value)) {
+        for (zend_long i = 0; i < count; i++) {
+            zend_long id;
+
+            /* Sample the clock once per stride; in between the sequence counts up */
+            if ((i & (PHP_IDENTIFIER_BATCH_CLOCK_STRIDE - 1)) == 0
+                    && php_identifier_snowflake_time(sf, &timestamp_ms) == FAILURE) {
+                failed = true;
+                break;
+            }
+
+            if (php_identifier_snowflake_step(sf, state, timestamp_ms, &id) == FAILURE) {
+                failed = true;
+                break;
+            }
+
+            ZEND_HASH_FILL_SET_LONG(id);
+            ZEND_HASH_FILL_NEXT();
+        }
+    } ZEND_HASH_FILL_END();
+
+    if (failed) {
+        zval_ptr_dtor(return_value);
+        ZVAL_UNDEF(return_value);
+        RETURN_THROWS();
+    }
+}
+
+/**
+ * Get the Unix timestamp of a Snowflake ID
+ *
+ * Decodes with this generator's epoch and bit split.
+ *
+ * @param int $id Snowflake ID
+ * @return int Milliseconds since the Unix epoch
+ *
+ * @example
+ * $snowflake = new Snowflake();
+ * echo date('c', intdiv($snowflake->getTimestamp($snowflake->next()), 1000));
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Snowflake, getTimestamp)
+{
+    zend_long id;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_LONG(id)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_snowflake_obj *sf = PHP_IDENTIFIER_SNOWFLAKE_OBJ_P(getThis());
+    uint64_t elapsed = ((uint64_t)id >> (sf->worker_bits + sf->sequence_bits)) & ((UINT64_C(1) << sf->timestamp_bits) - 1);
+
+    RETURN_LONG((zend_long)(elapsed + sf->epoch));
+}
+
+/**
+ * Get the worker ID of a Snowflake ID
+ *
+ * @param int $id Snowflake ID
+ * @return int Worker ID
+ *
+ * @example
+ * $snowflake = new Snowflake(workerId: 7);
+ * echo $snowflake->getWorkerId($snowflake->next()); // 7
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Snowflake, getWorkerId)
+{
+    zend_long id;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_LONG(id)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_snowflake_obj *sf = PHP_IDENTIFIER_SNOWFLAKE_OBJ_P(getThis());
+
+    RETURN_LONG((zend_long)(((uint64_t)id >> sf->sequence_bits) & ((UINT64_C(1) << sf->worker_bits) - 1)));
+}
+
+/**
+ * Get the sequence number of a Snowflake ID
+ *
+ * @param int $id Snowflake ID
+ * @return int Position of the ID within its millisecond
+ *
+ * @example
+ * $snowflake = new Snowflake();
+ * echo $snowflake->getSequence($snowflake->next()); // 0
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Snowflake, getSequence)
+{
+    zend_long id;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_LONG(id)
+    ZEND_PARSE_PARAMETERS_END();
+
+    php_identifier_snowflake_obj *sf = PHP_IDENTIFIER_SNOWFLAKE_OBJ_P(getThis());
+
+    RETURN_LONG((zend_long)((uint64_t)id & ((UINT64_C(1) << sf->sequence_bits) - 1)));
+}
+
+/* Snowflake method entries */
+static const zend_function_entry php_identifier_snowflake_methods[] = {
+    PHP_ME(Identifier_Snowflake, __construct, arginfo_snowflake_construct, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Snowflake, next, arginfo_snowflake_next, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Snowflake, nextBatch, arginfo_snowflake_nextBatch, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Snowflake, getTimestamp, arginfo_snowflake_getTimestamp, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Snowflake, getWorkerId, arginfo_snowflake_getWorkerId, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Snowflake, getSequence, arginfo_snowflake_getSequence, ZEND_ACC_PUBLIC)
+    PHP_FE_END
+};
+
+/* Snowflake object creation */
+static zend_object *php_identifier_snowflake_create_object(zend_class_entry *ce)
+{
+    php_identifier_snowflake_obj *intern = zend_object_alloc(sizeof(php_identifier_snowflake_obj), ce);
+
+    zend_object_std_init(&intern->std, ce);
+    object_properties_init(&intern->std, ce);
+
+    intern->epoch = (uint64_t)PHP_IDENTIFIER_SNOWFLAKE_DEFAULT_EPOCH;
+    intern->timestamp_bits = 41;
+    intern->worker_bits = 10;
+    intern->sequence_bits = 12;
+    intern->worker_id = 0;
+    intern->clock = PHP_IDENTIFIER_SNOWFLAKE_CLOCK_REALTIME;
+    ZVAL_UNDEF(&intern->context);
+    intern->time_fn = NULL;
+    memset(&intern->state, 0, sizeof(intern->state));
+
+    intern->std.handlers = &php_identifier_snowflake_handlers;
+    return &intern->std;
+}
+
+/* Free Snowflake object */
+static void php_identifier_snowflake_free_object(zend_object *object)
+{
+    php_identifier_snowflake_obj *intern = PHP_IDENTIFIER_SNOWFLAKE_OBJ(object);
+
+    zval_ptr_dtor(&intern->context);
+
+    zend_object_std_dtor(&intern->std);
+}
+
+/* Expose the bound context to the cycle collector */
+static HashTable *php_identifier_snowflake_get_gc(zend_object *object, zval **table, int *n)
+{
+    php_identifier_snowflake_obj *intern = PHP_IDENTIFIER_SNOWFLAKE_OBJ(object);
+
+    *table = &intern->context;
+    *n = Z_TYPE(intern->context) == IS_OBJECT ? 1 : 0;
+
+    return zend_std_get_properties(object);
+}
+
+/* Register Snowflake class */
+void php_identifier_snowflake_register_class(void)
+{
+    zend_class_entry ce;
+
+    INIT_NS_CLASS_ENTRY(ce, "Identifier", "Snowflake", php_identifier_snowflake_methods);
+    php_identifier_snowflake_ce = zend_register_internal_class(&ce);
+    php_identifier_snowflake_ce->ce_flags |= ZEND_ACC_FINAL | ZEND_ACC_NOT_SERIALIZABLE;
+    php_identifier_snowflake_ce->create_object = php_identifier_snowflake_create_object;
+
+    zend_declare_class_constant_long(php_identifier_snowflake_ce, "DEFAULT_EPOCH", sizeof("DEFAULT_EPOCH")-1, (zend_long)PHP_IDENTIFIER_SNOWFLAKE_DEFAULT_EPOCH);
+    zend_declare_class_constant_long(php_identifier_snowflake_ce, "CLOCK_REALTIME", sizeof("CLOCK_REALTIME")-1, PHP_IDENTIFIER_SNOWFLAKE_CLOCK_REALTIME);
+    zend_declare_class_constant_long(php_identifier_snowflake_ce, "CLOCK_MONOTONIC", sizeof("CLOCK_MONOTONIC")-1, PHP_IDENTIFIER_SNOWFLAKE_CLOCK_MONOTONIC);
+
+    /* A clone with a context would replay the same sequence, so cloning is not supported */
+    memcpy(&php_identifier_snowflake_handlers, zend_get_std_object_handlers(), sizeof(zend_object_handlers));
+    php_identifier_snowflake_handlers.offset = XtOffsetOf(php_identifier_snowflake_obj, std);
+    php_identifier_snowflake_handlers.free_obj = php_identifier_snowflake_free_object;
+    php_identifier_snowflake_handlers.get_gc = php_identifier_snowflake_get_gc;
+    php_identifier_snowflake_handlers.clone_obj = NULL;
+}
@@ -0,0 +1,154 @@
+#include "php.h"
+#include "php_identifier.h"
+#include <string.h>
+#include <fcntl.h>
+
+#ifndef PHP_WIN32
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# define PHP_IDENTIFIER_STATE_MAPPED 1
+#endif
+
+#define PHP_IDENTIFIER_STATE_MAGIC UINT64_C(0x3154534449504850) /* "PHPIDST1" */
+#define PHP_IDENTIFIER_STATE_INTERVAL_MAX 60000
+
+/* Stable storage in the sense of RFC 4122 section 4.2.1, on one cache line.
+ * horizon_ms is written ahead of the clock: no identifier was issued at or
+ * after it, so a restarted pool can resume there without reading back what
+ * it issued last. */
+typedef struct _php_identifier_state_segment {
+    uint64_t magic;
+    uint64_t horizon_ms;            /* upper bound of every issued timestamp */
+    uint32_t clock_seq;             /* v1/v6 clock sequence of this start */
+    uint32_t reserved32;
+    uint64_t reserved[5];
+} php_identifier_state_segment;
+
+static php_identifier_state_segment *php_identifier_state_segment_ptr = NULL;
+
+/* Fixed after MINIT */
+static uint64_t php_identifier_state_floor = 0;
+static uint64_t php_identifier_state_interval = 0;
+static uint16_t php_identifier_state_clock_seq_value = 0;
+
+/* Map identifier.state_file in MINIT, before a process manager forks its
+ * workers, and resume above the horizon the previous start left in it.
+ * Writes reach the file through the page cache, without fsync, so the state
+ * survives a pool restart or crash but not a host crash. */
+void php_identifier_state_startup(const char *path, zend_long interval)
+{
+    php_identifier_state_segment_ptr = NULL;
+    php_identifier_state_floor = 0;
+
+    if (!path || !*path) {
+        return;
+    }
+
+#ifdef PHP_IDENTIFIER_STATE_MAPPED
+    size_t size = sizeof(php_identifier_state_segment);
+    php_identifier_state_segment *segment;
+    struct stat st;
+    void *mapped;
+    int fd;
+
+    if (interval < 1 || interval > PHP_IDENTIFIER_STATE_INTERVAL_MAX) {
+        php_error_docref(NULL, E_WARNING, "identifier.state_interval must be between 1 and %d, using 100",
+            PHP_IDENTIFIER_STATE_INTERVAL_MAX);
+        interval = 100;
+    }
+
+    fd = open(path, O_RDWR | O_CREAT, 0600);
+    if (fd < 0 || fstat(fd, &st) != 0 || ((size_t)st.st_size < size && ftruncate(fd, (off_t)size) != 0)) {
+        php_error_docref(NULL, E_WARNING, "Failed to open identifier.state_file \"%s\", generator state will not persist", path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return;
+    }
+
+    mapped = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mapped == MAP_FAILED) {
+        php_error_docref(NULL, E_WARNING, "Failed to map identifier.state_file \"%s\", generator state will not persist", path);
+        return;
+    }
+
+    segment = mapped;
+    if (st.st_size > 0 && segment->magic != PHP_IDENTIFIER_STATE_MAGIC) {
+        php_error_docref(NULL, E_WARNING, "identifier.state_file \"%s\" is not a state file, generator state will not persist", path);
+        munmap(mapped, size);
+        return;
+    }
+
+    if (segment->magic == PHP_IDENTIFIER_STATE_MAGIC) {
+        /* The horizon may lie ahead of the clock: the RFC increments the
+         * clock sequence in that case, and every start may be one */
+        php_identifier_state_floor = segment->horizon_ms;
+        php_identifier_state_clock_seq_value = (uint16_t)((segment->clock_seq + 1) & 0x3FFF);
+    } else {
+        unsigned char random_data[2];
+
+        php_identifier_generate_random_bytes(random_data, sizeof(random_data));
+        php_identifier_state_clock_seq_value = (uint16_t)(((random_data[0] << 8) | random_data[1]) & 0x3FFF);
+        segment->horizon_ms = 0;
+    }
+
+    segment->clock_seq = php_identifier_state_clock_seq_value;
+    segment->magic = PHP_IDENTIFIER_STATE_MAGIC;
+
+    php_identifier_state_interval = (uint64_t)interval;
+    php_identifier_state_segment_ptr = segment;
+#else
+    (void)interval;
+    php_error_docref(NULL, E_WARNING, "identifier.state_file is not supported on this platform, generator state will not persist");
+#endif
+}
+
+/* Unmap the state file at module shutdown */
+void php_identifier_state_shutdown(void)
+{
+#ifdef PHP_IDENTIFIER_STATE_MAPPED
+    if (php_identifier_state_segment_ptr) {
+        munmap(php_identifier_state_segment_ptr, sizeof(php_identifier_state_segment));
+    }
+#endif
+    php_identifier_state_segment_ptr = NULL;
+    php_identifier_state_floor = 0;
+}
+
+/* Raise a timestamp about to be issued to the persisted floor, and move the
+ * horizon ahead once the timestamp comes within one interval of it. The
+ * horizon is then two intervals out, so it is written about once an
+ * interval, with one interval to spare. Workers race with plain stores; a
+ * lost update lowers the horizon by less than that spare interval. */
+uint64_t php_identifier_state_guard(uint64_t timestamp_ms)
+{
+    php_identifier_state_segment *segment = php_identifier_state_segment_ptr;
+
+    if (EXPECTED(segment == NULL)) {
+        return timestamp_ms;
+    }
+
+    if (UNEXPECTED(timestamp_ms < php_identifier_state_floor)) {
+        timestamp_ms = php_identifier_state_floor;
+    }
+
+    if (UNEXPECTED(timestamp_ms + php_identifier_state_interval >= segment->horizon_ms)) {
+        segment->horizon_ms = timestamp_ms + 2 * php_identifier_state_interval;
+    }
+
+    return timestamp_ms;
+}
+
+/* Persisted v1/v6 clock sequence; false without a state file */
+bool php_identifier_state_clock_seq(uint16_t *clock_seq)
+{
+    if (!php_identifier_state_segment_ptr) {
+        return false;
+    }
+
+    *clock_seq = php_identifier_state_clock_seq_value;
+    return true;
+}
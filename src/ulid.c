@@ -2,6 +2,7 @@
 #include "php_identifier.h"
 #include "zend_exceptions.h"
 #include "zend_interfaces.h"
+#include "ext/spl/spl_exceptions.h"
 #include <string.h>
 
 /* Arginfo declarations */
@@ -9,6 +10,16 @@ ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_ulid_generate, 0, 0, Identifier\\
     ZEND_ARG_OBJ_INFO_WITH_DEFAULT_VALUE(0, context, Identifier\\Context, 1, "null")
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_ulid_generateFor, 0, 1, Identifier\\Ulid, 0)
+    ZEND_ARG_TYPE_INFO(0, streamKey, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_ulid_generateBatch, 0, 1, MAY_BE_ARRAY|MAY_BE_STRING)
+    ZEND_ARG_TYPE_INFO(0, count, IS_LONG, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, format, IS_LONG, 0, "Identifier\\Bit128::BATCH_OBJECTS")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, threads, IS_LONG, 0, "1")
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_ulid_toString, 0, 0, IS_STRING, 0)
 ZEND_END_ARG_INFO()
 
@@ -30,6 +41,25 @@ ZEND_END_ARG_INFO()
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_ulid_getRandomness, 0, 0, IS_STRING, 0)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_ulid_getWorkerId, 0, 0, IS_LONG, 1)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_ulid_isValid, 0, 1, _IS_BOOL, 0)
+    ZEND_ARG_TYPE_INFO(0, ulid, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_ulid_tryFromString, 0, 1, Identifier\\Ulid, 1)
+    ZEND_ARG_TYPE_INFO(0, ulid, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_ulid_tryFromHex, 0, 1, Identifier\\Ulid, 1)
+    ZEND_ARG_TYPE_INFO(0, hex, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_ulid_tryFromBytes, 0, 1, Identifier\\Ulid, 1)
+    ZEND_ARG_TYPE_INFO(0, bytes, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
 /* ULID constants */
 #define ULID_TIMESTAMP_BYTES 6
 #define ULID_RANDOMNESS_BYTES 10
@@ -97,14 +127,20 @@ static zend_string* codec_decode(zend_string *encoded, zend_string *alphabet)
     return zend_string_init("", 0, 0);
 }
 
+/* First 16 bits of the randomness, which hold the worker ID if configured */
+static zend_always_inline uint32_t php_identifier_ulid_head(const unsigned char *randomness)
+{
+    return ((uint32_t)randomness[0] << 8) | randomness[1];
+}
+
 /* Increment randomness for monotonic generation */
-/* Returns 1 on success, 0 on overflow */
-static int increment_randomness(unsigned char *randomness)
+/* Returns 1 on success, 0 on overflow, including a carry into the worker ID */
+int php_identifier_ulid_increment(unsigned char *randomness)
 {
     for (int i = ULID_RANDOMNESS_BYTES - 1; i >= 0; i--) {
         if (randomness[i] < 255) {
             randomness[i]++;
-            return 1; /* Success */
+            return php_identifier_ulid_head(randomness) <= php_identifier_worker_ulid_max();
         }
         randomness[i] = 0;
     }
@@ -112,6 +148,201 @@ static int increment_randomness(unsigned char *randomness)
     return 0;
 }
 
+/* Add a 64-bit value to 80-bit big-endian randomness */
+/* Returns 1 on success, 0 on overflow, including a carry into the worker ID */
+static int add_randomness(unsigned char *randomness, uint64_t value)
+{
+    for (int i = ULID_RANDOMNESS_BYTES - 1; i >= 0 && value; i--) {
+        value += randomness[i];
+        randomness[i] = value & 0xFF;
+        value >>= 8;
+    }
+    return value == 0 && php_identifier_ulid_head(randomness) <= php_identifier_worker_ulid_max();
+}
+
+/* Throw the monotonic overflow error shared by all ULID generators */
+void php_identifier_ulid_throw_overflow(void)
+{
+    zend_throw_exception(spl_ce_OutOfBoundsException, "ULID randomness overflow: too many ULIDs generated in the same millisecond", 0);
+}
+
+/* Apply identifier.ulid_overflow once the randomness of millisecond
+ * *timestamp is used up. On SUCCESS *timestamp is the millisecond to continue
+ * in with fresh randomness; "throw" returns FAILURE with an exception set. */
+zend_result php_identifier_ulid_overflow(uint64_t *timestamp)
+{
+    switch (IDENTIFIER_G(ulid_overflow)) {
+        case PHP_IDENTIFIER_ULID_OVERFLOW_WAIT: {
+            uint64_t now;
+
+            if (php_identifier_get_timestamp_ms(&now) == FAILURE) {
+                return FAILURE;
+            }
+
+            /* Spin until the clock leaves the exhausted millisecond. A clock
+             * more than a tick behind would stall the request: advance then. */
+            if (now + 1 >= *timestamp) {
+                while (now <= *timestamp) {
+                    if (php_identifier_get_timestamp_ms(&now) == FAILURE) {
+                        return FAILURE;
+                    }
+                }
+                IDENTIFIER_G(ulid_overflow_waits)++;
+                (*timestamp)++;
+                return SUCCESS;
+            }
+        }
+        ZEND_FALLTHROUGH;
+
+        case PHP_IDENTIFIER_ULID_OVERFLOW_ADVANCE:
+            IDENTIFIER_G(ulid_overflow_advances)++;
+            (*timestamp)++;
+            return SUCCESS;
+
+        default:
+            IDENTIFIER_G(ulid_overflow_throws)++;
+            php_identifier_ulid_throw_overflow();
+            return FAILURE;
+    }
+}
+
+/* Add the overflow policy counters of the calling thread to stats */
+void php_identifier_ulid_overflow_stats(zval *stats)
+{
+    static const char *policies[] = {"throw", "advance", "wait"};
+    zval overflow;
+
+    array_init_size(&overflow, 4);
+    add_assoc_string(&overflow, "policy", (char *)policies[IDENTIFIER_G(ulid_overflow)]);
+    add_assoc_long(&overflow, "throws", IDENTIFIER_G(ulid_overflow_throws));
+    add_assoc_long(&overflow, "advances", IDENTIFIER_G(ulid_overflow_advances));
+    add_assoc_long(&overflow, "waits", IDENTIFIER_G(ulid_overflow_waits));
+    add_assoc_zval(stats, "ulid_overflow", &overflow);
+}
+
+/* Build the next ULID for timestamp, keeping it monotonic against state.
+ * Fresh randomness comes from context when given, else from the CSPRNG.
+ * Returns FAILURE with an exception set when the randomness overflows. */
+zend_result php_identifier_ulid_next(php_identifier_ulid_state *state, uint64_t timestamp, zval *context, unsigned char *bytes)
+{
+    /* Generate randomness */
+    unsigned char *randomness = bytes + ULID_TIMESTAMP_BYTES;
+    uint64_t clock = timestamp;
+    bool fresh = true;
+
+    if (php_identifier_ulid_state_continues(state, timestamp)) {
+        /* Same timestamp, or one behind a logical timestamp the overflow
+         * policy moved ahead - increment randomness for monotonic ordering */
+        timestamp = state->last_timestamp;
+        memcpy(randomness, state->last_randomness, ULID_RANDOMNESS_BYTES);
+        if (php_identifier_ulid_increment(randomness)) {
+            fresh = false;
+        } else if (php_identifier_ulid_overflow(&timestamp) == FAILURE) {
+            return FAILURE;
+        }
+    }
+
+    if (fresh) {
+        /* New timestamp - generate fresh randomness */
+        if (context) {
+            /* Call getRandomBytes on context */
+            zval rand_result;
+            zval rand_param;
+            ZVAL_LONG(&rand_param, ULID_RANDOMNESS_BYTES);
+            zend_call_method(Z_OBJ_P(context), Z_OBJCE_P(context), NULL, "getrandombytes", 14, &rand_result, 1, &rand_param, NULL);
+
+            if (Z_TYPE(rand_result) == IS_STRING && Z_STRLEN(rand_result) == ULID_RANDOMNESS_BYTES) {
+                memcpy(randomness, Z_STRVAL(rand_result), ULID_RANDOMNESS_BYTES);
+            } else {
+                php_identifier_generate_random_bytes(randomness, ULID_RANDOMNESS_BYTES);
+            }
+            zval_dtor(&rand_result);
+        } else {
+            php_identifier_generate_random_bytes(randomness, ULID_RANDOMNESS_BYTES);
+        }
+        php_identifier_worker_stamp_ulid(randomness);
+    }
+
+    /* Update thread-local state for monotonic generation */
+    state->last_timestamp = timestamp;
+    state->last_clock = clock;
+    memcpy(state->last_randomness, randomness, ULID_RANDOMNESS_BYTES);
+    state->initialized = true;
+
+    /* Pack timestamp as big-endian 48-bit value */
+    bytes[0] = (timestamp >> 40) & 0xFF;
+    bytes[1] = (timestamp >> 32) & 0xFF;
+    bytes[2] = (timestamp >> 24) & 0xFF;
+    bytes[3] = (timestamp >> 16) & 0xFF;
+    bytes[4] = (timestamp >> 8) & 0xFF;
+    bytes[5] = timestamp & 0xFF;
+
+    return SUCCESS;
+}
+
+/* Next ULID in the configured monotonic scope. Calls with a custom context
+ * advance a state of their own, so deterministic tests never disturb the
+ * production sequence; Context\System is the same source as no context. */
+zend_result php_identifier_ulid_generate(uint64_t timestamp, zval *context, unsigned char *bytes)
+{
+    if (context && Z_OBJCE_P(context) != php_identifier_context_system_ce) {
+        return php_identifier_ulid_next(&IDENTIFIER_G(ulid_context_state), timestamp, context, bytes);
+    }
+
+    if (php_identifier_monotonic_scope_get() != PHP_IDENTIFIER_MONOTONIC_THREAD) {
+        return php_identifier_ulid_reserve(timestamp, 1, bytes);
+    }
+
+    return php_identifier_ulid_next(&IDENTIFIER_G(ulid_state), timestamp, NULL, bytes);
+}
+
+/* Free a per-stream state held by the persistent stream table */
+static void php_identifier_ulid_stream_dtor(zval *zv)
+{
+    pefree(Z_PTR_P(zv), 1);
+}
+
+/* State of one generateFor() stream, created on first use. The table is kept
+ * in use order: a hit moves the stream to the back, and when the table holds
+ * identifier.ulid_streams entries the stream at the front is evicted. */
+static php_identifier_ulid_state *php_identifier_ulid_stream(const zend_string *key)
+{
+    HashTable *streams = IDENTIFIER_G(ulid_streams);
+    php_identifier_ulid_state state;
+    php_identifier_ulid_state *found;
+    zend_long max = MAX(IDENTIFIER_G(ulid_streams_max), 1);
+
+    if (!streams) {
+        streams = pemalloc(sizeof(HashTable), 1);
+        zend_hash_init(streams, 16, NULL, php_identifier_ulid_stream_dtor, 1);
+        IDENTIFIER_G(ulid_streams) = streams;
+    }
+
+    found = zend_hash_str_find_ptr(streams, ZSTR_VAL(key), ZSTR_LEN(key));
+    if (found) {
+        /* Already the most recently used stream */
+        Bucket *last = streams->arData + streams->nNumUsed - 1;
+        if (Z_TYPE(last->val) != IS_UNDEF && Z_PTR(last->val) == found) {
+            return found;
+        }
+
+        state = *found;
+        zend_hash_str_del(streams, ZSTR_VAL(key), ZSTR_LEN(key));
+    } else {
+        memset(&state, 0, sizeof(state));
+
+        while (zend_hash_num_elements(streams) >= (uint32_t)MIN(max, UINT32_MAX)) {
+            Bucket *oldest;
+            ZEND_HASH_FOREACH_BUCKET(streams, oldest) {
+                zend_hash_del_bucket(streams, oldest);
+                break;
+            } ZEND_HASH_FOREACH_END();
+        }
+    }
+
+    return zend_hash_str_add_mem(streams, ZSTR_VAL(key), ZSTR_LEN(key), &state, sizeof(state));
+}
+
 /* ULID generation method */
 
 /**
@@ -153,78 +384,262 @@ static PHP_METHOD(Identifier_Ulid, generate)
         zend_call_method(Z_OBJ_P(context), Z_OBJCE_P(context), NULL, "gettimestampms", 14, &ts_result, 0, NULL, NULL);
         if (Z_TYPE(ts_result) == IS_LONG) {
             current_timestamp = Z_LVAL(ts_result);
-        } else {
-            current_timestamp = php_identifier_get_timestamp_ms();
+        } else if (php_identifier_get_timestamp_ms(&current_timestamp) == FAILURE) {
+            zval_dtor(&ts_result);
+            RETURN_THROWS();
         }
         zval_dtor(&ts_result);
-    } else {
-        current_timestamp = php_identifier_get_timestamp_ms();
+    } else if (php_identifier_get_timestamp_ms(&current_timestamp) == FAILURE) {
+        RETURN_THROWS();
     }
 
-    /* Generate randomness */
+    /* Create ULID bytes: 6 bytes timestamp + 10 bytes monotonic randomness */
+    unsigned char ulid_bytes[ULID_TOTAL_BYTES];
+    if (php_identifier_ulid_generate(current_timestamp, context, ulid_bytes) == FAILURE) {
+        RETURN_THROWS();
+    }
+
+    /* Create ULID object (same pattern as UUID classes) */
+    zval ulid;
+    object_init_ex(&ulid, php_identifier_ulid_ce);
+
+    /* Set the ULID bytes directly */
+    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&ulid);
+    php_identifier_bit128_fill(intern, ulid_bytes);
+
+    RETURN_ZVAL(&ulid, 1, 0);
+}
+
+/**
+ * Generate a ULID from a named monotonic stream
+ *
+ * Each stream key (a tenant, partition or queue name) has its own
+ * monotonic state, so ULIDs of one stream are strictly ordered without
+ * sharing the in-millisecond counter space with any other stream or with
+ * generate(). States persist across requests in a per-thread table of at
+ * most identifier.ulid_streams keys; the least recently used stream is
+ * evicted when it is full and starts afresh on its next use.
+ *
+ * @param string $streamKey Non-empty stream name
+ * @return Ulid A new ULID instance
+ * @throws Exception If the stream key is empty
+ * @throws OutOfBoundsException If the stream overflows and identifier.ulid_overflow is "throw"
+ *
+ * @example
+ * $a = Ulid::generateFor("tenant-42");
+ * $b = Ulid::generateFor("tenant-42");
+ * var_dump($a->compare($b) < 0); // bool(true)
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Ulid, generateFor)
+{
+    zend_string *stream_key;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(stream_key)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (ZSTR_LEN(stream_key) == 0) {
+        zend_throw_exception(zend_ce_exception, "Stream key must not be empty", 0);
+        RETURN_THROWS();
+    }
+
+    unsigned char ulid_bytes[ULID_TOTAL_BYTES];
+    uint64_t timestamp;
+
+    if (php_identifier_get_timestamp_ms(&timestamp) == FAILURE
+            || php_identifier_ulid_next(php_identifier_ulid_stream(stream_key), timestamp, NULL, ulid_bytes) == FAILURE) {
+        RETURN_THROWS();
+    }
+
+    object_init_ex(return_value, php_identifier_ulid_ce);
+    php_identifier_bit128_fill(PHP_IDENTIFIER_BIT128_OBJ_P(return_value), ulid_bytes);
+}
+
+/* Shared by the worker slices of one threaded batch */
+typedef struct _php_identifier_ulid_batch {
+    uint64_t timestamp;
+    unsigned char randomness[ULID_RANDOMNESS_BYTES]; /* first ULID of the batch */
+} php_identifier_ulid_batch;
+
+/* Worker slice for a threaded batch: one timestamp, and each slice counts up
+ * from its own offset into the batch's randomness range */
+static bool php_identifier_ulid_fill_slice(unsigned char *bytes, size_t start, size_t count, const void *arg)
+{
+    const php_identifier_ulid_batch *batch = arg;
     unsigned char randomness[ULID_RANDOMNESS_BYTES];
 
-    if (current_timestamp == IDENTIFIER_G(ulid_last_timestamp) && IDENTIFIER_G(ulid_randomness_initialized)) {
-        /* Same timestamp - increment randomness for monotonic ordering */
-        memcpy(randomness, IDENTIFIER_G(ulid_last_randomness), ULID_RANDOMNESS_BYTES);
-        if (!increment_randomness(randomness)) {
-            /* Randomness overflow - this should be extremely rare */
-            zend_class_entry *out_of_bounds_ce = zend_lookup_class(zend_string_init("OutOfBoundsException", strlen("OutOfBoundsException"), 0));
-            if (out_of_bounds_ce) {
-                zend_throw_exception(out_of_bounds_ce, "ULID randomness overflow: too many ULIDs generated in the same millisecond", 0);
-            } else {
-                zend_throw_exception(zend_ce_exception, "ULID randomness overflow: too many ULIDs generated in the same millisecond", 0);
-            }
+    memcpy(randomness, batch->randomness, ULID_RANDOMNESS_BYTES);
+    add_randomness(randomness, start);
+
+    for (size_t i = 0; i < count; i++, bytes += ULID_TOTAL_BYTES) {
+        if (i > 0) {
+            php_identifier_ulid_increment(randomness);
+        }
+
+        bytes[0] = (batch->timestamp >> 40) & 0xFF;
+        bytes[1] = (batch->timestamp >> 32) & 0xFF;
+        bytes[2] = (batch->timestamp >> 24) & 0xFF;
+        bytes[3] = (batch->timestamp >> 16) & 0xFF;
+        bytes[4] = (batch->timestamp >> 8) & 0xFF;
+        bytes[5] = batch->timestamp & 0xFF;
+        memcpy(bytes + ULID_TIMESTAMP_BYTES, randomness, ULID_RANDOMNESS_BYTES);
+    }
+
+    return true;
+}
+
+/**
+ * Generate many ULIDs in one call
+ *
+ * Runs the monotonic generator in a tight loop, reading the clock once per
+ * 256 ULIDs rather than once per ULID. The batch continues the same
+ * monotonic sequence as generate(), so it is strictly ascending and sorts
+ * after any ULID generated before it. With BATCH_BINARY the result is one
+ * string of $count * 16 bytes.
+ *
+ * With $threads > 1, large batches are split into contiguous slices filled
+ * in parallel. The batch then shares one timestamp and each slice takes its
+ * own range of the monotonic randomness counter, so ordering is preserved.
+ * Builds without thread support ignore the option.
+ *
+ * @param int $count Number of ULIDs to generate
+ * @param int $format One of Bit128::BATCH_OBJECTS, BATCH_STRINGS or BATCH_BINARY
+ * @param int $threads Maximum number of threads to fill the batch with
+ * @return array|string List of Ulid objects or strings, or the packed bytes
+ * @throws Exception If count is negative, format is unknown or threads is out of range
+ * @throws OutOfBoundsException If the randomness overflows and identifier.ulid_overflow is "throw"
+ *
+ * @example
+ * $rows = Ulid::generateBatch(50000, Ulid::BATCH_BINARY);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Ulid, generateBatch)
+{
+    zend_long count;
+    zend_long format = PHP_IDENTIFIER_BATCH_OBJECTS;
+    zend_long threads_arg = 1;
+
+    ZEND_PARSE_PARAMETERS_START(1, 3)
+        Z_PARAM_LONG(count)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_LONG(format)
+        Z_PARAM_LONG(threads_arg)
+    ZEND_PARSE_PARAMETERS_END();
+
+    zend_string *packed = php_identifier_batch_alloc(count, format);
+    if (!packed) {
+        RETURN_THROWS();
+    }
+
+    uint32_t threads = php_identifier_batch_threads(threads_arg, (size_t)count);
+    if (threads == 0) {
+        zend_string_efree(packed);
+        RETURN_THROWS();
+    }
+
+    php_identifier_ulid_state *state = &IDENTIFIER_G(ulid_state);
+    unsigned char *bytes = (unsigned char *)ZSTR_VAL(packed);
+    uint64_t timestamp = 0;
+
+    if (count > 0 && php_identifier_monotonic_scope_get() != PHP_IDENTIFIER_MONOTONIC_THREAD) {
+        /* Claim the whole range from the shared state in one step */
+        php_identifier_ulid_batch batch;
+        unsigned char first[ULID_TOTAL_BYTES];
+
+        if (php_identifier_get_timestamp_ms(&timestamp) == FAILURE
+                || php_identifier_ulid_reserve(timestamp, (uint64_t)count, first) == FAILURE) {
+            zend_string_efree(packed);
             RETURN_THROWS();
         }
-    } else {
-        /* New timestamp - generate fresh randomness */
-        if (context) {
-            /* Call getRandomBytes on context */
-            zval rand_result;
-            zval rand_param;
-            ZVAL_LONG(&rand_param, ULID_RANDOMNESS_BYTES);
-            zend_call_method(Z_OBJ_P(context), Z_OBJCE_P(context), NULL, "getrandombytes", 14, &rand_result, 1, &rand_param, NULL);
 
-            if (Z_TYPE(rand_result) == IS_STRING && Z_STRLEN(rand_result) == ULID_RANDOMNESS_BYTES) {
-                memcpy(randomness, Z_STRVAL(rand_result), ULID_RANDOMNESS_BYTES);
-            } else {
-                php_identifier_generate_random_bytes(randomness, ULID_RANDOMNESS_BYTES);
+        batch.timestamp = ((uint64_t)first[0] << 40) | ((uint64_t)first[1] << 32) | ((uint64_t)first[2] << 24)
+            | ((uint64_t)first[3] << 16) | ((uint64_t)first[4] << 8) | first[5];
+        memcpy(batch.randomness, first + ULID_TIMESTAMP_BYTES, ULID_RANDOMNESS_BYTES);
+
+        if (threads > 1) {
+            if (php_identifier_batch_parallel(bytes, (size_t)count, threads, php_identifier_ulid_fill_slice, &batch) == FAILURE) {
+                zend_string_efree(packed);
+                RETURN_THROWS();
             }
-            zval_dtor(&rand_result);
         } else {
-            php_identifier_generate_random_bytes(randomness, ULID_RANDOMNESS_BYTES);
+            php_identifier_ulid_fill_slice(bytes, 0, (size_t)count, &batch);
         }
+
+        php_identifier_batch_return(return_value, packed, php_identifier_ulid_ce, format, PHP_IDENTIFIER_FORMAT_ULID);
+        return;
     }
 
-    /* Update thread-local state for monotonic generation */
-    IDENTIFIER_G(ulid_last_timestamp) = current_timestamp;
-    memcpy(IDENTIFIER_G(ulid_last_randomness), randomness, ULID_RANDOMNESS_BYTES);
-    IDENTIFIER_G(ulid_randomness_initialized) = 1;
+    if (threads > 1) {
+        php_identifier_ulid_batch batch;
+        unsigned char last[ULID_RANDOMNESS_BYTES];
 
-    /* Create ULID bytes: 6 bytes timestamp + 10 bytes randomness */
-    unsigned char ulid_bytes[ULID_TOTAL_BYTES];
+        bool fresh = true;
 
-    /* Pack timestamp as big-endian 48-bit value */
-    ulid_bytes[0] = (current_timestamp >> 40) & 0xFF;
-    ulid_bytes[1] = (current_timestamp >> 32) & 0xFF;
-    ulid_bytes[2] = (current_timestamp >> 24) & 0xFF;
-    ulid_bytes[3] = (current_timestamp >> 16) & 0xFF;
-    ulid_bytes[4] = (current_timestamp >> 8) & 0xFF;
-    ulid_bytes[5] = current_timestamp & 0xFF;
+        if (php_identifier_get_timestamp_ms(&batch.timestamp) == FAILURE) {
+            zend_string_efree(packed);
+            RETURN_THROWS();
+        }
+        timestamp = batch.timestamp;
+        if (php_identifier_ulid_state_continues(state, batch.timestamp)) {
+            /* Continue the current millisecond after the last issued ULID */
+            batch.timestamp = state->last_timestamp;
+            memcpy(batch.randomness, state->last_randomness, ULID_RANDOMNESS_BYTES);
+            fresh = !php_identifier_ulid_increment(batch.randomness);
+            if (fresh && php_identifier_ulid_overflow(&batch.timestamp) == FAILURE) {
+                zend_string_efree(packed);
+                RETURN_THROWS();
+            }
+        }
 
-    /* Copy randomness */
-    memcpy(ulid_bytes + ULID_TIMESTAMP_BYTES, randomness, ULID_RANDOMNESS_BYTES);
+        /* Reserve the whole range up front so no slice can overflow */
+        for (;;) {
+            if (fresh) {
+                php_identifier_generate_random_bytes(batch.randomness, ULID_RANDOMNESS_BYTES);
+                php_identifier_worker_stamp_ulid(batch.randomness);
+            }
+            memcpy(last, batch.randomness, ULID_RANDOMNESS_BYTES);
+            if (add_randomness(last, (uint64_t)count - 1)) {
+                break;
+            }
+            if (php_identifier_ulid_overflow(&batch.timestamp) == FAILURE) {
+                zend_string_efree(packed);
+                RETURN_THROWS();
+            }
+            fresh = true;
+        }
 
-    /* Create ULID object (same pattern as UUID classes) */
-    zval ulid;
-    object_init_ex(&ulid, php_identifier_ulid_ce);
+        if (php_identifier_batch_parallel(bytes, (size_t)count, threads, php_identifier_ulid_fill_slice, &batch) == FAILURE) {
+            zend_string_efree(packed);
+            RETURN_THROWS();
+        }
 
-    /* Set the ULID bytes directly */
-    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&ulid);
-    memcpy(intern->data, ulid_bytes, ULID_TOTAL_BYTES);
+        state->last_timestamp = batch.timestamp;
+        state->last_clock = timestamp;
+        memcpy(state->last_randomness, last, ULID_RANDOMNESS_BYTES);
+        state->initialized = true;
 
-    RETURN_ZVAL(&ulid, 1, 0);
+        php_identifier_batch_return(return_value, packed, php_identifier_ulid_ce, format, PHP_IDENTIFIER_FORMAT_ULID);
+        return;
+    }
+
+    for (zend_long i = 0; i < count; i++, bytes += ULID_TOTAL_BYTES) {
+        /* Sample the clock once per stride; in between the state increments */
+        if ((i & (PHP_IDENTIFIER_BATCH_CLOCK_STRIDE - 1)) == 0
+                && php_identifier_get_timestamp_ms(&timestamp) == FAILURE) {
+            zend_string_efree(packed);
+            RETURN_THROWS();
+        }
+
+        if (php_identifier_ulid_next(state, timestamp, NULL, bytes) == FAILURE) {
+            zend_string_efree(packed);
+            RETURN_THROWS();
+        }
+    }
+
+    php_identifier_batch_return(return_value, packed, php_identifier_ulid_ce, format, PHP_IDENTIFIER_FORMAT_ULID);
 }
 
 /* Manual Base32 Crockford encoding for ULID (exactly 26 chars) */
@@ -266,6 +681,12 @@ static void ulid_encode_base32(const unsigned char *bytes, char *output)
     output[26] = '\0';
 }
 
+/* Exported wrapper used by the Bit128 cast handler */
+void php_identifier_format_ulid(const unsigned char *bytes, char *output)
+{
+    ulid_encode_base32(bytes, output);
+}
+
 /**
  * Convert ULID to string representation
  *
@@ -285,46 +706,46 @@ static void ulid_encode_base32(const unsigned char *bytes, char *output)
  */
 static PHP_METHOD(Identifier_Ulid, toString)
 {
-    /* Get the bytes from parent Bit128 class */
-    zval bytes_result;
-    zval *this_ptr = getThis();
-    zend_call_method(Z_OBJ_P(this_ptr), php_identifier_bit128_ce, NULL, "getbytes", 8, &bytes_result, 0, NULL, NULL);
-
-    if (Z_TYPE(bytes_result) != IS_STRING || Z_STRLEN(bytes_result) != ULID_TOTAL_BYTES) {
-        zval_dtor(&bytes_result);
-        RETURN_EMPTY_STRING();
-    }
+    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(getThis());
 
-    /* Encode using manual ULID Base32 encoding */
-    char ulid_str[ULID_STRING_LENGTH + 1];
-    ulid_encode_base32((unsigned char*)Z_STRVAL(bytes_result), ulid_str);
-
-    zval_dtor(&bytes_result);
-
-    RETURN_STRINGL(ulid_str, ULID_STRING_LENGTH);
+    /* Encoded with the manual ULID Base32 encoder, cached if enabled */
+    RETURN_STR(php_identifier_bit128_format(intern, PHP_IDENTIFIER_FORMAT_ULID));
 }
 
-/* Manual Base32 Crockford decoding for ULID */
-static int ulid_decode_base32(const char *input, unsigned char *bytes)
-{
-    /* Create lookup table */
-    int lookup[256];
-    const char *alphabet = "0123456789ABCDEFGHJKMNPQRSTVWXYZ";
+/* Crockford Base32 digit values (either case), -1 for anything else */
+static const int8_t ulid_decode_table[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, 16, 17, -1, 18, 19, -1, 20, 21, -1,
+    22, 23, 24, 25, 26, -1, 27, 28, 29, 30, 31, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, 16, 17, -1, 18, 19, -1, 20, 21, -1,
+    22, 23, 24, 25, 26, -1, 27, 28, 29, 30, 31, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
 
-    for (int i = 0; i < 256; i++) {
-        lookup[i] = -1;
-    }
-    for (int i = 0; i < 32; i++) {
-        lookup[(unsigned char)alphabet[i]] = i;
+/* Decode a 26-character ULID without allocating */
+php_identifier_parse_result php_identifier_parse_ulid(const char *input, size_t len, unsigned char *bytes)
+{
+    if (len != ULID_STRING_LENGTH) {
+        return PHP_IDENTIFIER_PARSE_LENGTH;
     }
 
     /* Validate and decode */
     uint64_t high = 0, low = 0;
 
     for (int i = 0; i < 26; i++) {
-        int value = lookup[(unsigned char)input[i]];
-        if (value == -1) {
-            return 0; /* Invalid character */
+        int value = ulid_decode_table[(unsigned char)input[i]];
+        if (value < 0) {
+            return PHP_IDENTIFIER_PARSE_CHARACTER;
         }
 
         int bit_pos = (25 - i) * 5;
@@ -343,13 +764,36 @@ static int ulid_decode_base32(const char *input, unsigned char *bytes)
         }
     }
 
+    /* 26 characters carry 130 bits: the first one may only use its low 3 */
+    if (ulid_decode_table[(unsigned char)input[0]] > 7) {
+        return PHP_IDENTIFIER_PARSE_OVERFLOW;
+    }
+
     /* Convert back to bytes */
     for (int i = 0; i < 8; i++) {
         bytes[i] = (high >> (56 - i * 8)) & 0xFF;
         bytes[i + 8] = (low >> (56 - i * 8)) & 0xFF;
     }
 
-    return 1; /* Success */
+    return PHP_IDENTIFIER_PARSE_OK;
+}
+
+/* Decode a ULID string, throwing the fromString() errors on failure */
+bool php_identifier_ulid_parse_string(const zend_string *str, unsigned char *bytes)
+{
+    switch (php_identifier_parse_ulid(ZSTR_VAL(str), ZSTR_LEN(str), bytes)) {
+        case PHP_IDENTIFIER_PARSE_OK:
+            return true;
+        case PHP_IDENTIFIER_PARSE_LENGTH:
+            zend_throw_exception(zend_ce_exception, "Invalid ULID string length", 0);
+            return false;
+        case PHP_IDENTIFIER_PARSE_OVERFLOW:
+            zend_throw_exception(zend_ce_exception, "ULID string exceeds 128 bits", 0);
+            return false;
+        default:
+            zend_throw_exception(zend_ce_exception, "Invalid character in ULID string", 0);
+            return false;
+    }
 }
 
 /**
@@ -380,16 +824,9 @@ static PHP_METHOD(Identifier_Ulid, fromString)
         Z_PARAM_STR(ulid_str)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Validate ULID string length */
-    if (ZSTR_LEN(ulid_str) != ULID_STRING_LENGTH) {
-        zend_throw_exception(zend_ce_exception, "Invalid ULID string length", 0);
-        RETURN_THROWS();
-    }
-
     /* Decode using manual ULID Base32 decoding */
     unsigned char bytes[ULID_TOTAL_BYTES];
-    if (!ulid_decode_base32(ZSTR_VAL(ulid_str), bytes)) {
-        zend_throw_exception(zend_ce_exception, "Invalid character in ULID string", 0);
+    if (!php_identifier_ulid_parse_string(ulid_str, bytes)) {
         RETURN_THROWS();
     }
 
@@ -399,7 +836,7 @@ static PHP_METHOD(Identifier_Ulid, fromString)
 
     /* Set the ULID bytes directly */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&ulid);
-    memcpy(intern->data, bytes, ULID_TOTAL_BYTES);
+    php_identifier_bit128_fill(intern, bytes);
 
     RETURN_ZVAL(&ulid, 1, 0);
 }
@@ -433,46 +870,19 @@ static PHP_METHOD(Identifier_Ulid, fromHex)
         Z_PARAM_STR(hex)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Convert hex to bytes first */
+    /* Parse 32 hex digits, dashes allowed */
     unsigned char bytes[16];
-    const char *hex_str = ZSTR_VAL(hex);
-    size_t hex_len = ZSTR_LEN(hex);
-
-    /* Remove dashes if present and validate length */
-    char clean_hex[33];
-    size_t clean_len = 0;
-
-    for (size_t i = 0; i < hex_len && clean_len < 32; i++) {
-        char c = hex_str[i];
-        if (c != '-') {
-            if (!isxdigit(c)) {
-                zend_throw_exception(zend_ce_exception, "Invalid hexadecimal character in ULID", 0);
-                RETURN_THROWS();
-            }
-            clean_hex[clean_len++] = tolower(c);
-        }
-    }
-
-    if (clean_len != 32) {
-        zend_throw_exception(zend_ce_exception, "ULID hex string must be exactly 32 characters (excluding dashes)", 0);
+    if (!php_identifier_parse_hex_string(hex, "ULID", bytes)) {
         RETURN_THROWS();
     }
 
-    clean_hex[32] = '\0';
-
-    /* Convert hex string to bytes */
-    for (int i = 0; i < 16; i++) {
-        char hex_byte[3] = {clean_hex[i*2], clean_hex[i*2+1], '\0'};
-        bytes[i] = (unsigned char)strtol(hex_byte, NULL, 16);
-    }
-
     /* Create ULID object (same pattern as UUID classes) */
     zval ulid;
     object_init_ex(&ulid, php_identifier_ulid_ce);
 
     /* Set the ULID bytes directly */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&ulid);
-    memcpy(intern->data, bytes, 16);
+    php_identifier_bit128_fill(intern, bytes);
 
     RETURN_ZVAL(&ulid, 1, 0);
 }
@@ -519,7 +929,7 @@ static PHP_METHOD(Identifier_Ulid, fromBytes)
 
     /* Set the ULID bytes directly */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&ulid);
-    memcpy(intern->data, ZSTR_VAL(bytes), ZSTR_LEN(bytes));
+    php_identifier_bit128_fill(intern, ZSTR_VAL(bytes));
 
     RETURN_ZVAL(&ulid, 1, 0);
 }
@@ -610,15 +1020,172 @@ static PHP_METHOD(Identifier_Ulid, getRandomness)
     RETURN_STR(randomness);
 }
 
+/**
+ * Get the worker ID stored in the randomness
+ *
+ * With identifier.worker_bits set, the first bits of the randomness hold
+ * the ID of the worker that generated the ULID, so rows can be routed back
+ * to their producer. The bits are read with the width configured for this
+ * process.
+ *
+ * @return int|null Worker ID, or null if identifier.worker_bits is 0
+ *
+ * @example
+ * // identifier.worker_bits=8, identifier.worker_id=42
+ * echo Ulid::generate()->getWorkerId(); // 42
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Ulid, getWorkerId)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    uint32_t bits = php_identifier_worker_bits();
+    if (bits == 0) {
+        RETURN_NULL();
+    }
+
+    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(getThis());
+
+    RETURN_LONG(php_identifier_ulid_head(intern->data + ULID_TIMESTAMP_BYTES) >> (16 - bits));
+}
+
+/**
+ * Check whether a string is a valid ULID
+ *
+ * Validates a 26-character Crockford Base32 string (either case) that fits
+ * in 128 bits, without creating an object or throwing.
+ *
+ * @param string $ulid String to validate
+ * @return bool True if the string is a valid ULID
+ *
+ * @example
+ * var_dump(Ulid::isValid('01ARZ3NDEKTSV4RRFFQ69G5FAV')); // bool(true)
+ * var_dump(Ulid::isValid('81ARZ3NDEKTSV4RRFFQ69G5FAV')); // bool(false), overflows
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Ulid, isValid)
+{
+    zend_string *ulid_str;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(ulid_str)
+    ZEND_PARSE_PARAMETERS_END();
+
+    unsigned char bytes[ULID_TOTAL_BYTES];
+    RETURN_BOOL(php_identifier_parse_ulid(ZSTR_VAL(ulid_str), ZSTR_LEN(ulid_str), bytes) == PHP_IDENTIFIER_PARSE_OK);
+}
+
+/* Build a ULID from already validated bytes */
+static void php_identifier_ulid_return(zval *return_value, const unsigned char *bytes)
+{
+    object_init_ex(return_value, php_identifier_ulid_ce);
+    php_identifier_bit128_fill(PHP_IDENTIFIER_BIT128_OBJ_P(return_value), bytes);
+}
+
+/**
+ * Parse a ULID string, returning null on failure
+ *
+ * Same as fromString() but returns null instead of throwing.
+ *
+ * @param string $ulid ULID string in Crockford Base32 format (26 characters)
+ * @return Ulid|null ULID instance, or null
+ *
+ * @example
+ * $ulid = Ulid::tryFromString($input) ?? throw new InvalidArgumentException();
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Ulid, tryFromString)
+{
+    zend_string *ulid_str;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(ulid_str)
+    ZEND_PARSE_PARAMETERS_END();
+
+    unsigned char bytes[ULID_TOTAL_BYTES];
+    if (php_identifier_parse_ulid(ZSTR_VAL(ulid_str), ZSTR_LEN(ulid_str), bytes) != PHP_IDENTIFIER_PARSE_OK) {
+        RETURN_NULL();
+    }
+
+    php_identifier_ulid_return(return_value, bytes);
+}
+
+/**
+ * Create a ULID from a hexadecimal string, returning null on failure
+ *
+ * Same as fromHex() but returns null instead of throwing.
+ *
+ * @param string $hex Hexadecimal string (32 characters, optionally with dashes)
+ * @return Ulid|null ULID instance, or null
+ *
+ * @example
+ * $ulid = Ulid::tryFromHex('0188bac7b8de4c4aaa5f8c3e0cd5e5e3');
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Ulid, tryFromHex)
+{
+    zend_string *hex;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(hex)
+    ZEND_PARSE_PARAMETERS_END();
+
+    unsigned char bytes[ULID_TOTAL_BYTES];
+    if (php_identifier_parse_hex_dashed(ZSTR_VAL(hex), ZSTR_LEN(hex), bytes) != PHP_IDENTIFIER_PARSE_OK) {
+        RETURN_NULL();
+    }
+
+    php_identifier_ulid_return(return_value, bytes);
+}
+
+/**
+ * Create a ULID from raw bytes, returning null on failure
+ *
+ * Same as fromBytes() but returns null instead of throwing.
+ *
+ * @param string $bytes Binary string of exactly 16 bytes
+ * @return Ulid|null ULID instance, or null
+ *
+ * @example
+ * $ulid = Ulid::tryFromBytes($row['id']);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Ulid, tryFromBytes)
+{
+    zend_string *bytes;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(bytes)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (ZSTR_LEN(bytes) != ULID_TOTAL_BYTES) {
+        RETURN_NULL();
+    }
+
+    php_identifier_ulid_return(return_value, (const unsigned char *)ZSTR_VAL(bytes));
+}
+
 /* ULID method entries */
 static const zend_function_entry php_identifier_ulid_methods[] = {
     PHP_ME(Identifier_Ulid, generate, arginfo_ulid_generate, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Ulid, generateFor, arginfo_ulid_generateFor, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Ulid, generateBatch, arginfo_ulid_generateBatch, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Ulid, toString, arginfo_ulid_toString, ZEND_ACC_PUBLIC)
     PHP_ME(Identifier_Ulid, fromString, arginfo_ulid_fromString, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Ulid, fromHex, arginfo_ulid_fromHex, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Ulid, fromBytes, arginfo_ulid_fromBytes, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Ulid, getTimestamp, arginfo_ulid_getTimestamp, ZEND_ACC_PUBLIC)
     PHP_ME(Identifier_Ulid, getRandomness, arginfo_ulid_getRandomness, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Ulid, getWorkerId, arginfo_ulid_getWorkerId, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Ulid, isValid, arginfo_ulid_isValid, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Ulid, tryFromString, arginfo_ulid_tryFromString, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Ulid, tryFromHex, arginfo_ulid_tryFromHex, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Ulid, tryFromBytes, arginfo_ulid_tryFromBytes, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_FE_END
 };
 
@@ -38,6 +38,172 @@ ZEND_END_ARG_INFO()
 ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_uuid_max, 0, 0, Identifier\\Uuid, 0)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_uuid_namespace, 0, 0, Identifier\\Uuid\\Version1, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_uuid_isValid, 0, 1, _IS_BOOL, 0)
+    ZEND_ARG_TYPE_INFO(0, uuid, IS_STRING, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, version, IS_LONG, 1, "null")
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_uuid_tryFromString, 0, 1, Identifier\\Uuid, 1)
+    ZEND_ARG_TYPE_INFO(0, uuid, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_uuid_tryFromBytes, 0, 1, Identifier\\Uuid, 1)
+    ZEND_ARG_TYPE_INFO(0, bytes, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_uuid_tryFromHex, 0, 1, Identifier\\Uuid, 1)
+    ZEND_ARG_TYPE_INFO(0, hex, IS_STRING, 0)
+ZEND_END_ARG_INFO()
+
+/* RFC 9562 predefined namespaces: DNS, URL, OID and X.500 */
+const unsigned char php_identifier_uuid_namespaces[PHP_IDENTIFIER_UUID_NAMESPACE_COUNT][16] = {
+    {0x6b, 0xa7, 0xb8, 0x10, 0x9d, 0xad, 0x11, 0xd1, 0x80, 0xb4, 0x00, 0xc0, 0x4f, 0xd4, 0x30, 0xc8},
+    {0x6b, 0xa7, 0xb8, 0x11, 0x9d, 0xad, 0x11, 0xd1, 0x80, 0xb4, 0x00, 0xc0, 0x4f, 0xd4, 0x30, 0xc8},
+    {0x6b, 0xa7, 0xb8, 0x12, 0x9d, 0xad, 0x11, 0xd1, 0x80, 0xb4, 0x00, 0xc0, 0x4f, 0xd4, 0x30, 0xc8},
+    {0x6b, 0xa7, 0xb8, 0x14, 0x9d, 0xad, 0x11, 0xd1, 0x80, 0xb4, 0x00, 0xc0, 0x4f, 0xd4, 0x30, 0xc8}
+};
+
+/* Format 16 bytes as xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx (output must hold 37 bytes) */
+void php_identifier_format_uuid(const unsigned char *bytes, char *output)
+{
+    static const char digits[] = "0123456789abcdef";
+    char *p = output;
+
+    for (int i = 0; i < 16; i++) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) {
+            *p++ = '-';
+        }
+        *p++ = digits[bytes[i] >> 4];
+        *p++ = digits[bytes[i] & 0x0F];
+    }
+    *p = '\0';
+}
+
+/* Map a UUID version nibble to its class; unknown versions use Uuid */
+zend_class_entry *php_identifier_uuid_class_for_version(int version)
+{
+    switch (version) {
+        case 1:
+            return php_identifier_uuid_version1_ce;
+        case 3:
+            return php_identifier_uuid_version3_ce;
+        case 4:
+            return php_identifier_uuid_version4_ce;
+        case 5:
+            return php_identifier_uuid_version5_ce;
+        case 6:
+            return php_identifier_uuid_version6_ce;
+        case 7:
+            return php_identifier_uuid_version7_ce;
+        default:
+            return php_identifier_uuid_ce;
+    }
+}
+
+/* Return the index of a predefined namespace, or -1 for any other UUID */
+int php_identifier_uuid_namespace_index(const unsigned char *bytes)
+{
+    /* All four namespaces differ only in byte 3 */
+    if (memcmp(bytes + 4, php_identifier_uuid_namespaces[0] + 4, 12) != 0
+        || memcmp(bytes, php_identifier_uuid_namespaces[0], 3) != 0) {
+        return -1;
+    }
+
+    for (int i = 0; i < PHP_IDENTIFIER_UUID_NAMESPACE_COUNT; i++) {
+        if (bytes[3] == php_identifier_uuid_namespaces[i][3]) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/* Parse a canonical UUID string, throwing the fromString() errors on failure */
+bool php_identifier_uuid_parse_string(const zend_string *str, unsigned char *bytes)
+{
+    switch (php_identifier_parse_uuid(ZSTR_VAL(str), ZSTR_LEN(str), bytes)) {
+        case PHP_IDENTIFIER_PARSE_OK:
+            return true;
+        case PHP_IDENTIFIER_PARSE_LENGTH:
+            zend_throw_exception(zend_ce_exception, "Invalid UUID string length", 0);
+            return false;
+        case PHP_IDENTIFIER_PARSE_FORMAT:
+            zend_throw_exception(zend_ce_exception, "Invalid UUID string format", 0);
+            return false;
+        default:
+            zend_throw_exception(zend_ce_exception, "Invalid hex characters in UUID string", 0);
+            return false;
+    }
+}
+
+/* Whether the class a static method was called on admits target_ce:
+ * Version4::tryFromString() and Version4::isValid() only accept version 4 */
+static bool php_identifier_uuid_scope_accepts(zend_execute_data *execute_data, zend_class_entry *target_ce)
+{
+    zend_class_entry *scope = zend_get_called_scope(execute_data);
+
+    return !scope || scope == php_identifier_uuid_ce || instanceof_function(target_ce, scope);
+}
+
+/* Finish a tryFrom*() call: build the version class, or null if it does not fit the called class */
+static void php_identifier_uuid_try_return(zend_execute_data *execute_data, zval *return_value, const unsigned char *bytes)
+{
+    zend_class_entry *target_ce = php_identifier_uuid_class_for_version((bytes[6] >> 4) & 0x0F);
+
+    if (!php_identifier_uuid_scope_accepts(execute_data, target_ce)) {
+        RETURN_NULL();
+    }
+
+    object_init_ex(return_value, target_ce);
+    php_identifier_bit128_fill(PHP_IDENTIFIER_BIT128_OBJ_P(return_value), bytes);
+}
+
+/* Return the request-wide shared instance of a well-known UUID */
+static void php_identifier_uuid_well_known(zval *return_value, php_identifier_uuid_well_known_id id)
+{
+    zend_object *object = IDENTIFIER_G(uuid_well_known)[id];
+
+    if (!object) {
+        zend_class_entry *ce = id >= PHP_IDENTIFIER_UUID_WELL_KNOWN_DNS
+            ? php_identifier_uuid_version1_ce
+            : php_identifier_uuid_ce;
+
+        object = ce->create_object(ce);
+        php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ(object);
+
+        if (id == PHP_IDENTIFIER_UUID_WELL_KNOWN_NIL) {
+            memset(intern->data, 0, 16);
+        } else if (id == PHP_IDENTIFIER_UUID_WELL_KNOWN_MAX) {
+            memset(intern->data, 0xFF, 16);
+        } else {
+            memcpy(intern->data, php_identifier_uuid_namespaces[id - PHP_IDENTIFIER_UUID_WELL_KNOWN_DNS], 16);
+        }
+        /* Shared by every caller: __construct() and __unserialize() must not change it */
+        intern->initialized = true;
+
+        IDENTIFIER_G(uuid_well_known)[id] = object;
+    }
+
+    GC_ADDREF(object);
+    RETURN_OBJ(object);
+}
+
+/* Drop the shared instances at the end of the request */
+void php_identifier_uuid_release_well_known(void)
+{
+    for (int i = 0; i < PHP_IDENTIFIER_UUID_WELL_KNOWN_COUNT; i++) {
+        zend_object *object = IDENTIFIER_G(uuid_well_known)[i];
+
+        if (object) {
+            IDENTIFIER_G(uuid_well_known)[i] = NULL;
+            OBJ_RELEASE(object);
+        }
+    }
+}
+
 /* UUID methods */
 
 /**
@@ -110,18 +276,7 @@ static PHP_METHOD(Identifier_Uuid, toString)
 {
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(getThis());
     
-    zend_string *result = zend_string_alloc(36, 0);
-    char *str = ZSTR_VAL(result);
-    
-    sprintf(str, "%02x%02x%02x%02x-%02x%02x-%02x%02x-%02x%02x-%02x%02x%02x%02x%02x%02x",
-        intern->data[0], intern->data[1], intern->data[2], intern->data[3],
-        intern->data[4], intern->data[5],
-        intern->data[6], intern->data[7],
-        intern->data[8], intern->data[9],
-        intern->data[10], intern->data[11], intern->data[12], intern->data[13], intern->data[14], intern->data[15]
-    );
-    
-    RETURN_STR(result);
+    RETURN_STR(php_identifier_bit128_format(intern, PHP_IDENTIFIER_FORMAT_UUID));
 }
 
 /**
@@ -150,74 +305,17 @@ static PHP_METHOD(Identifier_Uuid, fromString)
         Z_PARAM_STR(uuid_str)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Validate UUID string format: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx */
-    if (ZSTR_LEN(uuid_str) != 36) {
-        zend_throw_exception(zend_ce_exception, "Invalid UUID string length", 0);
-        RETURN_THROWS();
-    }
-
-    const char *str = ZSTR_VAL(uuid_str);
-
-    /* Check hyphens are in correct positions */
-    if (str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
-        zend_throw_exception(zend_ce_exception, "Invalid UUID string format", 0);
-        RETURN_THROWS();
-    }
-
-    /* Parse hex digits and convert to bytes */
+    /* Parse xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx */
     unsigned char uuid_bytes[16];
-    int byte_index = 0;
-
-    for (int i = 0; i < 36; i++) {
-        if (i == 8 || i == 13 || i == 18 || i == 23) {
-            continue; /* Skip hyphens */
-        }
-
-        char hex_char1 = str[i];
-        char hex_char2 = str[i + 1];
-
-        /* Validate hex characters */
-        if (!isxdigit(hex_char1) || !isxdigit(hex_char2)) {
-            zend_throw_exception(zend_ce_exception, "Invalid hex characters in UUID string", 0);
-            RETURN_THROWS();
-        }
-
-        /* Convert hex pair to byte */
-        char hex_pair[3] = {hex_char1, hex_char2, '\0'};
-        uuid_bytes[byte_index] = (unsigned char)strtol(hex_pair, NULL, 16);
-        byte_index++;
-        i++; /* Skip the second hex character */
+    if (!php_identifier_uuid_parse_string(uuid_str, uuid_bytes)) {
+        RETURN_THROWS();
     }
 
     /* Extract version from byte 6 (upper nibble) */
     int version = (uuid_bytes[6] >> 4) & 0x0F;
 
     /* Determine which class to instantiate based on version */
-    zend_class_entry *target_ce;
-    switch (version) {
-        case 1:
-            target_ce = php_identifier_uuid_version1_ce;
-            break;
-        case 3:
-            target_ce = php_identifier_uuid_version3_ce;
-            break;
-        case 4:
-            target_ce = php_identifier_uuid_version4_ce;
-            break;
-        case 5:
-            target_ce = php_identifier_uuid_version5_ce;
-            break;
-        case 6:
-            target_ce = php_identifier_uuid_version6_ce;
-            break;
-        case 7:
-            target_ce = php_identifier_uuid_version7_ce;
-            break;
-        default:
-            /* Unknown version, use generic Uuid class */
-            target_ce = php_identifier_uuid_ce;
-            break;
-    }
+    zend_class_entry *target_ce = php_identifier_uuid_class_for_version(version);
 
     /* Create UUID object */
     zval uuid;
@@ -225,7 +323,7 @@ static PHP_METHOD(Identifier_Uuid, fromString)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -270,31 +368,7 @@ static PHP_METHOD(Identifier_Uuid, fromBytes)
     int version = (uuid_bytes[6] >> 4) & 0x0F;
 
     /* Determine which class to instantiate based on version */
-    zend_class_entry *target_ce;
-    switch (version) {
-        case 1:
-            target_ce = php_identifier_uuid_version1_ce;
-            break;
-        case 3:
-            target_ce = php_identifier_uuid_version3_ce;
-            break;
-        case 4:
-            target_ce = php_identifier_uuid_version4_ce;
-            break;
-        case 5:
-            target_ce = php_identifier_uuid_version5_ce;
-            break;
-        case 6:
-            target_ce = php_identifier_uuid_version6_ce;
-            break;
-        case 7:
-            target_ce = php_identifier_uuid_version7_ce;
-            break;
-        default:
-            /* Unknown version, use generic Uuid class */
-            target_ce = php_identifier_uuid_ce;
-            break;
-    }
+    zend_class_entry *target_ce = php_identifier_uuid_class_for_version(version);
 
     /* Create UUID object */
     zval uuid;
@@ -302,7 +376,7 @@ static PHP_METHOD(Identifier_Uuid, fromBytes)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -334,68 +408,17 @@ static PHP_METHOD(Identifier_Uuid, fromHex)
         Z_PARAM_STR(hex)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Convert hex to bytes first, then delegate to fromBytes */
+    /* Parse 32 hex digits, dashes allowed */
     unsigned char bytes[16];
-    const char *hex_str = ZSTR_VAL(hex);
-    size_t hex_len = ZSTR_LEN(hex);
-
-    /* Remove dashes if present and validate length */
-    char clean_hex[33];
-    size_t clean_len = 0;
-
-    for (size_t i = 0; i < hex_len && clean_len < 32; i++) {
-        char c = hex_str[i];
-        if (c != '-') {
-            if (!isxdigit(c)) {
-                zend_throw_exception(zend_ce_exception, "Invalid hexadecimal character in UUID", 0);
-                RETURN_THROWS();
-            }
-            clean_hex[clean_len++] = tolower(c);
-        }
-    }
-
-    if (clean_len != 32) {
-        zend_throw_exception(zend_ce_exception, "UUID hex string must be exactly 32 characters (excluding dashes)", 0);
+    if (!php_identifier_parse_hex_string(hex, "UUID", bytes)) {
         RETURN_THROWS();
     }
 
-    clean_hex[32] = '\0';
-
-    /* Convert hex string to bytes */
-    for (int i = 0; i < 16; i++) {
-        char hex_byte[3] = {clean_hex[i*2], clean_hex[i*2+1], '\0'};
-        bytes[i] = (unsigned char)strtol(hex_byte, NULL, 16);
-    }
-
     /* Extract version from byte 6 (upper nibble) */
     int version = (bytes[6] >> 4) & 0x0F;
 
     /* Determine which class to instantiate based on version */
-    zend_class_entry *target_ce;
-    switch (version) {
-        case 1:
-            target_ce = php_identifier_uuid_version1_ce;
-            break;
-        case 3:
-            target_ce = php_identifier_uuid_version3_ce;
-            break;
-        case 4:
-            target_ce = php_identifier_uuid_version4_ce;
-            break;
-        case 5:
-            target_ce = php_identifier_uuid_version5_ce;
-            break;
-        case 6:
-            target_ce = php_identifier_uuid_version6_ce;
-            break;
-        case 7:
-            target_ce = php_identifier_uuid_version7_ce;
-            break;
-        default:
-            /* Unknown version, use generic Uuid class */
-            target_ce = php_identifier_uuid_ce;
-            break;
-    }
+    zend_class_entry *target_ce = php_identifier_uuid_class_for_version(version);
 
     /* Create UUID object */
     zval uuid;
@@ -403,7 +426,7 @@ static PHP_METHOD(Identifier_Uuid, fromHex)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, bytes, 16);
+    php_identifier_bit128_fill(intern, bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -442,6 +465,7 @@ static PHP_METHOD(Identifier_Uuid, isNil)
  *
  * Returns a UUID with all bits set to zero (00000000-0000-0000-0000-000000000000).
  * This is a special UUID defined in RFC 4122 that represents a null or empty value.
+ * The instance is created once and shared for the rest of the request.
  *
  * @return Uuid The nil UUID instance
  *
@@ -454,15 +478,9 @@ static PHP_METHOD(Identifier_Uuid, isNil)
  */
 static PHP_METHOD(Identifier_Uuid, nil)
 {
-    /* Create nil UUID (all zeros) */
-    zval uuid;
-    object_init_ex(&uuid, php_identifier_uuid_ce);
+    ZEND_PARSE_PARAMETERS_NONE();
 
-    /* Get the internal object and set all bytes to 0 */
-    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memset(intern->data, 0, 16);
-
-    RETURN_ZVAL(&uuid, 1, 0);
+    php_identifier_uuid_well_known(return_value, PHP_IDENTIFIER_UUID_WELL_KNOWN_NIL);
 }
 
 /**
@@ -499,6 +517,7 @@ static PHP_METHOD(Identifier_Uuid, isMax)
  *
  * Returns a UUID with all bits set to 1 (ffffffff-ffff-ffff-ffff-ffffffffffff).
  * This is a special UUID defined in RFC 4122 that represents the maximum possible UUID value.
+ * The instance is created once and shared for the rest of the request.
  *
  * @return Uuid The max UUID instance
  *
@@ -511,15 +530,224 @@ static PHP_METHOD(Identifier_Uuid, isMax)
  */
 static PHP_METHOD(Identifier_Uuid, max)
 {
-    /* Create max UUID (all ones) */
-    zval uuid;
-    object_init_ex(&uuid, php_identifier_uuid_ce);
+    ZEND_PARSE_PARAMETERS_NONE();
 
-    /* Get the internal object and set all bytes to 0xFF */
-    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memset(intern->data, 0xFF, 16);
+    php_identifier_uuid_well_known(return_value, PHP_IDENTIFIER_UUID_WELL_KNOWN_MAX);
+}
 
-    RETURN_ZVAL(&uuid, 1, 0);
+/**
+ * Get the DNS namespace UUID
+ *
+ * Returns the RFC 9562 namespace for fully qualified domain names
+ * (6ba7b810-9dad-11d1-80b4-00c04fd430c8). The instance is shared for the
+ * rest of the request, and Version3/Version5 generation in this namespace
+ * starts from a precomputed hash state.
+ *
+ * @return Version1 The DNS namespace UUID
+ *
+ * @example
+ * $uuid = Version5::generate(Uuid::namespaceDns(), "example.com");
+ * echo $uuid; // "cfbff0d1-9375-5685-968c-48ce8b15ae17"
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid, namespaceDns)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_uuid_well_known(return_value, PHP_IDENTIFIER_UUID_WELL_KNOWN_DNS);
+}
+
+/**
+ * Get the URL namespace UUID
+ *
+ * Returns the RFC 9562 namespace for URLs (6ba7b811-9dad-11d1-80b4-00c04fd430c8).
+ *
+ * @return Version1 The URL namespace UUID
+ *
+ * @example
+ * $uuid = Version5::generate(Uuid::namespaceUrl(), "https://example.com/");
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid, namespaceUrl)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_uuid_well_known(return_value, PHP_IDENTIFIER_UUID_WELL_KNOWN_URL);
+}
+
+/**
+ * Get the OID namespace UUID
+ *
+ * Returns the RFC 9562 namespace for ISO object identifiers
+ * (6ba7b812-9dad-11d1-80b4-00c04fd430c8).
+ *
+ * @return Version1 The OID namespace UUID
+ *
+ * @example
+ * $uuid = Version3::generate(Uuid::namespaceOid(), "1.3.6.1");
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid, namespaceOid)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_uuid_well_known(return_value, PHP_IDENTIFIER_UUID_WELL_KNOWN_OID);
+}
+
+/**
+ * Get the X.500 namespace UUID
+ *
+ * Returns the RFC 9562 namespace for X.500 distinguished names
+ * (6ba7b814-9dad-11d1-80b4-00c04fd430c8).
+ *
+ * @return Version1 The X.500 namespace UUID
+ *
+ * @example
+ * $uuid = Version5::generate(Uuid::namespaceX500(), "CN=example");
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid, namespaceX500)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    php_identifier_uuid_well_known(return_value, PHP_IDENTIFIER_UUID_WELL_KNOWN_X500);
+}
+
+/**
+ * Check whether a string is a valid UUID
+ *
+ * Validates the canonical 8-4-4-4-12 form accepted by fromString() without
+ * creating an object or throwing. When $version is given, the version
+ * nibble must also match. Called on a version class, only UUIDs of that
+ * version are valid.
+ *
+ * @param string $uuid String to validate
+ * @param int|null $version Required UUID version, or null for any
+ * @return bool True if the string is a valid UUID
+ *
+ * @example
+ * var_dump(Uuid::isValid('550e8400-e29b-41d4-a716-446655440000'));    // bool(true)
+ * var_dump(Uuid::isValid('550e8400-e29b-41d4-a716-446655440000', 7)); // bool(false)
+ * var_dump(Uuid::isValid('not-a-uuid'));                              // bool(false)
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid, isValid)
+{
+    zend_string *uuid_str;
+    zend_long version = 0;
+    bool version_is_null = true;
+
+    ZEND_PARSE_PARAMETERS_START(1, 2)
+        Z_PARAM_STR(uuid_str)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_LONG_OR_NULL(version, version_is_null)
+    ZEND_PARSE_PARAMETERS_END();
+
+    unsigned char bytes[16];
+    if (php_identifier_parse_uuid(ZSTR_VAL(uuid_str), ZSTR_LEN(uuid_str), bytes) != PHP_IDENTIFIER_PARSE_OK) {
+        RETURN_FALSE;
+    }
+
+    if (!php_identifier_uuid_scope_accepts(execute_data, php_identifier_uuid_class_for_version((bytes[6] >> 4) & 0x0F))) {
+        RETURN_FALSE;
+    }
+
+    RETURN_BOOL(version_is_null || ((bytes[6] >> 4) & 0x0F) == version);
+}
+
+/**
+ * Parse a UUID string, returning null on failure
+ *
+ * Same as fromString() but returns null instead of throwing. Called on a
+ * version class, it also returns null for UUIDs of another version.
+ *
+ * @param string $uuid UUID string in format "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx"
+ * @return Uuid|null UUID instance of the appropriate version, or null
+ *
+ * @example
+ * $uuid = Uuid::tryFromString($_GET['id'] ?? '') ?? Uuid::nil();
+ * var_dump(Version7::tryFromString('550e8400-e29b-41d4-a716-446655440000')); // NULL
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid, tryFromString)
+{
+    zend_string *uuid_str;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(uuid_str)
+    ZEND_PARSE_PARAMETERS_END();
+
+    unsigned char bytes[16];
+    if (php_identifier_parse_uuid(ZSTR_VAL(uuid_str), ZSTR_LEN(uuid_str), bytes) != PHP_IDENTIFIER_PARSE_OK) {
+        RETURN_NULL();
+    }
+
+    php_identifier_uuid_try_return(execute_data, return_value, bytes);
+}
+
+/**
+ * Create a UUID from binary bytes, returning null on failure
+ *
+ * Same as fromBytes() but returns null instead of throwing. Called on a
+ * version class, it also returns null for UUIDs of another version.
+ *
+ * @param string $bytes Exactly 16 bytes of binary data
+ * @return Uuid|null UUID instance of the appropriate version, or null
+ *
+ * @example
+ * $uuid = Uuid::tryFromBytes($row['id']);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid, tryFromBytes)
+{
+    zend_string *bytes;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(bytes)
+    ZEND_PARSE_PARAMETERS_END();
+
+    if (ZSTR_LEN(bytes) != 16) {
+        RETURN_NULL();
+    }
+
+    php_identifier_uuid_try_return(execute_data, return_value, (const unsigned char *)ZSTR_VAL(bytes));
+}
+
+/**
+ * Create a UUID from a hexadecimal string, returning null on failure
+ *
+ * Same as fromHex() but returns null instead of throwing. Called on a
+ * version class, it also returns null for UUIDs of another version.
+ *
+ * @param string $hex 32-character hexadecimal string (with or without hyphens)
+ * @return Uuid|null UUID instance of the appropriate version, or null
+ *
+ * @example
+ * $uuid = Uuid::tryFromHex('550e8400e29b41d4a716446655440000');
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid, tryFromHex)
+{
+    zend_string *hex;
+
+    ZEND_PARSE_PARAMETERS_START(1, 1)
+        Z_PARAM_STR(hex)
+    ZEND_PARSE_PARAMETERS_END();
+
+    unsigned char bytes[16];
+    if (php_identifier_parse_hex_dashed(ZSTR_VAL(hex), ZSTR_LEN(hex), bytes) != PHP_IDENTIFIER_PARSE_OK) {
+        RETURN_NULL();
+    }
+
+    php_identifier_uuid_try_return(execute_data, return_value, bytes);
 }
 
 /* UUID method entries */
@@ -534,6 +762,14 @@ static const zend_function_entry php_identifier_uuid_methods[] = {
     PHP_ME(Identifier_Uuid, nil, arginfo_uuid_nil, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Uuid, isMax, arginfo_uuid_isMax, ZEND_ACC_PUBLIC)
     PHP_ME(Identifier_Uuid, max, arginfo_uuid_max, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Uuid, namespaceDns, arginfo_uuid_namespace, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Uuid, namespaceUrl, arginfo_uuid_namespace, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Uuid, namespaceOid, arginfo_uuid_namespace, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Uuid, namespaceX500, arginfo_uuid_namespace, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Uuid, isValid, arginfo_uuid_isValid, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Uuid, tryFromString, arginfo_uuid_tryFromString, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Uuid, tryFromBytes, arginfo_uuid_tryFromBytes, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Uuid, tryFromHex, arginfo_uuid_tryFromHex, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_FE_END
 };
 
@@ -554,6 +790,12 @@ void php_identifier_uuid_register_classes(void)
     INIT_NS_CLASS_ENTRY(ce, "Identifier", "Uuid", php_identifier_uuid_methods);
     php_identifier_uuid_ce = zend_register_internal_class_ex(&ce, php_identifier_bit128_ce);
 
+    /* RFC 9562 predefined namespaces in string form */
+    zend_declare_class_constant_string(php_identifier_uuid_ce, "NAMESPACE_DNS", sizeof("NAMESPACE_DNS")-1, "6ba7b810-9dad-11d1-80b4-00c04fd430c8");
+    zend_declare_class_constant_string(php_identifier_uuid_ce, "NAMESPACE_URL", sizeof("NAMESPACE_URL")-1, "6ba7b811-9dad-11d1-80b4-00c04fd430c8");
+    zend_declare_class_constant_string(php_identifier_uuid_ce, "NAMESPACE_OID", sizeof("NAMESPACE_OID")-1, "6ba7b812-9dad-11d1-80b4-00c04fd430c8");
+    zend_declare_class_constant_string(php_identifier_uuid_ce, "NAMESPACE_X500", sizeof("NAMESPACE_X500")-1, "6ba7b814-9dad-11d1-80b4-00c04fd430c8");
+
     /* Register all UUID version classes */
     php_identifier_uuid_version1_register_class();
     php_identifier_uuid_version3_register_class();
@@ -29,6 +29,32 @@ ZEND_END_ARG_INFO()
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_uuid_version1_getClockSequence, 0, 0, IS_LONG, 0)
 ZEND_END_ARG_INFO()
 
+/* Lay out a version 1 UUID from a 60-bit Gregorian timestamp, a 14-bit
+ * clock sequence and a 6-byte node */
+void php_identifier_uuid_v1_layout(unsigned char *uuid_bytes, uint64_t timestamp_100ns, uint16_t clock_seq, const unsigned char *node)
+{
+    /* time_low (32 bits) */
+    uuid_bytes[0] = (timestamp_100ns >> 24) & 0xFF;
+    uuid_bytes[1] = (timestamp_100ns >> 16) & 0xFF;
+    uuid_bytes[2] = (timestamp_100ns >> 8) & 0xFF;
+    uuid_bytes[3] = timestamp_100ns & 0xFF;
+
+    /* time_mid (16 bits) */
+    uuid_bytes[4] = (timestamp_100ns >> 40) & 0xFF;
+    uuid_bytes[5] = (timestamp_100ns >> 32) & 0xFF;
+
+    /* time_hi_and_version (16 bits) */
+    uuid_bytes[6] = ((timestamp_100ns >> 56) & 0x0F) | 0x10; /* Version 1 */
+    uuid_bytes[7] = (timestamp_100ns >> 48) & 0xFF;
+
+    /* clock_seq_hi_and_reserved and clock_seq_low */
+    uuid_bytes[8] = ((clock_seq >> 8) & 0x3F) | 0x80; /* Variant bits */
+    uuid_bytes[9] = clock_seq & 0xFF;
+
+    /* node (48 bits) */
+    memcpy(&uuid_bytes[10], node, 6);
+}
+
 /* UUID Version 1 methods */
 
 /**
@@ -126,7 +152,10 @@ static PHP_METHOD(Identifier_Uuid_Version1, generate)
         zval_ptr_dtor(&random_function);
     } else {
         /* Use system time and random */
-        uint64_t timestamp_ms = php_identifier_get_timestamp_ms();
+        uint64_t timestamp_ms;
+        if (php_identifier_get_timestamp_ms(&timestamp_ms) == FAILURE) {
+            RETURN_THROWS();
+        }
         timestamp_100ns = (timestamp_ms * 10000) + 122192928000000000ULL;
 
         /* Generate random clock sequence and node */
@@ -142,27 +171,7 @@ static PHP_METHOD(Identifier_Uuid_Version1, generate)
     /* Set multicast bit for random node (RFC 4122 requirement) */
     node[0] |= 0x01;
 
-    /* Build UUID v1 layout */
-    /* time_low (32 bits) */
-    uuid_bytes[0] = (timestamp_100ns >> 24) & 0xFF;
-    uuid_bytes[1] = (timestamp_100ns >> 16) & 0xFF;
-    uuid_bytes[2] = (timestamp_100ns >> 8) & 0xFF;
-    uuid_bytes[3] = timestamp_100ns & 0xFF;
-
-    /* time_mid (16 bits) */
-    uuid_bytes[4] = (timestamp_100ns >> 40) & 0xFF;
-    uuid_bytes[5] = (timestamp_100ns >> 32) & 0xFF;
-
-    /* time_hi_and_version (16 bits) */
-    uuid_bytes[6] = ((timestamp_100ns >> 56) & 0x0F) | 0x10; /* Version 1 */
-    uuid_bytes[7] = (timestamp_100ns >> 48) & 0xFF;
-
-    /* clock_seq_hi_and_reserved and clock_seq_low */
-    uuid_bytes[8] = ((clock_seq >> 8) & 0x3F) | 0x80; /* Variant bits */
-    uuid_bytes[9] = clock_seq & 0xFF;
-
-    /* node (48 bits) */
-    memcpy(&uuid_bytes[10], node, 6);
+    php_identifier_uuid_v1_layout(uuid_bytes, timestamp_100ns, clock_seq, node);
 
     /* Create UUID object */
     zval uuid;
@@ -170,7 +179,7 @@ static PHP_METHOD(Identifier_Uuid_Version1, generate)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -277,43 +286,10 @@ static PHP_METHOD(Identifier_Uuid_Version1, fromString)
         Z_PARAM_STR(uuid_str)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Validate UUID string format: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx */
-    if (ZSTR_LEN(uuid_str) != 36) {
-        zend_throw_exception(zend_ce_exception, "Invalid UUID string length", 0);
-        RETURN_THROWS();
-    }
-
-    const char *str = ZSTR_VAL(uuid_str);
-
-    /* Check hyphens are in correct positions */
-    if (str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
-        zend_throw_exception(zend_ce_exception, "Invalid UUID string format", 0);
-        RETURN_THROWS();
-    }
-
-    /* Parse hex digits and convert to bytes */
+    /* Parse xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx */
     unsigned char uuid_bytes[16];
-    int byte_index = 0;
-
-    for (int i = 0; i < 36; i++) {
-        if (i == 8 || i == 13 || i == 18 || i == 23) {
-            continue; /* Skip hyphens */
-        }
-
-        char hex_char1 = str[i];
-        char hex_char2 = str[i + 1];
-
-        /* Validate hex characters */
-        if (!isxdigit(hex_char1) || !isxdigit(hex_char2)) {
-            zend_throw_exception(zend_ce_exception, "Invalid hex characters in UUID string", 0);
-            RETURN_THROWS();
-        }
-
-        /* Convert hex pair to byte */
-        char hex_pair[3] = {hex_char1, hex_char2, '\0'};
-        uuid_bytes[byte_index] = (unsigned char)strtol(hex_pair, NULL, 16);
-        byte_index++;
-        i++; /* Skip the second hex character */
+    if (!php_identifier_uuid_parse_string(uuid_str, uuid_bytes)) {
+        RETURN_THROWS();
     }
 
     /* Check if it's version 1 */
@@ -329,7 +305,7 @@ static PHP_METHOD(Identifier_Uuid_Version1, fromString)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -359,7 +335,7 @@ static PHP_METHOD(Identifier_Uuid_Version1, fromBytes)
     object_init_ex(&uuid, php_identifier_uuid_version1_ce);
 
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -372,39 +348,12 @@ static PHP_METHOD(Identifier_Uuid_Version1, fromHex)
         Z_PARAM_STR(hex)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Convert hex to bytes first */
+    /* Parse 32 hex digits, dashes allowed */
     unsigned char bytes[16];
-    const char *hex_str = ZSTR_VAL(hex);
-    size_t hex_len = ZSTR_LEN(hex);
-
-    /* Remove dashes if present and validate length */
-    char clean_hex[33];
-    size_t clean_len = 0;
-
-    for (size_t i = 0; i < hex_len && clean_len < 32; i++) {
-        char c = hex_str[i];
-        if (c != '-') {
-            if (!isxdigit(c)) {
-                zend_throw_exception(zend_ce_exception, "Invalid hexadecimal character in UUID", 0);
-                RETURN_THROWS();
-            }
-            clean_hex[clean_len++] = tolower(c);
-        }
-    }
-
-    if (clean_len != 32) {
-        zend_throw_exception(zend_ce_exception, "UUID hex string must be exactly 32 characters (excluding dashes)", 0);
+    if (!php_identifier_parse_hex_string(hex, "UUID", bytes)) {
         RETURN_THROWS();
     }
 
-    clean_hex[32] = '\0';
-
-    /* Convert hex string to bytes */
-    for (int i = 0; i < 16; i++) {
-        char hex_byte[3] = {clean_hex[i*2], clean_hex[i*2+1], '\0'};
-        bytes[i] = (unsigned char)strtol(hex_byte, NULL, 16);
-    }
-
     /* Check if it's version 1 */
     int version = (bytes[6] >> 4) & 0x0F;
     if (version != 1) {
@@ -418,7 +367,7 @@ static PHP_METHOD(Identifier_Uuid_Version1, fromHex)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, bytes, 16);
+    php_identifier_bit128_fill(intern, bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
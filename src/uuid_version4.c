@@ -20,12 +20,51 @@ ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_uuid_version4_fromHex, 0, 1, Iden
     ZEND_ARG_TYPE_INFO(0, hex, IS_STRING, 0)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_uuid_version4_generateBatch, 0, 1, MAY_BE_ARRAY|MAY_BE_STRING)
+    ZEND_ARG_TYPE_INFO(0, count, IS_LONG, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, format, IS_LONG, 0, "Identifier\\Bit128::BATCH_OBJECTS")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, threads, IS_LONG, 0, "1")
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_uuid_version4_getRandomBytes, 0, 0, IS_STRING, 0)
 ZEND_END_ARG_INFO()
 
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_uuid_version4_getPureRandomBytes, 0, 0, IS_STRING, 0)
 ZEND_END_ARG_INFO()
 
+/* Fill 16 bytes with a random version 4 UUID from the system CSPRNG */
+void php_identifier_uuid_v4_fill(unsigned char *bytes)
+{
+    php_identifier_generate_random_bytes(bytes, 16);
+
+    /* Set version bits: version 4 (0100) in the most significant 4 bits of byte 6 */
+    bytes[6] = (bytes[6] & 0x0F) | 0x40;
+
+    /* Set variant bits: variant 10 in the most significant 2 bits of byte 8 */
+    bytes[8] = (bytes[8] & 0x3F) | 0x80;
+}
+
+/* Stamp version and variant bits onto count random UUIDs in place */
+static void php_identifier_uuid_v4_stamp(unsigned char *bytes, size_t count)
+{
+    for (size_t i = 0; i < count; i++, bytes += 16) {
+        bytes[6] = (bytes[6] & 0x0F) | 0x40;
+        bytes[8] = (bytes[8] & 0x3F) | 0x80;
+    }
+}
+
+/* Worker slice for generateBatch(): random bytes straight from the OS */
+static bool php_identifier_uuid_v4_fill_slice(unsigned char *bytes, size_t start, size_t count, const void *arg)
+{
+    if (!php_identifier_batch_random(bytes, count * 16)) {
+        return false;
+    }
+
+    php_identifier_uuid_v4_stamp(bytes, count);
+
+    return true;
+}
+
 /* UUID Version 4 methods */
 
 /**
@@ -103,11 +142,75 @@ static PHP_METHOD(Identifier_Uuid_Version4, generate)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
 
+/**
+ * Generate many random UUIDs version 4 in one call
+ *
+ * Draws the entropy for the whole batch from the system CSPRNG in a single
+ * block, then stamps the version and variant bits in place. With
+ * BATCH_BINARY the result is one string of $count * 16 bytes, ready for a
+ * bulk insert or unpacking with str_split($bin, 16).
+ *
+ * With $threads > 1, large batches are split into contiguous slices that
+ * worker threads fill in parallel, each reading the OS CSPRNG directly.
+ * Builds without thread support ignore the option.
+ *
+ * @param int $count Number of UUIDs to generate
+ * @param int $format One of Bit128::BATCH_OBJECTS, BATCH_STRINGS or BATCH_BINARY
+ * @param int $threads Maximum number of threads to fill the batch with
+ * @return array|string List of Version4 objects or strings, or the packed bytes
+ * @throws Exception If count is negative, format is unknown or threads is out of range
+ *
+ * @example
+ * $ids = Version4::generateBatch(50000, Version4::BATCH_BINARY);
+ * foreach (str_split($ids, 16) as $bytes) { ... }
+ *
+ * // Backfill: ten million UUIDs across eight cores
+ * $bin = Version4::generateBatch(10_000_000, Version4::BATCH_BINARY, 8);
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid_Version4, generateBatch)
+{
+    zend_long count;
+    zend_long format = PHP_IDENTIFIER_BATCH_OBJECTS;
+    zend_long threads_arg = 1;
+
+    ZEND_PARSE_PARAMETERS_START(1, 3)
+        Z_PARAM_LONG(count)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_LONG(format)
+        Z_PARAM_LONG(threads_arg)
+    ZEND_PARSE_PARAMETERS_END();
+
+    zend_string *packed = php_identifier_batch_alloc(count, format);
+    if (!packed) {
+        RETURN_THROWS();
+    }
+
+    uint32_t threads = php_identifier_batch_threads(threads_arg, (size_t)count);
+    unsigned char *bytes = (unsigned char *)ZSTR_VAL(packed);
+
+    if (threads == 0) {
+        zend_string_efree(packed);
+        RETURN_THROWS();
+    } else if (threads > 1) {
+        if (php_identifier_batch_parallel(bytes, (size_t)count, threads, php_identifier_uuid_v4_fill_slice, NULL) == FAILURE) {
+            zend_string_efree(packed);
+            RETURN_THROWS();
+        }
+    } else {
+        php_identifier_generate_random_bytes(bytes, ZSTR_LEN(packed));
+        php_identifier_uuid_v4_stamp(bytes, (size_t)count);
+    }
+
+    php_identifier_batch_return(return_value, packed, php_identifier_uuid_version4_ce, format, PHP_IDENTIFIER_FORMAT_UUID);
+}
+
 /**
  * Create a Version 4 UUID from a string representation
  *
@@ -132,43 +235,10 @@ static PHP_METHOD(Identifier_Uuid_Version4, fromString)
         Z_PARAM_STR(uuid_str)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Validate UUID string format: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx */
-    if (ZSTR_LEN(uuid_str) != 36) {
-        zend_throw_exception(zend_ce_exception, "Invalid UUID string length", 0);
-        RETURN_THROWS();
-    }
-
-    const char *str = ZSTR_VAL(uuid_str);
-
-    /* Check hyphens are in correct positions */
-    if (str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
-        zend_throw_exception(zend_ce_exception, "Invalid UUID string format", 0);
-        RETURN_THROWS();
-    }
-
-    /* Parse hex digits and convert to bytes */
+    /* Parse xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx */
     unsigned char uuid_bytes[16];
-    int byte_index = 0;
-
-    for (int i = 0; i < 36; i++) {
-        if (i == 8 || i == 13 || i == 18 || i == 23) {
-            continue; /* Skip hyphens */
-        }
-
-        char hex_char1 = str[i];
-        char hex_char2 = str[i + 1];
-
-        /* Validate hex characters */
-        if (!isxdigit(hex_char1) || !isxdigit(hex_char2)) {
-            zend_throw_exception(zend_ce_exception, "Invalid hex characters in UUID string", 0);
-            RETURN_THROWS();
-        }
-
-        /* Convert hex pair to byte */
-        char hex_pair[3] = {hex_char1, hex_char2, '\0'};
-        uuid_bytes[byte_index] = (unsigned char)strtol(hex_pair, NULL, 16);
-        byte_index++;
-        i++; /* Skip the second hex character */
+    if (!php_identifier_uuid_parse_string(uuid_str, uuid_bytes)) {
+        RETURN_THROWS();
     }
 
     /* Check if it's version 4 */
@@ -184,7 +254,7 @@ static PHP_METHOD(Identifier_Uuid_Version4, fromString)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -237,7 +307,7 @@ static PHP_METHOD(Identifier_Uuid_Version4, fromBytes)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -269,39 +339,12 @@ static PHP_METHOD(Identifier_Uuid_Version4, fromHex)
         Z_PARAM_STR(hex)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Convert hex to bytes first */
+    /* Parse 32 hex digits, dashes allowed */
     unsigned char bytes[16];
-    const char *hex_str = ZSTR_VAL(hex);
-    size_t hex_len = ZSTR_LEN(hex);
-
-    /* Remove dashes if present and validate length */
-    char clean_hex[33];
-    size_t clean_len = 0;
-
-    for (size_t i = 0; i < hex_len && clean_len < 32; i++) {
-        char c = hex_str[i];
-        if (c != '-') {
-            if (!isxdigit(c)) {
-                zend_throw_exception(zend_ce_exception, "Invalid hexadecimal character in UUID", 0);
-                RETURN_THROWS();
-            }
-            clean_hex[clean_len++] = tolower(c);
-        }
-    }
-
-    if (clean_len != 32) {
-        zend_throw_exception(zend_ce_exception, "UUID hex string must be exactly 32 characters (excluding dashes)", 0);
+    if (!php_identifier_parse_hex_string(hex, "UUID", bytes)) {
         RETURN_THROWS();
     }
 
-    clean_hex[32] = '\0';
-
-    /* Convert hex string to bytes */
-    for (int i = 0; i < 16; i++) {
-        char hex_byte[3] = {clean_hex[i*2], clean_hex[i*2+1], '\0'};
-        bytes[i] = (unsigned char)strtol(hex_byte, NULL, 16);
-    }
-
     /* Check if it's version 4 */
     int version = (bytes[6] >> 4) & 0x0F;
     if (version != 4) {
@@ -315,7 +358,7 @@ static PHP_METHOD(Identifier_Uuid_Version4, fromHex)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, bytes, 16);
+    php_identifier_bit128_fill(intern, bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -385,6 +428,7 @@ static PHP_METHOD(Identifier_Uuid_Version4, getPureRandomBytes)
 /* UUID Version 4 method entries */
 static const zend_function_entry php_identifier_uuid_version4_methods[] = {
     PHP_ME(Identifier_Uuid_Version4, generate, arginfo_uuid_version4_generate, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Uuid_Version4, generateBatch, arginfo_uuid_version4_generateBatch, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Uuid_Version4, fromString, arginfo_uuid_version4_fromString, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Uuid_Version4, fromBytes, arginfo_uuid_version4_fromBytes, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Uuid_Version4, fromHex, arginfo_uuid_version4_fromHex, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
@@ -1,6 +1,7 @@
 #include "php.h"
 #include "zend_exceptions.h"
 #include "php_identifier.h"
+#include "ext/standard/sha1.h"
 #include <ctype.h>
 #include <string.h>
 
@@ -24,30 +25,24 @@ ZEND_END_ARG_INFO()
 
 
 
-/* Simple SHA-1 implementation for UUID v5 */
-static void simple_sha1(const unsigned char *input, size_t len, unsigned char output[20])
+/* SHA-1 states with each predefined namespace already absorbed */
+static PHP_SHA1_CTX php_identifier_uuid_v5_namespace_ctx[PHP_IDENTIFIER_UUID_NAMESPACE_COUNT];
+
+/* Hash namespace bytes + name, resuming from a precomputed state when possible */
+static void php_identifier_uuid_v5_hash(const unsigned char *namespace_bytes, const zend_string *name, unsigned char output[20])
 {
-    /* Use PHP's hash function */
-    zval function_name;
-    zval params[1];
-    zval result;
-
-    ZVAL_STRING(&function_name, "sha1");
-    ZVAL_STRINGL(&params[0], (char*)input, len);
-
-    if (call_user_function(NULL, NULL, &function_name, &result, 1, params) == SUCCESS) {
-        if (Z_TYPE(result) == IS_STRING && Z_STRLEN(result) == 40) {
-            /* Convert hex string to bytes */
-            for (int i = 0; i < 20; i++) {
-                char hex_byte[3] = {Z_STRVAL(result)[i*2], Z_STRVAL(result)[i*2+1], '\0'};
-                output[i] = (unsigned char)strtol(hex_byte, NULL, 16);
-            }
-        }
-        zval_ptr_dtor(&result);
+    PHP_SHA1_CTX context;
+    int index = php_identifier_uuid_namespace_index(namespace_bytes);
+
+    if (index >= 0) {
+        context = php_identifier_uuid_v5_namespace_ctx[index];
+    } else {
+        PHP_SHA1Init(&context);
+        PHP_SHA1Update(&context, namespace_bytes, 16);
     }
 
-    zval_ptr_dtor(&function_name);
-    zval_ptr_dtor(&params[0]);
+    PHP_SHA1Update(&context, (const unsigned char *)ZSTR_VAL(name), ZSTR_LEN(name));
+    PHP_SHA1Final(output, &context);
 }
 
 /* UUID Version 5 methods */
@@ -66,7 +61,7 @@ static void simple_sha1(const unsigned char *input, size_t len, unsigned char ou
  *
  * @example
  * // Generate deterministic UUID from namespace and name
- * $namespace = "6ba7b810-9dad-11d1-80b4-00c04fd430c8";
+ * $namespace = Uuid::namespaceDns();
  * $uuid = Version5::generate($namespace, "example.com");
  * echo $uuid->toString(); // Always the same for these inputs
  *
@@ -90,21 +85,9 @@ static PHP_METHOD(Identifier_Uuid_Version5, generate)
     /* Get namespace UUID bytes */
     php_identifier_bit128_obj *ns_intern = PHP_IDENTIFIER_BIT128_OBJ_P(namespace_uuid);
 
-    /* Create input for SHA-1: namespace bytes + name bytes */
-    size_t input_len = 16 + ZSTR_LEN(name);
-    unsigned char *input = emalloc(input_len);
-
-    /* Copy namespace UUID bytes */
-    memcpy(input, ns_intern->data, 16);
-
-    /* Copy name bytes */
-    memcpy(input + 16, ZSTR_VAL(name), ZSTR_LEN(name));
-
     /* Calculate SHA-1 hash */
     unsigned char hash[20]; /* SHA-1 produces 20 bytes */
-    simple_sha1(input, input_len, hash);
-
-    efree(input);
+    php_identifier_uuid_v5_hash(ns_intern->data, name, hash);
 
     /* Take first 16 bytes of hash for UUID */
     unsigned char uuid_bytes[16];
@@ -122,7 +105,7 @@ static PHP_METHOD(Identifier_Uuid_Version5, generate)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -152,43 +135,10 @@ static PHP_METHOD(Identifier_Uuid_Version5, fromString)
         Z_PARAM_STR(uuid_str)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Validate UUID string format: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx */
-    if (ZSTR_LEN(uuid_str) != 36) {
-        zend_throw_exception(zend_ce_exception, "Invalid UUID string length", 0);
-        RETURN_THROWS();
-    }
-
-    const char *str = ZSTR_VAL(uuid_str);
-
-    /* Check hyphens are in correct positions */
-    if (str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
-        zend_throw_exception(zend_ce_exception, "Invalid UUID string format", 0);
-        RETURN_THROWS();
-    }
-
-    /* Parse hex digits and convert to bytes */
+    /* Parse xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx */
     unsigned char uuid_bytes[16];
-    int byte_index = 0;
-
-    for (int i = 0; i < 36; i++) {
-        if (i == 8 || i == 13 || i == 18 || i == 23) {
-            continue; /* Skip hyphens */
-        }
-
-        char hex_char1 = str[i];
-        char hex_char2 = str[i + 1];
-
-        /* Validate hex characters */
-        if (!isxdigit(hex_char1) || !isxdigit(hex_char2)) {
-            zend_throw_exception(zend_ce_exception, "Invalid hex characters in UUID string", 0);
-            RETURN_THROWS();
-        }
-
-        /* Convert hex pair to byte */
-        char hex_pair[3] = {hex_char1, hex_char2, '\0'};
-        uuid_bytes[byte_index] = (unsigned char)strtol(hex_pair, NULL, 16);
-        byte_index++;
-        i++; /* Skip the second hex character */
+    if (!php_identifier_uuid_parse_string(uuid_str, uuid_bytes)) {
+        RETURN_THROWS();
     }
 
     /* Check if it's version 5 */
@@ -204,7 +154,7 @@ static PHP_METHOD(Identifier_Uuid_Version5, fromString)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -255,7 +205,7 @@ static PHP_METHOD(Identifier_Uuid_Version5, fromBytes)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -284,39 +234,12 @@ static PHP_METHOD(Identifier_Uuid_Version5, fromHex)
         Z_PARAM_STR(hex)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Convert hex to bytes first */
+    /* Parse 32 hex digits, dashes allowed */
     unsigned char bytes[16];
-    const char *hex_str = ZSTR_VAL(hex);
-    size_t hex_len = ZSTR_LEN(hex);
-
-    /* Remove dashes if present and validate length */
-    char clean_hex[33];
-    size_t clean_len = 0;
-
-    for (size_t i = 0; i < hex_len && clean_len < 32; i++) {
-        char c = hex_str[i];
-        if (c != '-') {
-            if (!isxdigit(c)) {
-                zend_throw_exception(zend_ce_exception, "Invalid hexadecimal character in UUID", 0);
-                RETURN_THROWS();
-            }
-            clean_hex[clean_len++] = tolower(c);
-        }
-    }
-
-    if (clean_len != 32) {
-        zend_throw_exception(zend_ce_exception, "UUID hex string must be exactly 32 characters (excluding dashes)", 0);
+    if (!php_identifier_parse_hex_string(hex, "UUID", bytes)) {
         RETURN_THROWS();
     }
 
-    clean_hex[32] = '\0';
-
-    /* Convert hex string to bytes */
-    for (int i = 0; i < 16; i++) {
-        char hex_byte[3] = {clean_hex[i*2], clean_hex[i*2+1], '\0'};
-        bytes[i] = (unsigned char)strtol(hex_byte, NULL, 16);
-    }
-
     /* Check if it's version 5 */
     int version = (bytes[6] >> 4) & 0x0F;
     if (version != 5) {
@@ -330,7 +253,7 @@ static PHP_METHOD(Identifier_Uuid_Version5, fromHex)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, bytes, 16);
+    php_identifier_bit128_fill(intern, bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -352,4 +275,10 @@ void php_identifier_uuid_version5_register_class(void)
     INIT_NS_CLASS_ENTRY(ce, "Identifier\\Uuid", "Version5", php_identifier_uuid_version5_methods);
     php_identifier_uuid_version5_ce = zend_register_internal_class_ex(&ce, php_identifier_uuid_ce);
     php_identifier_uuid_version5_ce->ce_flags |= ZEND_ACC_FINAL;
+
+    /* Absorb the predefined namespaces once; the states are read-only afterwards */
+    for (int i = 0; i < PHP_IDENTIFIER_UUID_NAMESPACE_COUNT; i++) {
+        PHP_SHA1Init(&php_identifier_uuid_v5_namespace_ctx[i]);
+        PHP_SHA1Update(&php_identifier_uuid_v5_namespace_ctx[i], php_identifier_uuid_namespaces[i], 16);
+    }
 }
@@ -21,6 +21,12 @@ ZEND_BEGIN_ARG_WITH_RETURN_OBJ_INFO_EX(arginfo_uuid_version7_fromHex, 0, 1, Iden
     ZEND_ARG_TYPE_INFO(0, hex, IS_STRING, 0)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_MASK_EX(arginfo_uuid_version7_generateBatch, 0, 1, MAY_BE_ARRAY|MAY_BE_STRING)
+    ZEND_ARG_TYPE_INFO(0, count, IS_LONG, 0)
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, format, IS_LONG, 0, "Identifier\\Bit128::BATCH_OBJECTS")
+    ZEND_ARG_TYPE_INFO_WITH_DEFAULT_VALUE(0, threads, IS_LONG, 0, "1")
+ZEND_END_ARG_INFO()
+
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_uuid_version7_getTimestamp, 0, 0, IS_LONG, 0)
 ZEND_END_ARG_INFO()
 
@@ -33,6 +39,31 @@ ZEND_END_ARG_INFO()
 ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_uuid_version7_getRandomB, 0, 0, IS_STRING, 0)
 ZEND_END_ARG_INFO()
 
+ZEND_BEGIN_ARG_WITH_RETURN_TYPE_INFO_EX(arginfo_uuid_version7_getWorkerId, 0, 0, IS_LONG, 1)
+ZEND_END_ARG_INFO()
+
+/* Fill 16 bytes with a version 7 UUID for timestamp_ms and system randomness */
+void php_identifier_uuid_v7_fill(unsigned char *bytes, uint64_t timestamp_ms)
+{
+    php_identifier_generate_random_bytes(&bytes[6], 10);
+
+    /* Set the 48-bit timestamp in big-endian format (bytes 0-5) */
+    bytes[0] = (timestamp_ms >> 40) & 0xFF;
+    bytes[1] = (timestamp_ms >> 32) & 0xFF;
+    bytes[2] = (timestamp_ms >> 24) & 0xFF;
+    bytes[3] = (timestamp_ms >> 16) & 0xFF;
+    bytes[4] = (timestamp_ms >> 8) & 0xFF;
+    bytes[5] = timestamp_ms & 0xFF;
+
+    /* Set version bits: version 7 (0111) in the most significant 4 bits of byte 6 */
+    bytes[6] = (bytes[6] & 0x0F) | 0x70;
+
+    /* Set variant bits: variant 10 in the most significant 2 bits of byte 8 */
+    bytes[8] = (bytes[8] & 0x3F) | 0x80;
+
+    php_identifier_worker_stamp_v7(bytes);
+}
+
 /* UUID Version 7 methods */
 
 /**
@@ -123,7 +154,9 @@ static PHP_METHOD(Identifier_Uuid_Version7, generate)
         zval_ptr_dtor(&random_function);
     } else {
         /* Use system time and random */
-        timestamp_ms = php_identifier_get_timestamp_ms();
+        if (php_identifier_get_timestamp_ms(&timestamp_ms) == FAILURE) {
+            RETURN_THROWS();
+        }
         php_identifier_generate_random_bytes(&uuid_bytes[6], 10);
     }
 
@@ -141,17 +174,210 @@ static PHP_METHOD(Identifier_Uuid_Version7, generate)
     /* Set variant bits: variant 10 in the most significant 2 bits of byte 8 */
     uuid_bytes[8] = (uuid_bytes[8] & 0x3F) | 0x80;
 
+    php_identifier_worker_stamp_v7(uuid_bytes);
+
     /* Create UUID object */
     zval uuid;
     object_init_ex(&uuid, php_identifier_uuid_version7_ce);
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
 
+/* Fill count version 7 UUIDs from one block of entropy. Within a millisecond
+ * the 74-bit rand_a/rand_b field steps forward by a random 32-bit amount
+ * (RFC 9562 section 6.2, method 2), so the batch is strictly ascending.
+ * Returns FAILURE with an exception set when a clock read throws. */
+static zend_result php_identifier_uuid_v7_fill_batch(unsigned char *bytes, size_t count)
+{
+    uint64_t timestamp_ms = 0;
+    uint64_t rand_a = 0;
+    uint64_t rand_b = 0;
+    uint64_t rand_a_max = php_identifier_worker_v7_max();
+
+    php_identifier_generate_random_bytes(bytes, count * 16);
+
+    for (size_t i = 0; i < count; i++, bytes += 16) {
+        bool fresh = (i == 0);
+
+        /* Sample the clock once per stride; never step backwards inside the batch */
+        if ((i & (PHP_IDENTIFIER_BATCH_CLOCK_STRIDE - 1)) == 0) {
+            uint64_t now;
+            if (php_identifier_get_timestamp_ms(&now) == FAILURE) {
+                return FAILURE;
+            }
+            if (now > timestamp_ms) {
+                timestamp_ms = now;
+                fresh = true;
+            }
+        }
+
+        if (!fresh) {
+            uint64_t step = (((uint64_t)bytes[12] << 24) | ((uint64_t)bytes[13] << 16) |
+                             ((uint64_t)bytes[14] << 8) | (uint64_t)bytes[15]) + 1;
+
+            rand_b += step;
+            if (rand_b >> 62) {
+                rand_b &= (UINT64_C(1) << 62) - 1;
+                rand_a++;
+            }
+            if (rand_a > rand_a_max) {
+                /* Counter exhausted: borrow the next millisecond */
+                timestamp_ms++;
+                fresh = true;
+            }
+        }
+
+        if (fresh) {
+            php_identifier_worker_stamp_v7(bytes);
+            rand_a = ((uint64_t)(bytes[6] & 0x0F) << 8) | bytes[7];
+            rand_b = (uint64_t)(bytes[8] & 0x3F) << 56;
+            for (int j = 9; j < 16; j++) {
+                rand_b |= (uint64_t)bytes[j] << ((15 - j) * 8);
+            }
+        }
+
+        bytes[0] = (timestamp_ms >> 40) & 0xFF;
+        bytes[1] = (timestamp_ms >> 32) & 0xFF;
+        bytes[2] = (timestamp_ms >> 24) & 0xFF;
+        bytes[3] = (timestamp_ms >> 16) & 0xFF;
+        bytes[4] = (timestamp_ms >> 8) & 0xFF;
+        bytes[5] = timestamp_ms & 0xFF;
+        bytes[6] = 0x70 | ((rand_a >> 8) & 0x0F);
+        bytes[7] = rand_a & 0xFF;
+        bytes[8] = 0x80 | ((rand_b >> 56) & 0x3F);
+        for (int j = 9; j < 16; j++) {
+            bytes[j] = (rand_b >> ((15 - j) * 8)) & 0xFF;
+        }
+    }
+
+    return SUCCESS;
+}
+
+/* Shared by the worker slices of one threaded batch */
+typedef struct _php_identifier_uuid_v7_batch {
+    uint64_t timestamp_ms;
+    uint64_t counter;    /* 40-bit random start of the batch counter */
+} php_identifier_uuid_v7_batch;
+
+/* Worker slice for a threaded batch. The whole batch shares one timestamp;
+ * the 74-bit rand_a/rand_b field is a 42-bit counter (counter + item index)
+ * above 32 random bits, so slices are ascending without coordination. */
+static bool php_identifier_uuid_v7_fill_slice(unsigned char *bytes, size_t start, size_t count, const void *arg)
+{
+    const php_identifier_uuid_v7_batch *batch = arg;
+    uint64_t timestamp_ms = batch->timestamp_ms;
+
+    if (!php_identifier_batch_random(bytes, count * 16)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++, bytes += 16) {
+        uint64_t counter = batch->counter + start + i;
+
+        bytes[0] = (timestamp_ms >> 40) & 0xFF;
+        bytes[1] = (timestamp_ms >> 32) & 0xFF;
+        bytes[2] = (timestamp_ms >> 24) & 0xFF;
+        bytes[3] = (timestamp_ms >> 16) & 0xFF;
+        bytes[4] = (timestamp_ms >> 8) & 0xFF;
+        bytes[5] = timestamp_ms & 0xFF;
+        bytes[6] = 0x70 | ((counter >> 38) & 0x0F);
+        bytes[7] = (counter >> 30) & 0xFF;
+        bytes[8] = 0x80 | ((counter >> 24) & 0x3F);
+        bytes[9] = (counter >> 16) & 0xFF;
+        bytes[10] = (counter >> 8) & 0xFF;
+        bytes[11] = counter & 0xFF;
+        /* bytes 12-15 keep their random value */
+    }
+
+    return true;
+}
+
+/**
+ * Generate many UUIDs version 7 in one call
+ *
+ * Draws the entropy for the whole batch in a single block and reads the
+ * clock once per 256 UUIDs rather than once per UUID. UUIDs sharing a
+ * millisecond are ordered by a randomly stepped counter, so the batch is
+ * strictly ascending. With BATCH_BINARY the result is one string of
+ * $count * 16 bytes.
+ *
+ * With $threads > 1, large batches are split into contiguous slices filled
+ * in parallel. The batch then shares one timestamp and each slice takes its
+ * own range of the sub-millisecond counter, so ordering is preserved.
+ * Builds without thread support ignore the option.
+ *
+ * @param int $count Number of UUIDs to generate
+ * @param int $format One of Bit128::BATCH_OBJECTS, BATCH_STRINGS or BATCH_BINARY
+ * @param int $threads Maximum number of threads to fill the batch with
+ * @return array|string List of Version7 objects or strings, or the packed bytes
+ * @throws Exception If count is negative, format is unknown or threads is out of range
+ *
+ * @example
+ * $ids = Version7::generateBatch(50000, Version7::BATCH_STRINGS);
+ * $ids[0] < $ids[1]; // true
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid_Version7, generateBatch)
+{
+    zend_long count;
+    zend_long format = PHP_IDENTIFIER_BATCH_OBJECTS;
+    zend_long threads_arg = 1;
+
+    ZEND_PARSE_PARAMETERS_START(1, 3)
+        Z_PARAM_LONG(count)
+        Z_PARAM_OPTIONAL
+        Z_PARAM_LONG(format)
+        Z_PARAM_LONG(threads_arg)
+    ZEND_PARSE_PARAMETERS_END();
+
+    zend_string *packed = php_identifier_batch_alloc(count, format);
+    if (!packed) {
+        RETURN_THROWS();
+    }
+
+    uint32_t threads = php_identifier_batch_threads(threads_arg, (size_t)count);
+
+    if (threads == 0) {
+        zend_string_efree(packed);
+        RETURN_THROWS();
+    } else if (threads > 1) {
+        php_identifier_uuid_v7_batch batch;
+        unsigned char start[5];
+
+        /* A 40-bit start leaves 2^41 counter values of headroom */
+        php_identifier_generate_random_bytes(start, sizeof(start));
+        if (php_identifier_get_timestamp_ms(&batch.timestamp_ms) == FAILURE) {
+            zend_string_efree(packed);
+            RETURN_THROWS();
+        }
+        batch.counter = ((uint64_t)start[0] << 32) | ((uint64_t)start[1] << 24) |
+                        ((uint64_t)start[2] << 16) | ((uint64_t)start[3] << 8) | (uint64_t)start[4];
+
+        if (php_identifier_worker_bits()) {
+            /* The worker ID takes the top of the 42-bit counter; shrink the
+             * start so the batch still cannot carry into it */
+            uint32_t bits = php_identifier_worker_bits();
+            batch.counter = (batch.counter >> (bits + 1)) | ((uint64_t)php_identifier_worker_id() << (42 - bits));
+        }
+
+        if (php_identifier_batch_parallel((unsigned char *)ZSTR_VAL(packed), (size_t)count, threads,
+                php_identifier_uuid_v7_fill_slice, &batch) == FAILURE) {
+            zend_string_efree(packed);
+            RETURN_THROWS();
+        }
+    } else if (php_identifier_uuid_v7_fill_batch((unsigned char *)ZSTR_VAL(packed), (size_t)count) == FAILURE) {
+        zend_string_efree(packed);
+        RETURN_THROWS();
+    }
+
+    php_identifier_batch_return(return_value, packed, php_identifier_uuid_version7_ce, format, PHP_IDENTIFIER_FORMAT_UUID);
+}
+
 /**
  * Get the timestamp from UUID version 7
  *
@@ -214,43 +440,10 @@ static PHP_METHOD(Identifier_Uuid_Version7, fromString)
         Z_PARAM_STR(uuid_str)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Validate UUID string format: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx */
-    if (ZSTR_LEN(uuid_str) != 36) {
-        zend_throw_exception(zend_ce_exception, "Invalid UUID string length", 0);
-        RETURN_THROWS();
-    }
-
-    const char *str = ZSTR_VAL(uuid_str);
-
-    /* Check hyphens are in correct positions */
-    if (str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
-        zend_throw_exception(zend_ce_exception, "Invalid UUID string format", 0);
-        RETURN_THROWS();
-    }
-
-    /* Parse hex digits and convert to bytes */
+    /* Parse xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx */
     unsigned char uuid_bytes[16];
-    int byte_index = 0;
-
-    for (int i = 0; i < 36; i++) {
-        if (i == 8 || i == 13 || i == 18 || i == 23) {
-            continue; /* Skip hyphens */
-        }
-
-        char hex_char1 = str[i];
-        char hex_char2 = str[i + 1];
-
-        /* Validate hex characters */
-        if (!isxdigit(hex_char1) || !isxdigit(hex_char2)) {
-            zend_throw_exception(zend_ce_exception, "Invalid hex characters in UUID string", 0);
-            RETURN_THROWS();
-        }
-
-        /* Convert hex pair to byte */
-        char hex_pair[3] = {hex_char1, hex_char2, '\0'};
-        uuid_bytes[byte_index] = (unsigned char)strtol(hex_pair, NULL, 16);
-        byte_index++;
-        i++; /* Skip the second hex character */
+    if (!php_identifier_uuid_parse_string(uuid_str, uuid_bytes)) {
+        RETURN_THROWS();
     }
 
     /* Check if it's version 7 */
@@ -266,7 +459,7 @@ static PHP_METHOD(Identifier_Uuid_Version7, fromString)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -317,7 +510,7 @@ static PHP_METHOD(Identifier_Uuid_Version7, fromBytes)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, uuid_bytes, 16);
+    php_identifier_bit128_fill(intern, uuid_bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -346,39 +539,12 @@ static PHP_METHOD(Identifier_Uuid_Version7, fromHex)
         Z_PARAM_STR(hex)
     ZEND_PARSE_PARAMETERS_END();
 
-    /* Convert hex to bytes first */
+    /* Parse 32 hex digits, dashes allowed */
     unsigned char bytes[16];
-    const char *hex_str = ZSTR_VAL(hex);
-    size_t hex_len = ZSTR_LEN(hex);
-
-    /* Remove dashes if present and validate length */
-    char clean_hex[33];
-    size_t clean_len = 0;
-
-    for (size_t i = 0; i < hex_len && clean_len < 32; i++) {
-        char c = hex_str[i];
-        if (c != '-') {
-            if (!isxdigit(c)) {
-                zend_throw_exception(zend_ce_exception, "Invalid hexadecimal character in UUID", 0);
-                RETURN_THROWS();
-            }
-            clean_hex[clean_len++] = tolower(c);
-        }
-    }
-
-    if (clean_len != 32) {
-        zend_throw_exception(zend_ce_exception, "UUID hex string must be exactly 32 characters (excluding dashes)", 0);
+    if (!php_identifier_parse_hex_string(hex, "UUID", bytes)) {
         RETURN_THROWS();
     }
 
-    clean_hex[32] = '\0';
-
-    /* Convert hex string to bytes */
-    for (int i = 0; i < 16; i++) {
-        char hex_byte[3] = {clean_hex[i*2], clean_hex[i*2+1], '\0'};
-        bytes[i] = (unsigned char)strtol(hex_byte, NULL, 16);
-    }
-
     /* Check if it's version 7 */
     int version = (bytes[6] >> 4) & 0x0F;
     if (version != 7) {
@@ -392,7 +558,7 @@ static PHP_METHOD(Identifier_Uuid_Version7, fromHex)
 
     /* Set the UUID bytes */
     php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(&uuid);
-    memcpy(intern->data, bytes, 16);
+    php_identifier_bit128_fill(intern, bytes);
 
     RETURN_ZVAL(&uuid, 1, 0);
 }
@@ -494,9 +660,40 @@ static PHP_METHOD(Identifier_Uuid_Version7, getRandomB)
     RETURN_LONG(rand_b);
 }
 
+/**
+ * Get the worker ID stored in rand_a
+ *
+ * With identifier.worker_bits set, the top bits of rand_a hold the ID of
+ * the worker that generated the UUID, so rows can be routed back to their
+ * producer. The bits are read with the width configured for this process.
+ *
+ * @return int|null Worker ID, or null if identifier.worker_bits is 0
+ *
+ * @example
+ * // identifier.worker_bits=8, identifier.worker_id=42
+ * echo Version7::generate()->getWorkerId(); // 42
+ *
+ * @since 0.3.0
+ */
+static PHP_METHOD(Identifier_Uuid_Version7, getWorkerId)
+{
+    ZEND_PARSE_PARAMETERS_NONE();
+
+    uint32_t bits = php_identifier_worker_bits();
+    if (bits == 0) {
+        RETURN_NULL();
+    }
+
+    php_identifier_bit128_obj *intern = PHP_IDENTIFIER_BIT128_OBJ_P(getThis());
+    uint32_t rand_a = ((uint32_t)(intern->data[6] & 0x0F) << 8) | intern->data[7];
+
+    RETURN_LONG(rand_a >> (12 - bits));
+}
+
 /* UUID Version 7 method entries */
 static const zend_function_entry php_identifier_uuid_version7_methods[] = {
     PHP_ME(Identifier_Uuid_Version7, generate, arginfo_uuid_version7_generate, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
+    PHP_ME(Identifier_Uuid_Version7, generateBatch, arginfo_uuid_version7_generateBatch, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Uuid_Version7, fromString, arginfo_uuid_version7_fromString, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Uuid_Version7, fromBytes, arginfo_uuid_version7_fromBytes, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
     PHP_ME(Identifier_Uuid_Version7, fromHex, arginfo_uuid_version7_fromHex, ZEND_ACC_PUBLIC | ZEND_ACC_STATIC)
@@ -504,6 +701,7 @@ static const zend_function_entry php_identifier_uuid_version7_methods[] = {
     PHP_ME(Identifier_Uuid_Version7, getRandomBytes, arginfo_uuid_version7_getRandomBytes, ZEND_ACC_PUBLIC)
     PHP_ME(Identifier_Uuid_Version7, getRandomA, arginfo_uuid_version7_getRandomA, ZEND_ACC_PUBLIC)
     PHP_ME(Identifier_Uuid_Version7, getRandomB, arginfo_uuid_version7_getRandomB, ZEND_ACC_PUBLIC)
+    PHP_ME(Identifier_Uuid_Version7, getWorkerId, arginfo_uuid_version7_getWorkerId, ZEND_ACC_PUBLIC)
     PHP_FE_END
 };
 
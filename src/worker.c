@@ -0,0 +1,200 @@
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "php.h"
+#include "php_identifier.h"
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef PHP_WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+/* Recompute a hashed worker ID in forked children: a process manager forks
+ * its workers after MINIT, and they must not inherit the parent's pid hash */
+#if defined(HAVE_PTHREAD_H) && !defined(PHP_WIN32)
+# define PHP_IDENTIFIER_WORKER_ATFORK 1
+# include <pthread.h>
+#endif
+
+/* Fixed for the process after MINIT (identifier.worker_bits is SYSTEM-only) */
+static uint32_t php_identifier_worker_bits_value = 0;
+static uint32_t php_identifier_worker_id_value = 0;
+static bool php_identifier_worker_hashed = false;
+
+/* Highest head the worker may use: the first 16 randomness bits of a ULID
+ * and the 12-bit rand_a of a UUIDv7 */
+static uint32_t php_identifier_worker_ulid_head_max = 0xFFFF;
+static uint32_t php_identifier_worker_rand_a_max = 0xFFF;
+
+/* Parse a worker ID that must fit in bits; false if it does not */
+static bool php_identifier_worker_parse(const char *value, uint32_t bits, uint32_t *id)
+{
+    char *end;
+    zend_long parsed;
+
+    if (!value || !*value) {
+        return false;
+    }
+
+    parsed = ZEND_STRTOL(value, &end, 10);
+    if (*end != '\0' || parsed < 0 || parsed >= ((zend_long)1 << bits)) {
+        return false;
+    }
+
+    *id = (uint32_t)parsed;
+    return true;
+}
+
+/* FNV-1a of hostname and pid, folded to bits */
+static uint32_t php_identifier_worker_hash(uint32_t bits)
+{
+    char host[256] = {0};
+    uint32_t hash = 2166136261U;
+    zend_long pid = (zend_long)getpid();
+
+#ifdef PHP_WIN32
+    const char *name = getenv("COMPUTERNAME");
+    if (name) {
+        strncpy(host, name, sizeof(host) - 1);
+    }
+#else
+    gethostname(host, sizeof(host) - 1);
+#endif
+
+    for (const char *p = host; *p; p++) {
+        hash = (hash ^ (unsigned char)*p) * 16777619U;
+    }
+    for (size_t i = 0; i < sizeof(pid); i++) {
+        hash = (hash ^ ((pid >> (i * 8)) & 0xFF)) * 16777619U;
+    }
+
+    return (hash ^ (hash >> 16)) & ((1U << bits) - 1);
+}
+
+/* Derive the range limits from the current bits and ID */
+static void php_identifier_worker_apply(uint32_t id)
+{
+    uint32_t bits = php_identifier_worker_bits_value;
+
+    php_identifier_worker_id_value = id;
+    php_identifier_worker_ulid_head_max = ((id + 1) << (16 - bits)) - 1;
+    php_identifier_worker_rand_a_max = ((id + 1) << (12 - bits)) - 1;
+}
+
+#ifdef PHP_IDENTIFIER_WORKER_ATFORK
+static void php_identifier_worker_atfork_child(void)
+{
+    if (php_identifier_worker_hashed) {
+        php_identifier_worker_apply(php_identifier_worker_hash(php_identifier_worker_bits_value));
+    }
+}
+#endif
+
+/* Resolve the worker ID in MINIT: identifier.worker_id, then the
+ * IDENTIFIER_WORKER_ID environment variable, then a hash of hostname and pid */
+void php_identifier_worker_startup(zend_long bits, const char *id)
+{
+    uint32_t value = 0;
+
+    php_identifier_worker_bits_value = 0;
+    php_identifier_worker_hashed = false;
+    php_identifier_worker_apply(0);
+
+    if (bits == 0) {
+        return;
+    }
+
+    if (bits < 0 || bits > PHP_IDENTIFIER_WORKER_MAX_BITS) {
+        php_error_docref(NULL, E_WARNING, "identifier.worker_bits must be between 0 and %d, worker partitioning disabled",
+            PHP_IDENTIFIER_WORKER_MAX_BITS);
+        return;
+    }
+
+    php_identifier_worker_bits_value = (uint32_t)bits;
+
+    if (id && *id) {
+        if (php_identifier_worker_parse(id, (uint32_t)bits, &value)) {
+            php_identifier_worker_apply(value);
+            return;
+        }
+        php_error_docref(NULL, E_WARNING, "identifier.worker_id \"%s\" does not fit in %d bits, ignoring it", id, (int)bits);
+    }
+
+    id = getenv("IDENTIFIER_WORKER_ID");
+    if (id && *id) {
+        if (php_identifier_worker_parse(id, (uint32_t)bits, &value)) {
+            php_identifier_worker_apply(value);
+            return;
+        }
+        php_error_docref(NULL, E_WARNING, "IDENTIFIER_WORKER_ID \"%s\" does not fit in %d bits, ignoring it", id, (int)bits);
+    }
+
+    php_identifier_worker_hashed = true;
+    php_identifier_worker_apply(php_identifier_worker_hash((uint32_t)bits));
+
+#ifdef PHP_IDENTIFIER_WORKER_ATFORK
+    static bool registered = false;
+    if (!registered) {
+        pthread_atfork(NULL, NULL, php_identifier_worker_atfork_child);
+        registered = true;
+    }
+#endif
+}
+
+/* Number of high randomness bits holding the worker ID, 0 if disabled */
+uint32_t php_identifier_worker_bits(void)
+{
+    return php_identifier_worker_bits_value;
+}
+
+/* Worker ID of this process */
+uint32_t php_identifier_worker_id(void)
+{
+    return php_identifier_worker_id_value;
+}
+
+/* Write the worker ID into the top bits of 10 bytes of ULID randomness */
+void php_identifier_worker_stamp_ulid(unsigned char *randomness)
+{
+    uint32_t bits = php_identifier_worker_bits_value;
+
+    if (bits) {
+        uint32_t head = ((uint32_t)randomness[0] << 8) | randomness[1];
+
+        head = (head & (0xFFFFU >> bits)) | (php_identifier_worker_id_value << (16 - bits));
+        randomness[0] = (head >> 8) & 0xFF;
+        randomness[1] = head & 0xFF;
+    }
+}
+
+/* Write the worker ID into the top bits of rand_a of a UUIDv7 (bytes 6-7),
+ * keeping the version nibble */
+void php_identifier_worker_stamp_v7(unsigned char *bytes)
+{
+    uint32_t bits = php_identifier_worker_bits_value;
+
+    if (bits) {
+        uint32_t rand_a = ((uint32_t)(bytes[6] & 0x0F) << 8) | bytes[7];
+
+        rand_a = (rand_a & (0xFFFU >> bits)) | (php_identifier_worker_id_value << (12 - bits));
+        bytes[6] = (bytes[6] & 0xF0) | ((rand_a >> 8) & 0x0F);
+        bytes[7] = rand_a & 0xFF;
+    }
+}
+
+/* Highest first-16-bit value of ULID randomness inside this worker's
+ * partition; counting past it is an overflow */
+uint32_t php_identifier_worker_ulid_max(void)
+{
+    return php_identifier_worker_ulid_head_max;
+}
+
+/* Highest UUIDv7 rand_a inside this worker's partition */
+uint32_t php_identifier_worker_v7_max(void)
+{
+    return php_identifier_worker_rand_a_max;
+}
@@ -68,6 +68,13 @@ namespace Identifier
      */
     class Bit128 implements \Stringable
     {
+        /** generateBatch() returns a list of objects */
+        public const BATCH_OBJECTS = 0;
+        /** generateBatch() returns a list of canonical strings */
+        public const BATCH_STRINGS = 1;
+        /** generateBatch() returns one string of count * 16 packed bytes */
+        public const BATCH_BINARY = 2;
+
         /**
          * Create a new 128-bit identifier from bytes
          * Constructs a new Bit128 instance from exactly 16 bytes of binary data.
@@ -252,6 +259,93 @@ namespace Identifier
          */
         public function __toString(): string {}
 
+        /**
+         * Serialize the identifier
+         * Returns the raw 16 bytes instead of the default property table, so
+         * serialize() output stays compact. The class name recorded by serialize()
+         * restores the exact subclass (Version1-7, Ulid, ...).
+         * 
+         * @return array The 16-byte payload at index 0
+         * 
+         * @example
+         * ```php
+         * $payload = serialize(Ulid::generate());
+         * $ulid = unserialize($payload); // Identifier\Ulid
+         * ```
+         * @since 0.3.0
+         */
+        public function __serialize(): array {}
+
+        /**
+         * Restore a serialized identifier
+         * Copies the 16-byte payload back without going through the string parsers.
+         * 
+         * @param array $data Data produced by __serialize()
+         * @throws Exception If the data does not hold a 16-byte payload
+         * @since 0.3.0
+         */
+        public function __unserialize(array $data): void {}
+
+        /**
+         * Recreate an identifier exported with var_export()
+         * Accepts the 'hex' entry written by var_export(), or a raw 16-byte 'bytes'
+         * entry. The object is created as the class the method is called on.
+         * 
+         * @param array $properties Array with a 'hex' or 'bytes' entry
+         * @return static New identifier instance
+         * @throws Exception If neither entry holds a valid payload
+         * 
+         * @example
+         * ```php
+         * $code = var_export(Ulid::generate(), true);
+         * $ulid = eval("return $code;");
+         * ```
+         * @since 0.3.0
+         */
+        public static function __set_state(array $properties): static {}
+
+        /**
+         * Sort an array of identifiers in place
+         * Sorts by the 16-byte binary value using a native radix sort, which is far
+         * faster than usort() with a compare() callback on large arrays. The array is
+         * re-indexed as a list. With $byTime, Version1 UUIDs are ordered by their
+         * reassembled timestamp (their raw byte order is not time order); all other
+         * identifiers are already time-ordered by their bytes.
+         * 
+         * @param array $ids Array of Bit128 instances, sorted in place
+         * @param bool $descending Sort from highest to lowest
+         * @param bool $byTime Order Version1 UUIDs by timestamp
+         * @throws Exception If an element is not a Bit128 instance
+         * 
+         * @example
+         * ```php
+         * $ids = [Version4::generate(), Version4::generate(), Version4::generate()];
+         * Bit128::sortArray($ids);
+         * var_dump($ids[0] <= $ids[1]); // bool(true)
+         * ```
+         * @since 0.3.0
+         */
+        public static function sortArray(array &$ids, bool $descending = false, bool $byTime = false): void {}
+
+        /**
+         * Find an identifier in a sorted list
+         * Performs a binary search over a list sorted in ascending byte order, such
+         * as the output of sortArray() without $byTime.
+         * 
+         * @param array $sorted List of Bit128 instances in ascending order
+         * @param Bit128 $needle The identifier to look for
+         * @return int|false Index of a matching element, or false if not found
+         * @throws Exception If the array is not a list or holds non-Bit128 values
+         * 
+         * @example
+         * ```php
+         * Bit128::sortArray($ids);
+         * $index = Bit128::binarySearch($ids, $needle);
+         * ```
+         * @since 0.3.0
+         */
+        public static function binarySearch(array $sorted, \Identifier\Bit128 $needle): int|false {}
+
     }
 
     /**
@@ -263,6 +357,15 @@ namespace Identifier
      */
     class Uuid extends \Identifier\Bit128 implements \Stringable
     {
+        /** RFC 9562 namespace for fully qualified domain names */
+        public const NAMESPACE_DNS = '6ba7b810-9dad-11d1-80b4-00c04fd430c8';
+        /** RFC 9562 namespace for URLs */
+        public const NAMESPACE_URL = '6ba7b811-9dad-11d1-80b4-00c04fd430c8';
+        /** RFC 9562 namespace for ISO object identifiers */
+        public const NAMESPACE_OID = '6ba7b812-9dad-11d1-80b4-00c04fd430c8';
+        /** RFC 9562 namespace for X.500 distinguished names */
+        public const NAMESPACE_X500 = '6ba7b814-9dad-11d1-80b4-00c04fd430c8';
+
         /**
          * Get the UUID version number
          * Returns the version number stored in bits 12-15 of the time_hi_and_version field.
@@ -353,265 +456,1538 @@ namespace Identifier
          * $uuid = Uuid::fromBytes($bytes);
          * echo $uuid->getVersion(); // 4
          * ```
-         * @since 0.1.0
+         * @since 0.1.0
+         */
+        public static function fromBytes(string $bytes): \Identifier\Uuid {}
+
+        /**
+         * Create a UUID from a hexadecimal string
+         * Parses a 32-character hexadecimal string (with or without hyphens) and
+         * creates a UUID. Automatically detects the version and returns the appropriate
+         * version-specific subclass. Case-insensitive.
+         * 
+         * @param string $hex 32-character hexadecimal string (with or without hyphens)
+         * @return Uuid UUID instance of the appropriate version
+         * @throws Exception If hex string is invalid
+         * 
+         * @example
+         * ```php
+         * $uuid = Uuid::fromHex('550e8400e29b41d4a716446655440000');
+         * echo $uuid->toString(); // "550e8400-e29b-41d4-a716-446655440000"
+         * // Also works with hyphens
+         * $uuid2 = Uuid::fromHex('550e8400-e29b-41d4-a716-446655440000');
+         * ```
+         * @since 0.1.0
+         */
+        public static function fromHex(string $hex): \Identifier\Uuid {}
+
+        /**
+         * Check if this UUID is the nil UUID
+         * Returns true if all 128 bits are zero (00000000-0000-0000-0000-000000000000).
+         * The nil UUID is defined in RFC 4122 and represents a special "null" value.
+         * 
+         * @return bool True if this is the nil UUID, false otherwise
+         * 
+         * @example
+         * ```php
+         * $nil = Uuid::nil();
+         * var_dump($nil->isNil()); // bool(true)
+         * $uuid = Version4::generate();
+         * var_dump($uuid->isNil()); // bool(false)
+         * ```
+         * @since 0.1.0
+         */
+        public function isNil(): bool {}
+
+        /**
+         * Create the nil UUID
+         * Returns a UUID with all bits set to zero (00000000-0000-0000-0000-000000000000).
+         * This is a special UUID defined in RFC 4122 that represents a null or empty value.
+         * The instance is created once and shared for the rest of the request.
+         * 
+         * @return Uuid The nil UUID instance
+         * 
+         * @example
+         * ```php
+         * $nil = Uuid::nil();
+         * echo $nil->toString(); // "00000000-0000-0000-0000-000000000000"
+         * var_dump($nil->isNil()); // bool(true)
+         * ```
+         * @since 0.1.0
+         */
+        public static function nil(): \Identifier\Uuid {}
+
+        /**
+         * Check if this UUID is the max UUID
+         * Returns true if all 128 bits are set to 1 (ffffffff-ffff-ffff-ffff-ffffffffffff).
+         * The max UUID is defined in RFC 4122 and represents the maximum possible UUID value.
+         * 
+         * @return bool True if this is the max UUID, false otherwise
+         * 
+         * @example
+         * ```php
+         * $max = Uuid::max();
+         * var_dump($max->isMax()); // bool(true)
+         * $uuid = Version4::generate();
+         * var_dump($uuid->isMax()); // bool(false)
+         * ```
+         * @since 0.1.0
+         */
+        public function isMax(): bool {}
+
+        /**
+         * Create the max UUID
+         * Returns a UUID with all bits set to 1 (ffffffff-ffff-ffff-ffff-ffffffffffff).
+         * This is a special UUID defined in RFC 4122 that represents the maximum possible UUID value.
+         * The instance is created once and shared for the rest of the request.
+         * 
+         * @return Uuid The max UUID instance
+         * 
+         * @example
+         * ```php
+         * $max = Uuid::max();
+         * echo $max->toString(); // "ffffffff-ffff-ffff-ffff-ffffffffffff"
+         * var_dump($max->isMax()); // bool(true)
+         * ```
+         * @since 0.1.0
+         */
+        public static function max(): \Identifier\Uuid {}
+
+        /**
+         * Get the DNS namespace UUID
+         * Returns the RFC 9562 namespace for fully qualified domain names
+         * (6ba7b810-9dad-11d1-80b4-00c04fd430c8). The instance is shared for the
+         * rest of the request, and Version3/Version5 generation in this namespace
+         * starts from a precomputed hash state.
+         * 
+         * @return Version1 The DNS namespace UUID
+         * 
+         * @example
+         * ```php
+         * $uuid = Version5::generate(Uuid::namespaceDns(), "example.com");
+         * echo $uuid; // "cfbff0d1-9375-5685-968c-48ce8b15ae17"
+         * ```
+         * @since 0.3.0
+         */
+        public static function namespaceDns(): \Identifier\Uuid\Version1 {}
+
+        /**
+         * Get the URL namespace UUID
+         * Returns the RFC 9562 namespace for URLs (6ba7b811-9dad-11d1-80b4-00c04fd430c8).
+         * 
+         * @return Version1 The URL namespace UUID
+         * 
+         * @example
+         * ```php
+         * $uuid = Version5::generate(Uuid::namespaceUrl(), "https://example.com/");
+         * ```
+         * @since 0.3.0
+         */
+        public static function namespaceUrl(): \Identifier\Uuid\Version1 {}
+
+        /**
+         * Get the OID namespace UUID
+         * Returns the RFC 9562 namespace for ISO object identifiers
+         * (6ba7b812-9dad-11d1-80b4-00c04fd430c8).
+         * 
+         * @return Version1 The OID namespace UUID
+         * 
+         * @example
+         * ```php
+         * $uuid = Version3::generate(Uuid::namespaceOid(), "1.3.6.1");
+         * ```
+         * @since 0.3.0
+         */
+        public static function namespaceOid(): \Identifier\Uuid\Version1 {}
+
+        /**
+         * Get the X.500 namespace UUID
+         * Returns the RFC 9562 namespace for X.500 distinguished names
+         * (6ba7b814-9dad-11d1-80b4-00c04fd430c8).
+         * 
+         * @return Version1 The X.500 namespace UUID
+         * 
+         * @example
+         * ```php
+         * $uuid = Version5::generate(Uuid::namespaceX500(), "CN=example");
+         * ```
+         * @since 0.3.0
+         */
+        public static function namespaceX500(): \Identifier\Uuid\Version1 {}
+
+        /**
+         * Check whether a string is a valid UUID
+         * Validates the canonical 8-4-4-4-12 form accepted by fromString() without
+         * creating an object or throwing. When $version is given, the version
+         * nibble must also match. Called on a version class, only UUIDs of that
+         * version are valid.
+         * 
+         * @param string $uuid String to validate
+         * @param int|null $version Required UUID version, or null for any
+         * @return bool True if the string is a valid UUID
+         * 
+         * @example
+         * ```php
+         * var_dump(Uuid::isValid('550e8400-e29b-41d4-a716-446655440000'));    // bool(true)
+         * var_dump(Uuid::isValid('550e8400-e29b-41d4-a716-446655440000', 7)); // bool(false)
+         * var_dump(Uuid::isValid('not-a-uuid'));                              // bool(false)
+         * ```
+         * @since 0.3.0
+         */
+        public static function isValid(string $uuid, ?int $version = null): bool {}
+
+        /**
+         * Parse a UUID string, returning null on failure
+         * Same as fromString() but returns null instead of throwing. Called on a
+         * version class, it also returns null for UUIDs of another version.
+         * 
+         * @param string $uuid UUID string in format "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx"
+         * @return Uuid|null UUID instance of the appropriate version, or null
+         * 
+         * @example
+         * ```php
+         * $uuid = Uuid::tryFromString($_GET['id'] ?? '') ?? Uuid::nil();
+         * var_dump(Version7::tryFromString('550e8400-e29b-41d4-a716-446655440000')); // NULL
+         * ```
+         * @since 0.3.0
+         */
+        public static function tryFromString(string $uuid): ?\Identifier\Uuid {}
+
+        /**
+         * Create a UUID from binary bytes, returning null on failure
+         * Same as fromBytes() but returns null instead of throwing. Called on a
+         * version class, it also returns null for UUIDs of another version.
+         * 
+         * @param string $bytes Exactly 16 bytes of binary data
+         * @return Uuid|null UUID instance of the appropriate version, or null
+         * 
+         * @example
+         * ```php
+         * $uuid = Uuid::tryFromBytes($row['id']);
+         * ```
+         * @since 0.3.0
+         */
+        public static function tryFromBytes(string $bytes): ?\Identifier\Uuid {}
+
+        /**
+         * Create a UUID from a hexadecimal string, returning null on failure
+         * Same as fromHex() but returns null instead of throwing. Called on a
+         * version class, it also returns null for UUIDs of another version.
+         * 
+         * @param string $hex 32-character hexadecimal string (with or without hyphens)
+         * @return Uuid|null UUID instance of the appropriate version, or null
+         * 
+         * @example
+         * ```php
+         * $uuid = Uuid::tryFromHex('550e8400e29b41d4a716446655440000');
+         * ```
+         * @since 0.3.0
+         */
+        public static function tryFromHex(string $hex): ?\Identifier\Uuid {}
+
+    }
+
+    /**
+     * Generate a new ULID (Universally Unique Lexicographically Sortable Identifier)
+     * Creates a new ULID with a timestamp component and random component.
+     * ULIDs are lexicographically sortable and encode a timestamp, making them
+     * ideal for use as database primary keys and distributed system identifiers.
+     * 
+     * @since 0.1.0
+     */
+    final class Ulid extends \Identifier\Bit128 implements \Stringable
+    {
+        /**
+         * Generate a new ULID (Universally Unique Lexicographically Sortable Identifier)
+         * Creates a new ULID with a timestamp component and random component.
+         * ULIDs are lexicographically sortable and encode a timestamp, making them
+         * ideal for use as database primary keys and distributed system identifiers.
+         * 
+         * @param Context|null $context Optional context for controlling time and randomness
+         * @return Ulid A new ULID instance
+         * @throws Exception If timestamp or random generation fails
+         * 
+         * @example
+         * ```php
+         * // Generate with current timestamp
+         * $ulid = Ulid::generate();
+         * echo $ulid->toString(); // e.g., "01ARZ3NDEKTSV4RRFFQ69G5FAV"
+         * // Generate with fixed context for testing
+         * $context = new FixedContext();
+         * $ulid = Ulid::generate($context);
+         * ```
+         * @since 0.1.0
+         */
+        public static function generate(?\Identifier\Context $context = NULL): \Identifier\Ulid {}
+
+        /**
+         * Generate a ULID from a named monotonic stream
+         * Each stream key (a tenant, partition or queue name) has its own
+         * monotonic state, so ULIDs of one stream are strictly ordered without
+         * sharing the in-millisecond counter space with any other stream or with
+         * generate(). States persist across requests in a per-thread table of at
+         * most identifier.ulid_streams keys; the least recently used stream is
+         * evicted when it is full and starts afresh on its next use.
+         * 
+         * @param string $streamKey Non-empty stream name
+         * @return Ulid A new ULID instance
+         * @throws Exception If the stream key is empty
+         * @throws \OutOfBoundsException If the stream overflows and identifier.ulid_overflow is "throw"
+         * 
+         * @example
+         * ```php
+         * $a = Ulid::generateFor("tenant-42");
+         * $b = Ulid::generateFor("tenant-42");
+         * var_dump($a->compare($b) < 0); // bool(true)
+         * ```
+         * @since 0.3.0
+         */
+        public static function generateFor(string $streamKey): \Identifier\Ulid {}
+
+        /**
+         * Generate many ULIDs in one call
+         * Runs the monotonic generator in a tight loop, reading the clock once per
+         * 256 ULIDs rather than once per ULID. The batch continues the same
+         * monotonic sequence as generate(), so it is strictly ascending and sorts
+         * after any ULID generated before it. With BATCH_BINARY the result is one
+         * string of $count * 16 bytes.
+         * With $threads > 1, large batches are split into contiguous slices filled
+         * in parallel. The batch then shares one timestamp and each slice takes its
+         * own range of the monotonic randomness counter, so ordering is preserved.
+         * Builds without thread support ignore the option.
+         * 
+         * @param int $count Number of ULIDs to generate
+         * @param int $format One of Bit128::BATCH_OBJECTS, BATCH_STRINGS or BATCH_BINARY
+         * @param int $threads Maximum number of threads to fill the batch with
+         * @return array|string List of Ulid objects or strings, or the packed bytes
+         * @throws Exception If count is negative, format is unknown or threads is out of range
+         * @throws OutOfBoundsException If the randomness overflows and identifier.ulid_overflow is "throw"
+         * 
+         * @example
+         * ```php
+         * $rows = Ulid::generateBatch(50000, Ulid::BATCH_BINARY);
+         * ```
+         * @since 0.3.0
+         */
+        public static function generateBatch(int $count, int $format = \Identifier\Bit128::BATCH_OBJECTS, int $threads = 1): array|string {}
+
+        /**
+         * Convert ULID to string representation
+         * Returns the ULID in its canonical 26-character Crockford Base32 encoding.
+         * This encoding is case-insensitive and excludes ambiguous characters.
+         * 
+         * @return string 26-character ULID string
+         * 
+         * @example
+         * ```php
+         * $ulid = Ulid::generate();
+         * echo $ulid->toString(); // "01ARZ3NDEKTSV4RRFFQ69G5FAV"
+         * // Can also use string casting
+         * echo (string) $ulid; // Same result
+         * ```
+         * @since 0.1.0
+         */
+        public function toString(): string {}
+
+        /**
+         * Create a ULID from a string representation
+         * Parses a 26-character ULID string in Crockford Base32 encoding and returns
+         * a ULID object. The string must be exactly 26 characters and contain only
+         * valid Crockford Base32 characters (0-9, A-Z excluding I, L, O, U).
+         * 
+         * @param string $ulid ULID string in Crockford Base32 format (26 characters)
+         * @return Ulid ULID instance
+         * @throws Exception If the string format is invalid or contains invalid characters
+         * 
+         * @example
+         * ```php
+         * $ulid = Ulid::fromString('01ARZ3NDEKTSV4RRFFQ69G5FAV');
+         * echo $ulid->toString(); // "01ARZ3NDEKTSV4RRFFQ69G5FAV"
+         * // Case-insensitive parsing
+         * $ulid = Ulid::fromString('01arz3ndektsv4rrffq69g5fav');
+         * ```
+         * @since 0.1.0
+         */
+        public static function fromString(string $ulid): \Identifier\Ulid {}
+
+        /**
+         * Create a ULID from a hexadecimal string
+         * Parses a 32-character hexadecimal string (with or without dashes) and returns
+         * a ULID object. This is useful for working with ULIDs in their raw hex form.
+         * 
+         * @param string $hex Hexadecimal string (32 characters, optionally with dashes)
+         * @return Ulid ULID instance
+         * @throws Exception If the hex string is invalid or has incorrect length
+         * 
+         * @example
+         * ```php
+         * // Parse hex string without dashes
+         * $ulid = Ulid::fromHex('0188bac7b8de4c4aaa5f8c3e0cd5e5e3');
+         * // Parse hex string with dashes
+         * $ulid = Ulid::fromHex('0188bac7-b8de-4c4a-aa5f-8c3e0cd5e5e3');
+         * echo $ulid->toString(); // Crockford Base32 representation
+         * ```
+         * @since 0.1.0
+         */
+        public static function fromHex(string $hex): \Identifier\Ulid {}
+
+        /**
+         * Create a ULID from raw bytes
+         * Creates a ULID from a 16-byte binary string. This is the most direct way
+         * to construct a ULID from its binary representation.
+         * 
+         * @param string $bytes Binary string of exactly 16 bytes
+         * @return Ulid ULID instance
+         * @throws Exception If the byte string is not exactly 16 bytes
+         * 
+         * @example
+         * ```php
+         * // Create from binary data
+         * $bytes = random_bytes(16);
+         * $ulid = Ulid::fromBytes($bytes);
+         * // Round-trip conversion
+         * $ulid1 = Ulid::generate();
+         * $ulid2 = Ulid::fromBytes($ulid1->getBytes());
+         * var_dump($ulid1->toString() === $ulid2->toString()); // bool(true)
+         * ```
+         * @since 0.1.0
+         */
+        public static function fromBytes(string $bytes): \Identifier\Ulid {}
+
+        /**
+         * Get the timestamp component of the ULID
+         * Extracts and returns the 48-bit timestamp from the first 6 bytes of the ULID.
+         * This represents milliseconds since Unix epoch (January 1, 1970).
+         * 
+         * @return int Timestamp in milliseconds since Unix epoch
+         * 
+         * @example
+         * ```php
+         * $ulid = Ulid::generate();
+         * $timestamp = $ulid->getTimestamp();
+         * echo date('Y-m-d H:i:s', $timestamp / 1000); // Convert to readable date
+         * // ULIDs are sortable by timestamp
+         * $ulid1 = Ulid::generate();
+         * usleep(1000); // Wait 1ms
+         * $ulid2 = Ulid::generate();
+         * var_dump($ulid1->getTimestamp() < $ulid2->getTimestamp()); // bool(true)
+         * ```
+         * @since 0.1.0
+         */
+        public function getTimestamp(): int {}
+
+        /**
+         * Get the randomness component of the ULID
+         * Extracts and returns the 80-bit randomness from the last 10 bytes of the ULID.
+         * This provides uniqueness when multiple ULIDs are generated in the same millisecond.
+         * 
+         * @return string 10-byte binary randomness data
+         * 
+         * @example
+         * ```php
+         * $ulid = Ulid::generate();
+         * $randomness = $ulid->getRandomness();
+         * echo strlen($randomness); // 10
+         * echo bin2hex($randomness); // 20-character hex string
+         * // Different ULIDs have different randomness
+         * $ulid1 = Ulid::generate();
+         * $ulid2 = Ulid::generate();
+         * var_dump($ulid1->getRandomness() !== $ulid2->getRandomness()); // bool(true)
+         * ```
+         * @since 0.1.0
+         */
+        public function getRandomness(): string {}
+
+        /**
+         * Get the worker ID stored in the randomness
+         * With identifier.worker_bits set, the first bits of the randomness hold
+         * the ID of the worker that generated the ULID, so rows can be routed back
+         * to their producer. The bits are read with the width configured for this
+         * process.
+         * 
+         * @return int|null Worker ID, or null if identifier.worker_bits is 0
+         * 
+         * @example
+         * ```php
+         * // identifier.worker_bits=8, identifier.worker_id=42
+         * echo Ulid::generate()->getWorkerId(); // 42
+         * ```
+         * @since 0.3.0
+         */
+        public function getWorkerId(): ?int {}
+
+        /**
+         * Check whether a string is a valid ULID
+         * Validates a 26-character Crockford Base32 string (either case) that fits
+         * in 128 bits, without creating an object or throwing.
+         * 
+         * @param string $ulid String to validate
+         * @return bool True if the string is a valid ULID
+         * 
+         * @example
+         * ```php
+         * var_dump(Ulid::isValid('01ARZ3NDEKTSV4RRFFQ69G5FAV')); // bool(true)
+         * var_dump(Ulid::isValid('81ARZ3NDEKTSV4RRFFQ69G5FAV')); // bool(false), overflows
+         * ```
+         * @since 0.3.0
+         */
+        public static function isValid(string $ulid): bool {}
+
+        /**
+         * Parse a ULID string, returning null on failure
+         * Same as fromString() but returns null instead of throwing.
+         * 
+         * @param string $ulid ULID string in Crockford Base32 format (26 characters)
+         * @return Ulid|null ULID instance, or null
+         * 
+         * @example
+         * ```php
+         * $ulid = Ulid::tryFromString($input) ?? throw new InvalidArgumentException();
+         * ```
+         * @since 0.3.0
+         */
+        public static function tryFromString(string $ulid): ?\Identifier\Ulid {}
+
+        /**
+         * Create a ULID from a hexadecimal string, returning null on failure
+         * Same as fromHex() but returns null instead of throwing.
+         * 
+         * @param string $hex Hexadecimal string (32 characters, optionally with dashes)
+         * @return Ulid|null ULID instance, or null
+         * 
+         * @example
+         * ```php
+         * $ulid = Ulid::tryFromHex('0188bac7b8de4c4aaa5f8c3e0cd5e5e3');
+         * ```
+         * @since 0.3.0
+         */
+        public static function tryFromHex(string $hex): ?\Identifier\Ulid {}
+
+        /**
+         * Create a ULID from raw bytes, returning null on failure
+         * Same as fromBytes() but returns null instead of throwing.
+         * 
+         * @param string $bytes Binary string of exactly 16 bytes
+         * @return Ulid|null ULID instance, or null
+         * 
+         * @example
+         * ```php
+         * $ulid = Ulid::tryFromBytes($row['id']);
+         * ```
+         * @since 0.3.0
+         */
+        public static function tryFromBytes(string $bytes): ?\Identifier\Ulid {}
+
+    }
+
+    /**
+     * Create an empty identifier vector
+     * Stores identifiers contiguously as raw 16-byte records, which takes a
+     * fraction of the memory of an array of objects. Objects are only created
+     * when an element is read. A vector of Identifier\Uuid yields the matching
+     * version subclass for each element.
+     * 
+     * @since 0.3.0
+     */
+    final class Bit128Vector implements \IteratorAggregate, \Traversable, \ArrayAccess, \Countable
+    {
+        /**
+         * Create an empty identifier vector
+         * Stores identifiers contiguously as raw 16-byte records, which takes a
+         * fraction of the memory of an array of objects. Objects are only created
+         * when an element is read. A vector of Identifier\Uuid yields the matching
+         * version subclass for each element.
+         * 
+         * @param string $elementClass Class used when reading elements (Bit128 subclass)
+         * @throws Exception If the class does not extend Bit128
+         * 
+         * @example
+         * ```php
+         * $ids = new Bit128Vector(Ulid::class);
+         * $ids->append(Ulid::generate());
+         * echo count($ids); // 1
+         * ```
+         * @since 0.3.0
+         */
+        public function __construct(string $elementClass = \Identifier\Bit128::class) {}
+
+        /**
+         * Append an identifier
+         * Copies the 16-byte payload of the identifier to the end of the vector.
+         * 
+         * @param Bit128 $id Identifier to append
+         * 
+         * @example
+         * ```php
+         * $ids = new Bit128Vector(Uuid::class);
+         * $ids->append(Version7::generate());
+         * ```
+         * @since 0.3.0
+         */
+        public function append(\Identifier\Bit128 $id): void {}
+
+        /**
+         * Get the number of identifiers in the vector
+         * 
+         * @return int Number of elements
+         * 
+         * @example
+         * ```php
+         * echo count($ids); // same as $ids->count()
+         * ```
+         * @since 0.3.0
+         */
+        public function count(): int {}
+
+        /**
+         * Check whether an offset exists
+         * 
+         * @param mixed $offset Integer offset
+         * @return bool True if 0 <= offset < count
+         * @since 0.3.0
+         */
+        public function offsetExists(mixed $offset): bool {}
+
+        /**
+         * Get the identifier at an offset
+         * Creates a new object of the element class for the stored record.
+         * 
+         * @param mixed $offset Integer offset
+         * @return Bit128 The identifier at that position
+         * @throws Exception If the offset is not an integer or out of range
+         * 
+         * @example
+         * ```php
+         * $first = $ids[0];
+         * ```
+         * @since 0.3.0
+         */
+        public function offsetGet(mixed $offset): \Identifier\Bit128 {}
+
+        /**
+         * Replace or append an identifier
+         * $ids[] = $id appends; $ids[$i] = $id replaces an existing element.
+         * 
+         * @param mixed $offset Integer offset, or null to append
+         * @param mixed $value Bit128 instance
+         * @throws Exception If the value is not a Bit128 or the offset is invalid
+         * @since 0.3.0
+         */
+        public function offsetSet(mixed $offset, mixed $value): void {}
+
+        /**
+         * Unsetting elements is not supported
+         * 
+         * @param mixed $offset Ignored
+         * @throws Exception Always
+         * @since 0.3.0
+         */
+        public function offsetUnset(mixed $offset): void {}
+
+        /**
+         * Get an iterator over the identifiers
+         * foreach over the vector yields offset => identifier pairs; each
+         * identifier object is created as the loop reaches it.
+         * 
+         * @return Iterator Iterator over the elements
+         * 
+         * @example
+         * ```php
+         * foreach ($ids as $i => $id) {
+         * echo $i, ': ', $id, "\n";
+         * }
+         * ```
+         * @since 0.3.0
+         */
+        public function getIterator(): \Iterator {}
+
+        /**
+         * Export all identifiers as one binary string
+         * Returns the records back to back, 16 bytes per identifier, in vector order.
+         * 
+         * @return string Binary string of count() * 16 bytes
+         * 
+         * @example
+         * ```php
+         * file_put_contents('ids.bin', $ids->toBinary());
+         * ```
+         * @since 0.3.0
+         */
+        public function toBinary(): string {}
+
+        /**
+         * Load a vector from a binary string
+         * Copies the blob as-is without parsing individual identifiers. The blob
+         * length must be a multiple of 16 bytes.
+         * 
+         * @param string $binary Concatenated 16-byte records
+         * @param string $elementClass Class used when reading elements (Bit128 subclass)
+         * @return Bit128Vector New vector holding the records
+         * @throws Exception If the length is not a multiple of 16 or the class is invalid
+         * 
+         * @example
+         * ```php
+         * $ids = Bit128Vector::fromBinary(file_get_contents('ids.bin'), Ulid::class);
+         * ```
+         * @since 0.3.0
+         */
+        public static function fromBinary(string $binary, string $elementClass = \Identifier\Bit128::class): \Identifier\Bit128Vector {}
+
+        /**
+         * Sort the vector in place
+         * Orders the records by their binary value with a radix sort, without
+         * creating any objects.
+         * 
+         * @param bool $descending Sort from highest to lowest
+         * 
+         * @example
+         * ```php
+         * $ids->sort();
+         * $index = $ids->binarySearch($needle);
+         * ```
+         * @since 0.3.0
+         */
+        public function sort(bool $descending = false): void {}
+
+        /**
+         * Find an identifier in a sorted vector
+         * The vector must be in ascending order, e.g. after sort().
+         * 
+         * @param Bit128 $needle The identifier to look for
+         * @return int|false Offset of a matching element, or false if not found
+         * 
+         * @example
+         * ```php
+         * $ids->sort();
+         * var_dump($ids->binarySearch($ids[3])); // int(3)
+         * ```
+         * @since 0.3.0
+         */
+        public function binarySearch(\Identifier\Bit128 $needle): int|false {}
+
+    }
+
+    /**
+     * Create an empty identifier set
+     * A hash set of 128-bit identifiers that stores the raw 16-byte payloads,
+     * so membership tests never allocate strings. Identifiers are compared by
+     * value regardless of class.
+     * 
+     * @since 0.3.0
+     */
+    final class Bit128Set implements \Countable
+    {
+        /**
+         * Create an empty identifier set
+         * A hash set of 128-bit identifiers that stores the raw 16-byte payloads,
+         * so membership tests never allocate strings. Identifiers are compared by
+         * value regardless of class.
+         * 
+         * @param int $capacity Number of identifiers to reserve room for
+         * @throws Exception If capacity is negative
+         * 
+         * @example
+         * ```php
+         * $seen = new Bit128Set(100000);
+         * if ($seen->add($event->id)) {
+         * process($event);
+         * }
+         * ```
+         * @since 0.3.0
+         */
+        public function __construct(int $capacity = 0) {}
+
+        /**
+         * Add an identifier to the set
+         * 
+         * @param Bit128 $id Identifier to add
+         * @return bool True if it was added, false if it was already present
+         * 
+         * @example
+         * ```php
+         * $set = new Bit128Set();
+         * var_dump($set->add($id)); // bool(true)
+         * var_dump($set->add($id)); // bool(false)
+         * ```
+         * @since 0.3.0
+         */
+        public function add(\Identifier\Bit128 $id): bool {}
+
+        /**
+         * Check whether an identifier is in the set
+         * 
+         * @param Bit128 $id Identifier to look for
+         * @return bool True if present
+         * 
+         * @example
+         * ```php
+         * var_dump($set->contains($id)); // bool(true)
+         * ```
+         * @since 0.3.0
+         */
+        public function contains(\Identifier\Bit128 $id): bool {}
+
+        /**
+         * Remove an identifier from the set
+         * 
+         * @param Bit128 $id Identifier to remove
+         * @return bool True if it was present
+         * 
+         * @example
+         * ```php
+         * $set->remove($id);
+         * var_dump($set->contains($id)); // bool(false)
+         * ```
+         * @since 0.3.0
+         */
+        public function remove(\Identifier\Bit128 $id): bool {}
+
+        /**
+         * Add many identifiers at once
+         * Accepts a Bit128Vector (read without creating objects) or an array of
+         * Bit128 instances. The table is sized up front.
+         * 
+         * @param Bit128Vector|array $ids Identifiers to add
+         * @return int Number of identifiers that were not already present
+         * @throws Exception If an array element is not a Bit128 instance
+         * 
+         * @example
+         * ```php
+         * $set = new Bit128Set();
+         * echo $set->addAll(Bit128Vector::fromBinary($blob)); // number of distinct ids
+         * ```
+         * @since 0.3.0
+         */
+        public function addAll(\Identifier\Bit128Vector|array $ids): int {}
+
+        /**
+         * Create a set holding the identifiers of both sets
+         * 
+         * @param Bit128Set $other The other set
+         * @return Bit128Set New set; neither operand is modified
+         * 
+         * @example
+         * ```php
+         * $all = $a->union($b);
+         * ```
+         * @since 0.3.0
+         */
+        public function union(\Identifier\Bit128Set $other): \Identifier\Bit128Set {}
+
+        /**
+         * Create a set holding the identifiers present in both sets
+         * 
+         * @param Bit128Set $other The other set
+         * @return Bit128Set New set; neither operand is modified
+         * 
+         * @example
+         * ```php
+         * $common = $a->intersect($b);
+         * ```
+         * @since 0.3.0
+         */
+        public function intersect(\Identifier\Bit128Set $other): \Identifier\Bit128Set {}
+
+        /**
+         * Get the number of identifiers in the set
+         * 
+         * @return int Number of identifiers
+         * 
+         * @example
+         * ```php
+         * echo count($set);
+         * ```
+         * @since 0.3.0
+         */
+        public function count(): int {}
+
+        /**
+         * Copy the identifiers into a Bit128Vector
+         * The order is unspecified; call sort() on the result for byte order.
+         * 
+         * @return Bit128Vector Vector holding every identifier in the set
+         * 
+         * @example
+         * ```php
+         * $vector = $set->toVector();
+         * $vector->sort();
+         * ```
+         * @since 0.3.0
+         */
+        public function toVector(): \Identifier\Bit128Vector {}
+
+    }
+
+    final class Generator
+    {
+        /**
+         * Create an identifier generator
+         * Binds the identifier class, context and ordering mode once, so that each
+         * call to next() skips argument parsing and context checks. Every generator
+         * owns its own monotonic state and entropy buffer: several independent,
+         * individually ordered streams can run side by side in one process.
+         * 
+         * @param string $class Identifier class: Version1, Version4, Version6, Version7 or Ulid
+         * @param Context|null $context Optional context for time and randomness
+         * @param bool $monotonic Keep identifiers strictly ascending within this generator
+         * @param int $bufferSize Identifiers' worth of CSPRNG output fetched per refill (1-4096)
+         * @throws Exception If the class is not supported or bufferSize is out of range
+         * 
+         * @example
+         * ```php
+         * $orders = new Generator(Ulid::class);
+         * $events = new Generator(Version7::class, bufferSize: 1024);
+         * $id = $orders->next();
+         * $key = $events->nextBytes();
+         * ```
+         * @since 0.3.0
+         */
+        public function __construct(string $class = \Identifier\Ulid::class, ?\Identifier\Context $context = null, bool $monotonic = true, int $bufferSize = 64) {}
+
+        /**
+         * Generate the next identifier as an object
+         * 
+         * @return Bit128 Instance of the class the generator was built with
+         * @throws \OutOfBoundsException If a monotonic ULID or UUIDv7 stream overflows and identifier.ulid_overflow is "throw"
+         * 
+         * @example
+         * ```php
+         * $generator = new Generator(Version7::class);
+         * $uuid = $generator->next();
+         * ```
+         * @since 0.3.0
+         */
+        public function next(): \Identifier\Bit128 {}
+
+        /**
+         * Generate the next identifier as its canonical string
+         * Returns the 26-character Crockford Base32 form for ULIDs and the
+         * 36-character hyphenated form for UUIDs, without creating an object.
+         * 
+         * @return string Canonical string form
+         * @throws \OutOfBoundsException If a monotonic ULID or UUIDv7 stream overflows and identifier.ulid_overflow is "throw"
+         * 
+         * @example
+         * ```php
+         * $generator = new Generator(Ulid::class);
+         * echo $generator->nextString(); // e.g., "01ARZ3NDEKTSV4RRFFQ69G5FAV"
+         * ```
+         * @since 0.3.0
+         */
+        public function nextString(): string {}
+
+        /**
+         * Generate the next identifier as 16 raw bytes
+         * 
+         * @return string 16-byte binary identifier
+         * @throws \OutOfBoundsException If a monotonic ULID or UUIDv7 stream overflows and identifier.ulid_overflow is "throw"
+         * 
+         * @example
+         * ```php
+         * $generator = new Generator(Version7::class);
+         * $stmt->execute([$generator->nextBytes()]);
+         * ```
+         * @since 0.3.0
+         */
+        public function nextBytes(): string {}
+
+        /**
+         * Get the identifier class this generator produces
+         * 
+         * @return string Fully qualified class name
+         * 
+         * @example
+         * ```php
+         * echo (new Generator(Version4::class))->getClass(); // "Identifier\Uuid\Version4"
+         * ```
+         * @since 0.3.0
+         */
+        public function getClass(): string {}
+
+    }
+
+    final class Reservoir
+    {
+        /**
+         * Reservoir is a static facade and cannot be instantiated
+         * 
+         * @since 0.3.0
+         */
+        private function __construct() {}
+
+        /**
+         * Prefill the reservoir with entropy for count identifiers
+         * Identifier generation draws its random bytes from the reservoir while it
+         * holds enough, so the work and the getrandom() syscall move out of the
+         * latency-critical section. Entries are tied to the filling process: a
+         * forked worker discards what it inherited instead of reusing it. The
+         * reservoir is emptied at the end of every request; the
+         * identifier.reservoir setting refills it when a request starts.
+         * 
+         * @param int $count Identifiers' worth of entropy to add (0-65536)
+         * @return int Identifiers' worth of entropy now held
+         * @throws Exception If count is out of range
+         * 
+         * @example
+         * ```php
+         * Reservoir::fill(1000);
+         * // ... latency-sensitive work ...
+         * $id = Version4::generate(); // served from the reservoir
+         * ```
+         * @since 0.3.0
+         */
+        public static function fill(int $count): int {}
+
+        /**
+         * Get the number of identifiers the reservoir can still serve
+         * 
+         * @return int Identifiers' worth of entropy held by this process
+         * 
+         * @example
+         * ```php
+         * if (Reservoir::available() < 100) {
+         *     Reservoir::fill(1000);
+         * }
+         * ```
+         * @since 0.3.0
+         */
+        public static function available(): int {}
+
+        /**
+         * Empty the reservoir and zero its contents
+         * Generation falls back to the CSPRNG on every call until the next fill().
+         * The hit and miss counters are kept.
+         * 
+         * @example
+         * ```php
+         * Reservoir::clear();
+         * ```
+         * @since 0.3.0
+         */
+        public static function clear(): void {}
+
+        /**
+         * Get reservoir statistics for the current request
+         * Hits count random reads served from the reservoir; misses count reads
+         * that fell back to the CSPRNG while the reservoir was enabled.
+         * 
+         * @return array{capacity: int, available: int, hits: int, misses: int}
+         * 
+         * @example
+         * ```php
+         * $stats = Reservoir::stats();
+         * printf("%d hits, %d misses\n", $stats['hits'], $stats['misses']);
+         * ```
+         * @since 0.3.0
+         */
+        public static function stats(): array {}
+
+    }
+
+    final class Snowflake
+    {
+        /** Epoch of the original Snowflake: 2010-11-04 01:42:54.657 UTC */
+        public const DEFAULT_EPOCH = 1288834974657;
+        /** Read the wall clock */
+        public const CLOCK_REALTIME = 0;
+        /** Read a monotonic clock anchored to the wall clock once per thread */
+        public const CLOCK_MONOTONIC = 1;
+
+        /**
+         * Create a Snowflake generator
+         * Snowflake IDs are 63-bit integers: the milliseconds since epoch, then the
+         * worker ID, then a per-millisecond sequence. They fit a signed BIGINT
+         * column, half the size of a 16-byte identifier, and sort by time. The
+         * sequence state is shared by all generators of a thread that use the
+         * system clocks; generators with a context keep their own.
+         * CLOCK_REALTIME reads the wall clock. CLOCK_MONOTONIC anchors a monotonic
+         * clock to the wall clock once per thread, so NTP steps cannot move IDs
+         * backwards.
+         * 
+         * @param int $workerId Worker ID, less than 2 ** $workerBits
+         * @param int $epoch Epoch in milliseconds since the Unix epoch
+         * @param int $timestampBits Bits for the milliseconds since epoch (1-63)
+         * @param int $workerBits Bits for the worker ID
+         * @param int $sequenceBits Bits for the per-millisecond sequence
+         * @param int $clock Snowflake::CLOCK_REALTIME or Snowflake::CLOCK_MONOTONIC
+         * @param Context|null $context Optional context for time, overriding the clock
+         * @throws \Exception If the bit split exceeds 63 bits, or an argument is out of range
+         * 
+         * @example
+         * ```php
+         * $snowflake = new Snowflake(workerId: 7);
+         * $id = $snowflake->next(); // e.g., 1789213054482886656
+         * ```
+         * @since 0.3.0
+         */
+        public function __construct(int $workerId = 0, int $epoch = Snowflake::DEFAULT_EPOCH, int $timestampBits = 41, int $workerBits = 10, int $sequenceBits = 12, int $clock = Snowflake::CLOCK_REALTIME, ?\Identifier\Context $context = null) {}
+
+        /**
+         * Generate the next Snowflake ID
+         * 
+         * @return int Positive 63-bit ID, strictly greater than the previous one
+         * @throws \Exception If the clock is before the epoch or past the timestamp bits
+         * 
+         * @example
+         * ```php
+         * $snowflake = new Snowflake(workerId: 7);
+         * $stmt->execute([$snowflake->next()]);
+         * ```
+         * @since 0.3.0
+         */
+        public function next(): int {}
+
+        /**
+         * Generate many Snowflake IDs in one call
+         * Reads the clock once per 256 IDs rather than once per ID. The batch
+         * continues the same sequence as next(), so it is strictly ascending.
+         * 
+         * @param int $count Number of IDs to generate
+         * @return array List of ints
+         * @throws \Exception If count is negative, or as next()
+         * 
+         * @example
+         * ```php
+         * $ids = (new Snowflake(workerId: 7))->nextBatch(1000);
+         * ```
+         * @since 0.3.0
+         */
+        public function nextBatch(int $count): array {}
+
+        /**
+         * Get the Unix timestamp of a Snowflake ID
+         * Decodes with this generator's epoch and bit split.
+         * 
+         * @param int $id Snowflake ID
+         * @return int Milliseconds since the Unix epoch
+         * 
+         * @example
+         * ```php
+         * $snowflake = new Snowflake();
+         * echo date('c', intdiv($snowflake->getTimestamp($snowflake->next()), 1000));
+         * ```
+         * @since 0.3.0
          */
-        public static function fromBytes(string $bytes): \Identifier\Uuid {}
+        public function getTimestamp(int $id): int {}
 
         /**
-         * Create a UUID from a hexadecimal string
-         * Parses a 32-character hexadecimal string (with or without hyphens) and
-         * creates a UUID. Automatically detects the version and returns the appropriate
-         * version-specific subclass. Case-insensitive.
+         * Get the worker ID of a Snowflake ID
          * 
-         * @param string $hex 32-character hexadecimal string (with or without hyphens)
-         * @return Uuid UUID instance of the appropriate version
-         * @throws Exception If hex string is invalid
+         * @param int $id Snowflake ID
+         * @return int Worker ID
          * 
          * @example
          * ```php
-         * $uuid = Uuid::fromHex('550e8400e29b41d4a716446655440000');
-         * echo $uuid->toString(); // "550e8400-e29b-41d4-a716-446655440000"
-         * // Also works with hyphens
-         * $uuid2 = Uuid::fromHex('550e8400-e29b-41d4-a716-446655440000');
+         * $snowflake = new Snowflake(workerId: 7);
+         * echo $snowflake->getWorkerId($snowflake->next()); // 7
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public static function fromHex(string $hex): \Identifier\Uuid {}
+        public function getWorkerId(int $id): int {}
 
         /**
-         * Check if this UUID is the nil UUID
-         * Returns true if all 128 bits are zero (00000000-0000-0000-0000-000000000000).
-         * The nil UUID is defined in RFC 4122 and represents a special "null" value.
+         * Get the sequence number of a Snowflake ID
          * 
-         * @return bool True if this is the nil UUID, false otherwise
+         * @param int $id Snowflake ID
+         * @return int Position of the ID within its millisecond
          * 
          * @example
          * ```php
-         * $nil = Uuid::nil();
-         * var_dump($nil->isNil()); // bool(true)
-         * $uuid = Version4::generate();
-         * var_dump($uuid->isNil()); // bool(false)
+         * $snowflake = new Snowflake();
+         * echo $snowflake->getSequence($snowflake->next()); // 0
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public function isNil(): bool {}
+        public function getSequence(int $id): int {}
 
+    }
+
+    final class SequenceAllocator
+    {
         /**
-         * Create the nil UUID
-         * Returns a UUID with all bits set to zero (00000000-0000-0000-0000-000000000000).
-         * This is a special UUID defined in RFC 4122 that represents a null or empty value.
+         * Create an allocator for a named host-wide sequence
+         * The sequence counter lives in shared memory mapped at startup, so every
+         * worker forked from the same master draws from it. Values are leased in
+         * blocks of blockSize with one atomic fetch-add, then handed out by next()
+         * from the local block without touching shared memory (the hi/lo pattern).
+         * Values are unique and ascending per allocator; across allocators they
+         * interleave by block, and values left in a block when its allocator is
+         * destroyed are skipped. With identifier.sequence_file the counters
+         * survive restarts.
          * 
-         * @return Uuid The nil UUID instance
+         * @param string $name Sequence name (1-48 bytes); up to 64 names per host
+         * @param int $blockSize Values leased at a time (1-16777216)
+         * @throws \Exception If an argument is out of range, the sequence table is full, a slot stays claimed by another process, or shared memory is unavailable
          * 
          * @example
          * ```php
-         * $nil = Uuid::nil();
-         * echo $nil->toString(); // "00000000-0000-0000-0000-000000000000"
-         * var_dump($nil->isNil()); // bool(true)
+         * $orders = new SequenceAllocator("orders", blockSize: 500);
+         * $id = $orders->next(); // e.g., 1501
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public static function nil(): \Identifier\Uuid {}
+        public function __construct(string $name = "default", int $blockSize = 1000) {}
 
         /**
-         * Check if this UUID is the max UUID
-         * Returns true if all 128 bits are set to 1 (ffffffff-ffff-ffff-ffff-ffffffffffff).
-         * The max UUID is defined in RFC 4122 and represents the maximum possible UUID value.
+         * Get the next value of the sequence
+         * Leases a new block from the shared counter when the local one is used
+         * up, or when the allocator was inherited by a forked child, which must
+         * not hand out its parent's block.
          * 
-         * @return bool True if this is the max UUID, false otherwise
+         * @return int Next value, starting at 1
+         * @throws \OutOfBoundsException If the sequence has reached PHP_INT_MAX
          * 
          * @example
          * ```php
-         * $max = Uuid::max();
-         * var_dump($max->isMax()); // bool(true)
-         * $uuid = Version4::generate();
-         * var_dump($uuid->isMax()); // bool(false)
+         * $sequence = new SequenceAllocator("invoices");
+         * $number = $sequence->next();
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public function isMax(): bool {}
+        public function next(): int {}
 
         /**
-         * Create the max UUID
-         * Returns a UUID with all bits set to 1 (ffffffff-ffff-ffff-ffff-ffffffffffff).
-         * This is a special UUID defined in RFC 4122 that represents the maximum possible UUID value.
+         * Get the number of values left in the leased block
          * 
-         * @return Uuid The max UUID instance
+         * @return int Values next() returns before it leases another block
          * 
          * @example
          * ```php
-         * $max = Uuid::max();
-         * echo $max->toString(); // "ffffffff-ffff-ffff-ffff-ffffffffffff"
-         * var_dump($max->isMax()); // bool(true)
+         * $sequence = new SequenceAllocator("orders", blockSize: 100);
+         * $sequence->next();
+         * echo $sequence->remaining(); // 99
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public static function max(): \Identifier\Uuid {}
-
-    }
+        public function remaining(): int {}
 
-    /**
-     * Generate a new ULID (Universally Unique Lexicographically Sortable Identifier)
-     * Creates a new ULID with a timestamp component and random component.
-     * ULIDs are lexicographically sortable and encode a timestamp, making them
-     * ideal for use as database primary keys and distributed system identifiers.
-     * 
-     * @since 0.1.0
-     */
-    final class Ulid extends \Identifier\Bit128 implements \Stringable
-    {
         /**
-         * Generate a new ULID (Universally Unique Lexicographically Sortable Identifier)
-         * Creates a new ULID with a timestamp component and random component.
-         * ULIDs are lexicographically sortable and encode a timestamp, making them
-         * ideal for use as database primary keys and distributed system identifiers.
+         * Get the sequence name
          * 
-         * @param Context|null $context Optional context for controlling time and randomness
-         * @return Ulid A new ULID instance
-         * @throws Exception If timestamp or random generation fails
+         * @return string Name passed to the constructor
          * 
          * @example
          * ```php
-         * // Generate with current timestamp
-         * $ulid = Ulid::generate();
-         * echo $ulid->toString(); // e.g., "01ARZ3NDEKTSV4RRFFQ69G5FAV"
-         * // Generate with fixed context for testing
-         * $context = new FixedContext();
-         * $ulid = Ulid::generate($context);
+         * echo (new SequenceAllocator("orders"))->getName(); // "orders"
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public static function generate(?\Identifier\Context $context = NULL): \Identifier\Ulid {}
+        public function getName(): string {}
 
         /**
-         * Convert ULID to string representation
-         * Returns the ULID in its canonical 26-character Crockford Base32 encoding.
-         * This encoding is case-insensitive and excludes ambiguous characters.
+         * Get the number of values leased at a time
          * 
-         * @return string 26-character ULID string
+         * @return int Block size
          * 
          * @example
          * ```php
-         * $ulid = Ulid::generate();
-         * echo $ulid->toString(); // "01ARZ3NDEKTSV4RRFFQ69G5FAV"
-         * // Can also use string casting
-         * echo (string) $ulid; // Same result
+         * echo (new SequenceAllocator("orders", blockSize: 500))->getBlockSize(); // 500
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public function toString(): string {}
+        public function getBlockSize(): int {}
 
+    }
+
+    final class HybridClock
+    {
         /**
-         * Create a ULID from a string representation
-         * Parses a 26-character ULID string in Crockford Base32 encoding and returns
-         * a ULID object. The string must be exactly 26 characters and contain only
-         * valid Crockford Base32 characters (0-9, A-Z excluding I, L, O, U).
+         * Create a hybrid logical clock
+         * Pairs the physical time in milliseconds with a logical counter. Every
+         * identifier it issues is greater than the previous one and than every
+         * identifier passed to observe(), so identifiers sort in causal order
+         * across hosts whose clocks disagree, without a central sequencer. The
+         * time is the 48-bit timestamp and the counter is rand_a of a UUIDv7 or
+         * the first 16 randomness bits of a ULID, below any identifier.worker_bits.
          * 
-         * @param string $ulid ULID string in Crockford Base32 format (26 characters)
-         * @return Ulid ULID instance
-         * @throws Exception If the string format is invalid or contains invalid characters
+         * @param string $class Identifier class: Version7 or Ulid
+         * @param Context|null $context Optional context for time and randomness
+         * @param int $maxDrift Largest lead over the local clock, in milliseconds, that observe() accepts; 0 for no limit
+         * @throws \Exception If the class is not supported or maxDrift is negative
          * 
          * @example
          * ```php
-         * $ulid = Ulid::fromString('01ARZ3NDEKTSV4RRFFQ69G5FAV');
-         * echo $ulid->toString(); // "01ARZ3NDEKTSV4RRFFQ69G5FAV"
-         * // Case-insensitive parsing
-         * $ulid = Ulid::fromString('01arz3ndektsv4rrffq69g5fav');
+         * $clock = new HybridClock(Version7::class);
+         * $clock->observe(Version7::fromString($message['id']));
+         * $reply = $clock->next(); // sorts after $message['id']
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public static function fromString(string $ulid): \Identifier\Ulid {}
+        public function __construct(string $class = \Identifier\Uuid\Version7::class, ?\Identifier\Context $context = null, int $maxDrift = 60000) {}
 
         /**
-         * Create a ULID from a hexadecimal string
-         * Parses a 32-character hexadecimal string (with or without dashes) and returns
-         * a ULID object. This is useful for working with ULIDs in their raw hex form.
+         * Issue the next identifier
+         * Takes the physical time if it is ahead of the clock, and otherwise
+         * keeps the clock's time and increments the counter. A full counter
+         * moves the clock one millisecond ahead of the physical time.
          * 
-         * @param string $hex Hexadecimal string (32 characters, optionally with dashes)
-         * @return Ulid ULID instance
-         * @throws Exception If the hex string is invalid or has incorrect length
+         * @return Bit128 Instance of the class the clock was built with
          * 
          * @example
          * ```php
-         * // Parse hex string without dashes
-         * $ulid = Ulid::fromHex('0188bac7b8de4c4aaa5f8c3e0cd5e5e3');
-         * // Parse hex string with dashes
-         * $ulid = Ulid::fromHex('0188bac7-b8de-4c4a-aa5f-8c3e0cd5e5e3');
-         * echo $ulid->toString(); // Crockford Base32 representation
+         * $clock = new HybridClock(Ulid::class);
+         * $id = $clock->next();
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public static function fromHex(string $hex): \Identifier\Ulid {}
+        public function next(): \Identifier\Bit128 {}
 
         /**
-         * Create a ULID from raw bytes
-         * Creates a ULID from a 16-byte binary string. This is the most direct way
-         * to construct a ULID from its binary representation.
+         * Merge the time of a received identifier into the clock
+         * Moves the clock up to the identifier's time and counter if they are
+         * ahead, so that the next identifier sorts after it. Both UUIDv7 and
+         * ULID layouts are understood, whichever class the clock issues. With
+         * identifier.worker_bits, an identifier of a higher worker ID moves the
+         * clock to the following millisecond.
          * 
-         * @param string $bytes Binary string of exactly 16 bytes
-         * @return Ulid ULID instance
-         * @throws Exception If the byte string is not exactly 16 bytes
+         * @param Bit128 $remoteId Version7 UUID or ULID received from another node
+         * @throws \Exception If the identifier is neither, or leads the local clock by more than maxDrift
          * 
          * @example
          * ```php
-         * // Create from binary data
-         * $bytes = random_bytes(16);
-         * $ulid = Ulid::fromBytes($bytes);
-         * // Round-trip conversion
-         * $ulid1 = Ulid::generate();
-         * $ulid2 = Ulid::fromBytes($ulid1->getBytes());
-         * var_dump($ulid1->toString() === $ulid2->toString()); // bool(true)
+         * $clock->observe(Ulid::fromString($event['id']));
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public static function fromBytes(string $bytes): \Identifier\Ulid {}
+        public function observe(\Identifier\Bit128 $remoteId): void {}
 
         /**
-         * Get the timestamp component of the ULID
-         * Extracts and returns the 48-bit timestamp from the first 6 bytes of the ULID.
-         * This represents milliseconds since Unix epoch (January 1, 1970).
+         * Get the time of the last identifier issued or observed
          * 
-         * @return int Timestamp in milliseconds since Unix epoch
+         * @return int Milliseconds since the Unix epoch; 0 before the first call
          * 
          * @example
          * ```php
-         * $ulid = Ulid::generate();
-         * $timestamp = $ulid->getTimestamp();
-         * echo date('Y-m-d H:i:s', $timestamp / 1000); // Convert to readable date
-         * // ULIDs are sortable by timestamp
-         * $ulid1 = Ulid::generate();
-         * usleep(1000); // Wait 1ms
-         * $ulid2 = Ulid::generate();
-         * var_dump($ulid1->getTimestamp() < $ulid2->getTimestamp()); // bool(true)
+         * $lag = $clock->getTimestamp() - (int)(microtime(true) * 1000);
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
         public function getTimestamp(): int {}
 
         /**
-         * Get the randomness component of the ULID
-         * Extracts and returns the 80-bit randomness from the last 10 bytes of the ULID.
-         * This provides uniqueness when multiple ULIDs are generated in the same millisecond.
+         * Get the logical counter of the last identifier issued or observed
          * 
-         * @return string 10-byte binary randomness data
+         * @return int Counter within the current millisecond
          * 
          * @example
          * ```php
-         * $ulid = Ulid::generate();
-         * $randomness = $ulid->getRandomness();
-         * echo strlen($randomness); // 10
-         * echo bin2hex($randomness); // 20-character hex string
-         * // Different ULIDs have different randomness
-         * $ulid1 = Ulid::generate();
-         * $ulid2 = Ulid::generate();
-         * var_dump($ulid1->getRandomness() !== $ulid2->getRandomness()); // bool(true)
+         * echo $clock->getCounter();
          * ```
-         * @since 0.1.0
+         * @since 0.3.0
          */
-        public function getRandomness(): string {}
+        public function getCounter(): int {}
 
     }
 
+    /**
+     * Generate a random UUID version 4 string
+     * Same as Version4::generate()->toString() without creating an object.
+     * Always uses the system CSPRNG.
+     * 
+     * @return string UUID in "xxxxxxxx-xxxx-4xxx-xxxx-xxxxxxxxxxxx" form
+     * 
+     * @example
+     * ```php
+     * echo Identifier\uuid4(); // e.g., "f47ac10b-58cc-4372-a567-0e02b2c3d479"
+     * ```
+     * @since 0.3.0
+     */
+    function uuid4(): string {}
+
+    /**
+     * Generate a random UUID version 4 as 16 raw bytes
+     * Same as Version4::generate()->getBytes() without creating an object.
+     * 
+     * @return string 16-byte binary UUID
+     * 
+     * @example
+     * ```php
+     * $stmt->execute([Identifier\uuid4_bytes()]);
+     * ```
+     * @since 0.3.0
+     */
+    function uuid4_bytes(): string {}
+
+    /**
+     * Generate a UUID version 7 string
+     * Same as Version7::generate()->toString() without creating an object.
+     * Uses the system clock and CSPRNG.
+     * 
+     * @return string UUID in "xxxxxxxx-xxxx-7xxx-xxxx-xxxxxxxxxxxx" form
+     * 
+     * @example
+     * ```php
+     * echo Identifier\uuid7(); // e.g., "018c2e65-4b0a-7c3d-8f2e-1a4b5c6d7e8f"
+     * ```
+     * @since 0.3.0
+     */
+    function uuid7(): string {}
+
+    /**
+     * Generate a UUID version 7 as 16 raw bytes
+     * Same as Version7::generate()->getBytes() without creating an object.
+     * 
+     * @return string 16-byte binary UUID
+     * 
+     * @example
+     * ```php
+     * $stmt->execute([Identifier\uuid7_bytes()]);
+     * ```
+     * @since 0.3.0
+     */
+    function uuid7_bytes(): string {}
+
+    /**
+     * Generate a ULID string
+     * Same as Ulid::generate()->toString() without creating an object, and
+     * monotonic with it: both share the same per-thread state.
+     * 
+     * @return string 26-character Crockford Base32 ULID
+     * @throws OutOfBoundsException If the randomness overflows and identifier.ulid_overflow is "throw"
+     * 
+     * @example
+     * ```php
+     * echo Identifier\ulid(); // e.g., "01ARZ3NDEKTSV4RRFFQ69G5FAV"
+     * ```
+     * @since 0.3.0
+     */
+    function ulid(): string {}
+
+    /**
+     * Generate a ULID as 16 raw bytes
+     * Same as Ulid::generate()->getBytes() without creating an object.
+     * 
+     * @return string 16-byte binary ULID
+     * @throws OutOfBoundsException If the randomness overflows and identifier.ulid_overflow is "throw"
+     * 
+     * @example
+     * ```php
+     * $stmt->execute([Identifier\ulid_bytes()]);
+     * ```
+     * @since 0.3.0
+     */
+    function ulid_bytes(): string {}
+
+    /**
+     * Check whether a string is a valid UUID
+     * Same as Uuid::isValid(). Pure: with a literal argument opcache can fold
+     * the call at compile time.
+     * 
+     * @param string $uuid String to validate
+     * @param int|null $version Required UUID version, or null for any
+     * @return bool True if the string is a valid UUID
+     * 
+     * @example
+     * ```php
+     * var_dump(Identifier\uuid_is_valid($input, 7));
+     * ```
+     * @since 0.3.0
+     */
+    function uuid_is_valid(string $uuid, ?int $version = null): bool {}
+
+    /**
+     * Check whether a string is a valid ULID
+     * Same as Ulid::isValid(). Pure: with a literal argument opcache can fold
+     * the call at compile time.
+     * 
+     * @param string $ulid String to validate
+     * @return bool True if the string is a valid ULID
+     * 
+     * @example
+     * ```php
+     * var_dump(Identifier\ulid_is_valid($input));
+     * ```
+     * @since 0.3.0
+     */
+    function ulid_is_valid(string $ulid): bool {}
+
+    /**
+     * Convert a UUID string to its 16 raw bytes
+     * Same as Uuid::fromString($uuid)->getBytes() without creating an object.
+     * Pure: a literal UUID is converted once, at compile time.
+     * 
+     * @param string $uuid UUID string in format "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx"
+     * @return string 16-byte binary UUID
+     * @throws \Exception If the string is not a valid UUID
+     * 
+     * @example
+     * ```php
+     * $stmt->execute([Identifier\uuid_to_bytes('550e8400-e29b-41d4-a716-446655440000')]);
+     * ```
+     * @since 0.3.0
+     */
+    function uuid_to_bytes(string $uuid): string {}
+
+    /**
+     * Convert 16 raw bytes to a UUID string
+     * Same as Uuid::fromBytes($bytes)->toString() without creating an object.
+     * 
+     * @param string $bytes Exactly 16 bytes of binary data
+     * @return string UUID in "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" form
+     * @throws \Exception If bytes is not exactly 16 bytes
+     * 
+     * @example
+     * ```php
+     * echo Identifier\uuid_from_bytes($row['id']);
+     * ```
+     * @since 0.3.0
+     */
+    function uuid_from_bytes(string $bytes): string {}
+
+    /**
+     * Convert a ULID string to its 16 raw bytes
+     * Same as Ulid::fromString($ulid)->getBytes() without creating an object.
+     * Pure: a literal ULID is converted once, at compile time.
+     * 
+     * @param string $ulid ULID string in Crockford Base32 format (26 characters)
+     * @return string 16-byte binary ULID
+     * @throws \Exception If the string is not a valid ULID
+     * 
+     * @example
+     * ```php
+     * $stmt->execute([Identifier\ulid_to_bytes($input)]);
+     * ```
+     * @since 0.3.0
+     */
+    function ulid_to_bytes(string $ulid): string {}
+
+    /**
+     * Convert 16 raw bytes to a ULID string
+     * Same as Ulid::fromBytes($bytes)->toString() without creating an object.
+     * 
+     * @param string $bytes Exactly 16 bytes of binary data
+     * @return string 26-character Crockford Base32 ULID
+     * @throws \Exception If bytes is not exactly 16 bytes
+     * 
+     * @example
+     * ```php
+     * echo Identifier\ulid_from_bytes($row['id']);
+     * ```
+     * @since 0.3.0
+     */
+    function ulid_from_bytes(string $bytes): string {}
+
+    /**
+     * Get generator counters for the calling thread
+     * Reports which monotonic scope is active (identifier.monotonic_scope) and,
+     * for the shared scopes, how many reservations this thread made and how
+     * many of its compare-and-swap or lock attempts lost to another writer.
+     * ulid_overflow counts how often each identifier.ulid_overflow policy
+     * fired. clock_regression counts how often the system clock stepped
+     * backwards and the largest step, whatever identifier.clock_regression did
+     * about it. The counters live for the lifetime of the worker, across requests.
+     * 
+     * @return array{monotonic: array{scope: string, reservations: int, retries: int}, ulid_overflow: array{policy: string, throws: int, advances: int, waits: int}, clock_regression: array{policy: string, events: int, max_jump_ms: int}}
+     * 
+     * @example
+     * ```php
+     * $stats = Identifier\stats();
+     * printf("%.2f retries per ULID\n", $stats['monotonic']['retries'] / max(1, $stats['monotonic']['reservations']));
+     * ```
+     * @since 0.3.0
+     */
+    function stats(): array {}
+
 }
 
 namespace Identifier\Context
@@ -952,7 +2328,7 @@ namespace Identifier\Uuid
          * @example
          * ```php
          * // Generate deterministic UUID from namespace and name
-         * $namespace = "6ba7b810-9dad-11d1-80b4-00c04fd430c8";
+         * $namespace = Uuid::namespaceDns();
          * $uuid = Version3::generate($namespace, "example.com");
          * echo $uuid->toString(); // Always the same for these inputs
          * // Same inputs always produce same UUID
@@ -995,6 +2371,33 @@ namespace Identifier\Uuid
          */
         public static function generate(?\Identifier\Context $context = NULL): \Identifier\Uuid\Version4 {}
 
+        /**
+         * Generate many random UUIDs version 4 in one call
+         * Draws the entropy for the whole batch from the system CSPRNG in a single
+         * block, then stamps the version and variant bits in place. With
+         * BATCH_BINARY the result is one string of $count * 16 bytes, ready for a
+         * bulk insert or unpacking with str_split($bin, 16).
+         * With $threads > 1, large batches are split into contiguous slices that
+         * worker threads fill in parallel, each reading the OS CSPRNG directly.
+         * Builds without thread support ignore the option.
+         * 
+         * @param int $count Number of UUIDs to generate
+         * @param int $format One of Bit128::BATCH_OBJECTS, BATCH_STRINGS or BATCH_BINARY
+         * @param int $threads Maximum number of threads to fill the batch with
+         * @return array|string List of Version4 objects or strings, or the packed bytes
+         * @throws Exception If count is negative, format is unknown or threads is out of range
+         * 
+         * @example
+         * ```php
+         * $ids = Version4::generateBatch(50000, Version4::BATCH_BINARY);
+         * foreach (str_split($ids, 16) as $bytes) { ... }
+         * // Backfill: ten million UUIDs across eight cores
+         * $bin = Version4::generateBatch(10_000_000, Version4::BATCH_BINARY, 8);
+         * ```
+         * @since 0.3.0
+         */
+        public static function generateBatch(int $count, int $format = \Identifier\Bit128::BATCH_OBJECTS, int $threads = 1): array|string {}
+
         /**
          * Create a Version 4 UUID from a string representation
          * Parses a UUID string in the standard format (8-4-4-4-12) and validates that
@@ -1107,7 +2510,7 @@ namespace Identifier\Uuid
          * @example
          * ```php
          * // Generate deterministic UUID from namespace and name
-         * $namespace = "6ba7b810-9dad-11d1-80b4-00c04fd430c8";
+         * $namespace = Uuid::namespaceDns();
          * $uuid = Version5::generate($namespace, "example.com");
          * echo $uuid->toString(); // Always the same for these inputs
          * // Preferred over Version 3 for security
@@ -1343,6 +2746,33 @@ namespace Identifier\Uuid
          */
         public static function generate(?\Identifier\Context $context = NULL): \Identifier\Uuid\Version7 {}
 
+        /**
+         * Generate many UUIDs version 7 in one call
+         * Draws the entropy for the whole batch in a single block and reads the
+         * clock once per 256 UUIDs rather than once per UUID. UUIDs sharing a
+         * millisecond are ordered by a randomly stepped counter, so the batch is
+         * strictly ascending. With BATCH_BINARY the result is one string of
+         * $count * 16 bytes.
+         * With $threads > 1, large batches are split into contiguous slices filled
+         * in parallel. The batch then shares one timestamp and each slice takes its
+         * own range of the sub-millisecond counter, so ordering is preserved.
+         * Builds without thread support ignore the option.
+         * 
+         * @param int $count Number of UUIDs to generate
+         * @param int $format One of Bit128::BATCH_OBJECTS, BATCH_STRINGS or BATCH_BINARY
+         * @param int $threads Maximum number of threads to fill the batch with
+         * @return array|string List of Version7 objects or strings, or the packed bytes
+         * @throws Exception If count is negative, format is unknown or threads is out of range
+         * 
+         * @example
+         * ```php
+         * $ids = Version7::generateBatch(50000, Version7::BATCH_STRINGS);
+         * $ids[0] < $ids[1]; // true
+         * ```
+         * @since 0.3.0
+         */
+        public static function generateBatch(int $count, int $format = \Identifier\Bit128::BATCH_OBJECTS, int $threads = 1): array|string {}
+
         /**
          * Create UUID version 7 from string representation
          * Parses a UUID version 7 from its standard string representation.
@@ -1474,6 +2904,23 @@ namespace Identifier\Uuid
          */
         public function getRandomB(): string {}
 
+        /**
+         * Get the worker ID stored in rand_a
+         * With identifier.worker_bits set, the top bits of rand_a hold the ID of
+         * the worker that generated the UUID, so rows can be routed back to their
+         * producer. The bits are read with the width configured for this process.
+         * 
+         * @return int|null Worker ID, or null if identifier.worker_bits is 0
+         * 
+         * @example
+         * ```php
+         * // identifier.worker_bits=8, identifier.worker_id=42
+         * echo Version7::generate()->getWorkerId(); // 42
+         * ```
+         * @since 0.3.0
+         */
+        public function getWorkerId(): ?int {}
+
     }
 
 }
@@ -0,0 +1,103 @@
+--TEST--
+Bit128 native comparison, string cast and debug handlers
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Bit128;
+use Identifier\Uuid;
+use Identifier\Ulid;
+
+$low = Bit128::fromHex('00000000000000000000000000000001');
+$high = Bit128::fromHex('ff000000000000000000000000000000');
+$same = Bit128::fromHex('00000000000000000000000000000001');
+
+// Test 1: Equality operators compare the payload
+echo "low == same: " . ($low == $same ? "YES" : "NO") . "\n";
+echo "low == high: " . ($low == $high ? "YES" : "NO") . "\n";
+echo "low != high: " . ($low != $high ? "YES" : "NO") . "\n";
+
+// Test 2: Ordering operators follow byte order
+echo "low < high: " . ($low < $high ? "YES" : "NO") . "\n";
+echo "high > low: " . ($high > $low ? "YES" : "NO") . "\n";
+echo "low <=> high: " . ($low <=> $high) . "\n";
+echo "high <=> low: " . ($high <=> $low) . "\n";
+echo "low <=> same: " . ($low <=> $same) . "\n";
+
+// Test 3: sort() and usort() without a compare() callback
+$ids = [$high, $low, Bit128::fromHex('7f000000000000000000000000000000')];
+sort($ids);
+echo "sort(): " . implode(',', array_map(fn($id) => substr($id->toHex(), 0, 2), $ids)) . "\n";
+
+$ids = [$low, $high];
+usort($ids, fn($a, $b) => $b <=> $a);
+echo "usort() desc: " . substr($ids[0]->toHex(), 0, 2) . "\n";
+
+// Test 4: String casts use the class format
+$uuid = Uuid::fromString('550e8400-e29b-41d4-a716-446655440000');
+$ulid = Ulid::fromString('01ARZ3NDEKTSV4RRFFQ69G5FAV');
+echo "Bit128 cast: " . (string)$low . "\n";
+echo "Uuid cast: " . (string)$uuid . "\n";
+echo "Ulid cast: " . (string)$ulid . "\n";
+echo "Interpolation: {$uuid}\n";
+echo "__toString(): " . $ulid->__toString() . "\n";
+
+// Test 5: Userland overrides are still honoured
+class Tagged extends Bit128
+{
+    public function toString(): string
+    {
+        return 'tag:' . $this->toHex();
+    }
+}
+echo "Override cast: " . (string)new Tagged(str_repeat("\x00", 16)) . "\n";
+
+// Test 6: Debug output exposes the canonical value
+print_r($uuid);
+echo "\n";
+print_r($ulid);
+echo "\n";
+
+// Test 7: Other objects are uncomparable, not read as identifiers
+$object = new stdClass();
+$date = new DateTime('@0');
+echo "low == stdClass: " . ($low == $object ? "YES" : "NO") . "\n";
+echo "stdClass == low: " . ($object == $low ? "YES" : "NO") . "\n";
+echo "low <=> DateTime: " . ($low <=> $date) . "\n";
+echo "in_array(stdClass): " . (in_array($object, [$low, $high]) ? "YES" : "NO") . "\n";
+echo "in_array(same): " . (in_array($same, [$high, $low]) ? "YES" : "NO") . "\n";
+echo "Done\n";
+?>
+--EXPECT--
+low == same: YES
+low == high: NO
+low != high: YES
+low < high: YES
+high > low: YES
+low <=> high: -1
+high <=> low: 1
+low <=> same: 0
+sort(): 00,7f,ff
+usort() desc: ff
+Bit128 cast: 00000000000000000000000000000001
+Uuid cast: 550e8400-e29b-41d4-a716-446655440000
+Ulid cast: 01ARZ3NDEKTSV4RRFFQ69G5FAV
+Interpolation: 550e8400-e29b-41d4-a716-446655440000
+__toString(): 01ARZ3NDEKTSV4RRFFQ69G5FAV
+Override cast: tag:00000000000000000000000000000000
+Identifier\Uuid\Version4 Object
+(
+    [value] => 550e8400-e29b-41d4-a716-446655440000
+)
+
+Identifier\Ulid Object
+(
+    [value] => 01ARZ3NDEKTSV4RRFFQ69G5FAV
+)
+
+low == stdClass: NO
+stdClass == low: NO
+low <=> DateTime: 1
+in_array(stdClass): NO
+in_array(same): YES
+Done
@@ -0,0 +1,95 @@
+--TEST--
+Bit128 native sortArray() and binarySearch()
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Bit128;
+use Identifier\Uuid\Version1;
+use Identifier\Uuid\Version4;
+
+// Test 1: Small arrays (comparison sort path)
+$ids = [
+    'c' => Bit128::fromHex('30000000000000000000000000000000'),
+    'a' => Bit128::fromHex('10000000000000000000000000000000'),
+    'b' => Bit128::fromHex('20000000000000000000000000000000'),
+];
+Bit128::sortArray($ids);
+echo "Small ascending: " . implode(',', array_map(fn($id) => $id->toHex()[0], $ids)) . "\n";
+echo "Re-indexed: " . implode(',', array_keys($ids)) . "\n";
+
+Bit128::sortArray($ids, true);
+echo "Small descending: " . implode(',', array_map(fn($id) => $id->toHex()[0], $ids)) . "\n";
+
+// Equal identifiers keep their relative order in both directions
+$first = Bit128::fromHex('20000000000000000000000000000000');
+$second = Bit128::fromHex('20000000000000000000000000000000');
+foreach ([false, true] as $descending) {
+    $ids = [$first, Bit128::fromHex('10000000000000000000000000000000'), $second];
+    Bit128::sortArray($ids, $descending);
+    echo "Stable " . ($descending ? "descending" : "ascending") . ": "
+        . (array_search($first, $ids, true) < array_search($second, $ids, true) ? "YES" : "NO") . "\n";
+}
+
+// Test 2: Large arrays (radix path) match usort()
+$ids = [];
+for ($i = 0; $i < 5000; $i++) {
+    $ids[] = Version4::generate();
+}
+$expected = $ids;
+usort($expected, fn($a, $b) => $a->compare($b));
+Bit128::sortArray($ids);
+$same = true;
+foreach ($ids as $i => $id) {
+    if (!$id->equals($expected[$i])) {
+        $same = false;
+        break;
+    }
+}
+echo "Radix matches usort: " . ($same ? "YES" : "NO") . "\n";
+
+// Test 3: Binary search
+$needle = $ids[1234];
+echo "Found index: " . Bit128::binarySearch($ids, $needle) . "\n";
+echo "Missing: " . var_export(Bit128::binarySearch($ids, Bit128::fromHex(str_repeat('0', 32))), true) . "\n";
+echo "Empty: " . var_export(Bit128::binarySearch([], $needle), true) . "\n";
+
+// Test 4: byTime orders Version1 by timestamp, not byte order
+$early = Version1::fromString('ffffffff-0000-1000-8000-000000000000');
+$late = Version1::fromString('00000000-0001-1000-8000-000000000000');
+$ids = [$late, $early];
+Bit128::sortArray($ids);
+echo "Byte order first: " . ($ids[0] === $late ? "late" : "early") . "\n";
+Bit128::sortArray($ids, false, true);
+echo "Time order first: " . ($ids[0] === $early ? "early" : "late") . "\n";
+
+// Test 5: Invalid elements
+try {
+    $bad = [Version4::generate(), 'not an id'];
+    Bit128::sortArray($bad);
+    echo "Invalid element: NO EXCEPTION\n";
+} catch (Exception $e) {
+    echo "Invalid element: " . $e->getMessage() . "\n";
+}
+
+try {
+    Bit128::binarySearch([1 => $needle], $needle);
+    echo "Non-list: NO EXCEPTION\n";
+} catch (Exception $e) {
+    echo "Non-list: " . $e->getMessage() . "\n";
+}
+?>
+--EXPECT--
+Small ascending: 1,2,3
+Re-indexed: 0,1,2
+Small descending: 3,2,1
+Stable ascending: YES
+Stable descending: YES
+Radix matches usort: YES
+Found index: 1234
+Missing: false
+Empty: false
+Byte order first: late
+Time order first: early
+Invalid element: All array elements must be Bit128 instances
+Non-list: Sorted array must be a list
@@ -0,0 +1,126 @@
+--TEST--
+Bit128Vector packed storage, access, iteration and sorting
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Bit128;
+use Identifier\Bit128Vector;
+use Identifier\Uuid;
+use Identifier\Ulid;
+use Identifier\Uuid\Version4;
+use Identifier\Uuid\Version7;
+
+// Test 1: Append, count and offsetGet
+$ids = new Bit128Vector(Ulid::class);
+$first = Ulid::fromString('01ARZ3NDEKTSV4RRFFQ69G5FAV');
+$ids->append($first);
+$ids[] = Ulid::generate();
+echo "Count: " . count($ids) . "\n";
+echo "offsetGet class: " . get_class($ids[0]) . "\n";
+echo "offsetGet value: " . $ids[0] . "\n";
+echo "Fresh object: " . ($ids[0] !== $first ? "YES" : "NO") . "\n";
+echo "isset(\$ids[1]): " . (isset($ids[1]) ? "YES" : "NO") . "\n";
+echo "isset(\$ids[2]): " . (isset($ids[2]) ? "YES" : "NO") . "\n";
+
+// Test 2: Replace an element
+$ids[1] = $first;
+echo "Replaced: " . ($ids[1]->equals($first) ? "YES" : "NO") . "\n";
+
+// Test 3: Uuid vectors materialize the version subclass
+$uuids = new Bit128Vector(Uuid::class);
+$uuids->append(Version4::generate());
+$uuids->append(Version7::generate());
+foreach ($uuids as $i => $uuid) {
+    echo "Element $i: " . get_class($uuid) . "\n";
+}
+
+// Test 4: Default element class
+$plain = new Bit128Vector();
+$plain->append(Version4::generate());
+echo "Default class: " . get_class($plain[0]) . "\n";
+
+// Test 5: Binary round trip
+$binary = $uuids->toBinary();
+echo "Binary length: " . strlen($binary) . "\n";
+$loaded = Bit128Vector::fromBinary($binary, Uuid::class);
+echo "Loaded count: " . count($loaded) . "\n";
+echo "Loaded matches: " . ($loaded[1]->equals($uuids[1]) ? "YES" : "NO") . "\n";
+
+// Test 6: Sort and binary search
+$vector = new Bit128Vector();
+$objects = [];
+for ($i = 0; $i < 1000; $i++) {
+    $id = Version4::generate();
+    $vector->append($id);
+    $objects[] = $id;
+}
+$vector->sort();
+Bit128::sortArray($objects);
+$same = true;
+foreach ($vector as $i => $id) {
+    if (!$id->equals($objects[$i])) {
+        $same = false;
+    }
+}
+echo "Sorted like sortArray: " . ($same ? "YES" : "NO") . "\n";
+echo "binarySearch: " . $vector->binarySearch($objects[500]) . "\n";
+echo "binarySearch missing: " . var_export($vector->binarySearch(Bit128::fromHex(str_repeat('0', 32))), true) . "\n";
+$vector->sort(true);
+echo "Descending first is max: " . ($vector[0]->equals($objects[999]) ? "YES" : "NO") . "\n";
+
+// Test 7: Clones are independent
+$copy = clone $vector;
+$copy[] = Version4::generate();
+echo "Clone count: " . count($copy) . ", original: " . count($vector) . "\n";
+
+// Test 8: Errors
+foreach ([
+    'bad offset' => fn() => $ids[5],
+    'string offset' => fn() => $ids['a'],
+    'bad value' => function () use ($ids) { $ids[] = 'nope'; },
+    'unset' => function () use ($ids) { unset($ids[0]); },
+    'bad binary' => fn() => Bit128Vector::fromBinary('abc'),
+    'bad class' => fn() => new Bit128Vector(stdClass::class),
+] as $label => $fn) {
+    try {
+        $fn();
+        echo "$label: NO EXCEPTION\n";
+    } catch (Exception $e) {
+        echo "$label: " . $e->getMessage() . "\n";
+    }
+}
+
+try {
+    serialize($ids);
+    echo "serialize: NO EXCEPTION\n";
+} catch (Exception $e) {
+    echo "serialize: blocked\n";
+}
+?>
+--EXPECT--
+Count: 2
+offsetGet class: Identifier\Ulid
+offsetGet value: 01ARZ3NDEKTSV4RRFFQ69G5FAV
+Fresh object: YES
+isset($ids[1]): YES
+isset($ids[2]): NO
+Replaced: YES
+Element 0: Identifier\Uuid\Version4
+Element 1: Identifier\Uuid\Version7
+Default class: Identifier\Bit128
+Binary length: 32
+Loaded count: 2
+Loaded matches: YES
+Sorted like sortArray: YES
+binarySearch: 500
+binarySearch missing: false
+Descending first is max: YES
+Clone count: 1001, original: 1000
+bad offset: Bit128Vector offset out of range
+string offset: Bit128Vector offset must be an integer
+bad value: Bit128Vector values must be Bit128 instances
+unset: Bit128Vector does not support unset
+bad binary: Binary length must be a multiple of 16 bytes
+bad class: Element class must extend Identifier\Bit128
+serialize: blocked
@@ -0,0 +1,124 @@
+--TEST--
+Bit128Set membership, bulk insert and set operations
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Bit128;
+use Identifier\Bit128Set;
+use Identifier\Bit128Vector;
+use Identifier\Ulid;
+use Identifier\Uuid\Version1;
+use Identifier\Uuid\Version4;
+
+// Test 1: add / contains / remove
+$set = new Bit128Set();
+$id = Version4::generate();
+echo "First add: " . var_export($set->add($id), true) . "\n";
+echo "Second add: " . var_export($set->add($id), true) . "\n";
+echo "Contains: " . var_export($set->contains($id), true) . "\n";
+echo "Contains equal copy: " . var_export($set->contains(Bit128::fromBytes($id->getBytes())), true) . "\n";
+echo "Count: " . count($set) . "\n";
+echo "Remove: " . var_export($set->remove($id), true) . "\n";
+echo "Remove again: " . var_export($set->remove($id), true) . "\n";
+echo "Contains after remove: " . var_export($set->contains($id), true) . "\n";
+
+// Test 2: Growth keeps every element reachable
+$set = new Bit128Set();
+$ids = [];
+for ($i = 0; $i < 20000; $i++) {
+    $ids[] = Ulid::generate();
+}
+echo "addAll array: " . $set->addAll($ids) . "\n";
+$missing = 0;
+foreach ($ids as $ulid) {
+    if (!$set->contains($ulid)) {
+        $missing++;
+    }
+}
+echo "Missing after growth: $missing\n";
+
+// Test 3: Low-entropy ids (shared node and clock sequence) still work
+$v1 = new Bit128Set();
+$base = Version1::generate()->getBytes();
+for ($i = 0; $i < 5000; $i++) {
+    $bytes = pack('N', $i) . substr($base, 4);
+    $v1->add(Bit128::fromBytes($bytes));
+}
+echo "Sequential v1-like count: " . count($v1) . "\n";
+
+// Test 4: Removals followed by reinsertion (tombstone reuse)
+for ($i = 0; $i < 10000; $i++) {
+    $set->remove($ids[$i]);
+}
+echo "Count after removals: " . count($set) . "\n";
+echo "Removed absent: " . var_export($set->contains($ids[0]), true) . "\n";
+echo "Kept present: " . var_export($set->contains($ids[15000]), true) . "\n";
+echo "Re-add: " . $set->addAll(array_slice($ids, 0, 10000)) . "\n";
+
+// Test 5: addAll from a vector with duplicates
+$vector = new Bit128Vector();
+$vector->append($ids[0]);
+$vector->append($ids[0]);
+$vector->append($ids[1]);
+$small = new Bit128Set();
+echo "addAll vector: " . $small->addAll($vector) . "\n";
+
+// Test 6: union / intersect
+$a = new Bit128Set();
+$b = new Bit128Set();
+$a->addAll([$ids[0], $ids[1], $ids[2]]);
+$b->addAll([$ids[2], $ids[3]]);
+$union = $a->union($b);
+$intersect = $a->intersect($b);
+echo "Union count: " . count($union) . "\n";
+echo "Intersect count: " . count($intersect) . "\n";
+echo "Intersect has shared: " . var_export($intersect->contains($ids[2]), true) . "\n";
+echo "Operands untouched: " . count($a) . "," . count($b) . "\n";
+
+// Test 7: toVector and clone
+$vector = $union->toVector();
+echo "toVector count: " . count($vector) . "\n";
+$copy = clone $a;
+$copy->add($ids[10]);
+echo "Clone independent: " . count($copy) . "," . count($a) . "\n";
+
+// Test 8: Errors
+try {
+    $a->addAll(['nope']);
+    echo "Bad element: NO EXCEPTION\n";
+} catch (Exception $e) {
+    echo "Bad element: " . $e->getMessage() . "\n";
+}
+try {
+    new Bit128Set(-1);
+    echo "Negative capacity: NO EXCEPTION\n";
+} catch (Exception $e) {
+    echo "Negative capacity: " . $e->getMessage() . "\n";
+}
+?>
+--EXPECT--
+First add: true
+Second add: false
+Contains: true
+Contains equal copy: true
+Count: 1
+Remove: true
+Remove again: false
+Contains after remove: false
+addAll array: 20000
+Missing after growth: 0
+Sequential v1-like count: 5000
+Count after removals: 10000
+Removed absent: false
+Kept present: true
+Re-add: 10000
+addAll vector: 2
+Union count: 4
+Intersect count: 1
+Intersect has shared: true
+Operands untouched: 3,2
+toVector count: 4
+Clone independent: 4,3
+Bad element: All array elements must be Bit128 instances
+Negative capacity: Capacity must not be negative
@@ -0,0 +1,93 @@
+--TEST--
+Bit128 compact serialization and var_export round trips
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Bit128;
+use Identifier\Uuid;
+use Identifier\Ulid;
+use Identifier\Uuid\Version1;
+use Identifier\Uuid\Version4;
+use Identifier\Uuid\Version7;
+
+// Test 1: serialize()/unserialize() keep the exact class and payload
+foreach ([
+    Bit128::fromHex('0123456789abcdef0123456789abcdef'),
+    Version1::generate(),
+    Version4::generate(),
+    Version7::generate(),
+    Uuid::nil(),
+    Ulid::generate(),
+] as $id) {
+    $payload = serialize($id);
+    $restored = unserialize($payload);
+    echo get_class($restored) . ": "
+        . ($restored->equals($id) ? "SAME" : "DIFFERENT") . ", "
+        . (str_contains($payload, ':1:{i:0;s:16:"') ? "compact" : "verbose") . "\n";
+}
+
+// Test 2: Nested in arrays (session payloads)
+$session = ['user' => Version4::generate(), 'trace' => Ulid::generate()];
+$copy = unserialize(serialize($session));
+echo "Nested: " . ($copy['user']->equals($session['user']) && $copy['trace']->equals($session['trace']) ? "YES" : "NO") . "\n";
+
+// Test 3: Userland subclasses keep their properties
+class TaggedId extends Bit128
+{
+    public string $tag = '';
+}
+$tagged = new TaggedId(str_repeat("\x01", 16));
+$tagged->tag = 'orders';
+$restored = unserialize(serialize($tagged));
+echo "Subclass tag: " . $restored->tag . "\n";
+echo "Subclass payload: " . $restored->toHex() . "\n";
+
+// Test 4: var_export() and __set_state()
+$ulid = Ulid::fromString('01ARZ3NDEKTSV4RRFFQ69G5FAV');
+$code = var_export($ulid, true);
+echo "Export has class: " . (str_contains($code, '\Identifier\Ulid::__set_state') ? "YES" : "NO") . "\n";
+echo "Export has hex: " . (str_contains($code, "'hex' => '" . $ulid->toHex() . "'") ? "YES" : "NO") . "\n";
+$back = eval("return $code;");
+echo "Export round trip: " . get_class($back) . " " . $back . "\n";
+
+$fromBytes = Version4::__set_state(['bytes' => Version4::generate()->getBytes()]);
+echo "__set_state bytes: " . get_class($fromBytes) . "\n";
+
+// Test 5: Invalid data
+try {
+    unserialize('O:15:"Identifier\Ulid":1:{i:0;s:3:"abc";}');
+    echo "Bad payload: NO EXCEPTION\n";
+} catch (Exception $e) {
+    echo "Bad payload: " . $e->getMessage() . "\n";
+}
+try {
+    unserialize('O:15:"Identifier\Ulid":2:{i:0;s:16:"' . str_repeat("\x01", 16) . '";i:1;a:1:{s:3:"foo";i:1;}}');
+    echo "Undeclared property: NO EXCEPTION\n";
+} catch (Exception $e) {
+    echo "Undeclared property: " . $e->getMessage() . "\n";
+}
+try {
+    Bit128::__set_state([]);
+    echo "Bad state: NO EXCEPTION\n";
+} catch (Exception $e) {
+    echo "Bad state: " . $e->getMessage() . "\n";
+}
+?>
+--EXPECT--
+Identifier\Bit128: SAME, compact
+Identifier\Uuid\Version1: SAME, compact
+Identifier\Uuid\Version4: SAME, compact
+Identifier\Uuid\Version7: SAME, compact
+Identifier\Uuid: SAME, compact
+Identifier\Ulid: SAME, compact
+Nested: YES
+Subclass tag: orders
+Subclass payload: 01010101010101010101010101010101
+Export has class: YES
+Export has hex: YES
+Export round trip: Identifier\Ulid 01ARZ3NDEKTSV4RRFFQ69G5FAV
+__set_state bytes: Identifier\Uuid\Version4
+Bad payload: Invalid serialization data for Identifier\Ulid
+Undeclared property: Invalid serialization data for Identifier\Ulid
+Bad state: State must contain a 32-character 'hex' or 16-byte 'bytes' entry
@@ -0,0 +1,69 @@
+--TEST--
+Bit128 lazy string and bytes cache
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Bit128;
+use Identifier\Uuid;
+use Identifier\Ulid;
+
+// Test 1: Setting is off by default
+echo "Default: " . ini_get('identifier.string_cache') . "\n";
+
+ini_set('identifier.string_cache', '1');
+
+// Test 2: Repeated conversions return the same value
+$uuid = Uuid::fromString('550e8400-e29b-41d4-a716-446655440000');
+$first = $uuid->toString();
+$second = (string)$uuid;
+echo "Uuid repeated: " . ($first === $second ? "YES" : "NO") . "\n";
+echo "Uuid value: " . $second . "\n";
+
+$ulid = Ulid::fromString('01ARZ3NDEKTSV4RRFFQ69G5FAV');
+echo "Ulid repeated: " . ($ulid->toString() === (string)$ulid ? "YES" : "NO") . "\n";
+echo "Bytes repeated: " . ($ulid->getBytes() === $ulid->getBytes() ? "YES" : "NO") . "\n";
+
+// Test 3: The cache is per format
+$id = Bit128::fromHex('00112233445566778899aabbccddeeff');
+echo "Hex: " . $id->toString() . "\n";
+echo "Hex again: " . $id->toHex() . "\n";
+echo "Bytes length: " . strlen($id->getBytes()) . "\n";
+
+// Test 4: Re-running the constructor drops the cache
+$id->__construct(str_repeat("\xff", 16));
+echo "After construct: " . $id->toString() . "\n";
+echo "Bytes after construct: " . bin2hex($id->getBytes()) . "\n";
+
+// Test 5: Clones keep the payload and the class
+$copy = clone $uuid;
+echo "Clone class: " . get_class($copy) . "\n";
+echo "Clone value: " . $copy . "\n";
+echo "Clone equal: " . ($copy == $uuid ? "YES" : "NO") . "\n";
+
+ini_set('identifier.string_cache', '0');
+
+// Test 6: Disabled cache behaves the same
+$plain = Uuid::fromString('6ba7b810-9dad-11d1-80b4-00c04fd430c8');
+$plainCopy = clone $plain;
+echo "Uncached: " . $plain . "\n";
+echo "Uncached clone: " . $plainCopy->toString() . "\n";
+echo "Done\n";
+?>
+--EXPECT--
+Default: 0
+Uuid repeated: YES
+Uuid value: 550e8400-e29b-41d4-a716-446655440000
+Ulid repeated: YES
+Bytes repeated: YES
+Hex: 00112233445566778899aabbccddeeff
+Hex again: 00112233445566778899aabbccddeeff
+Bytes length: 16
+After construct: ffffffffffffffffffffffffffffffff
+Bytes after construct: ffffffffffffffffffffffffffffffff
+Clone class: Identifier\Uuid\Version4
+Clone value: 550e8400-e29b-41d4-a716-446655440000
+Clone equal: YES
+Uncached: 6ba7b810-9dad-11d1-80b4-00c04fd430c8
+Uncached clone: 6ba7b810-9dad-11d1-80b4-00c04fd430c8
+Done
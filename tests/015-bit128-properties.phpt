@@ -0,0 +1,100 @@
+--TEST--
+Bit128 objects reject dynamic properties and stay out of the cycle collector
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Bit128;
+use Identifier\Uuid;
+use Identifier\Ulid;
+
+// Test 1: Built-in classes reject dynamic properties
+$ids = [
+    Bit128::fromHex('00112233445566778899aabbccddeeff'),
+    Uuid::fromString('550e8400-e29b-41d4-a716-446655440000'),
+    Ulid::fromString('01ARZ3NDEKTSV4RRFFQ69G5FAV'),
+];
+foreach ($ids as $id) {
+    try {
+        $id->tag = 'x';
+        echo "No error\n";
+    } catch (Error $e) {
+        echo get_class($e) . ": " . $e->getMessage() . "\n";
+    }
+}
+
+// Test 2: Indirect writes are rejected too
+try {
+    $ids[0]->list[] = 1;
+    echo "No error\n";
+} catch (Error $e) {
+    echo "Indirect: " . $e->getMessage() . "\n";
+}
+echo "isset: " . (isset($ids[0]->tag) ? "YES" : "NO") . "\n";
+echo "Properties: " . count(get_object_vars($ids[0])) . "\n";
+
+// Test 3: Declared properties on subclasses keep working
+class Labelled extends Bit128
+{
+    public array $labels = [];
+}
+$labelled = new Labelled(str_repeat("\x01", 16));
+$labelled->labels[] = 'orders';
+echo "Declared: " . implode(',', $labelled->labels) . "\n";
+try {
+    $labelled->other = 1;
+} catch (Error $e) {
+    echo "Subclass: " . $e->getMessage() . "\n";
+}
+
+// Test 4: __set still receives undeclared names
+class Magic extends Bit128
+{
+    public array $seen = [];
+    public function __set(string $name, mixed $value): void
+    {
+        $this->seen[] = $name;
+    }
+}
+$magic = new Magic(str_repeat("\x02", 16));
+$magic->anything = 1;
+echo "Magic: " . implode(',', $magic->seen) . "\n";
+
+// Test 5: Cycles through subclass properties are still collected
+class Linked extends Bit128
+{
+    public ?Linked $next = null;
+}
+$a = new Linked(str_repeat("\x03", 16));
+$b = new Linked(str_repeat("\x04", 16));
+$a->next = $b;
+$b->next = $a;
+unset($a, $b);
+echo "Collected: " . (gc_collect_cycles() >= 2 ? "YES" : "NO") . "\n";
+
+// Test 6: Many identifiers do not fill the GC root buffer
+gc_collect_cycles();
+$before = gc_status()['roots'];
+$keep = [];
+for ($i = 0; $i < 1000; $i++) {
+    $id = Uuid::fromString('550e8400-e29b-41d4-a716-446655440000');
+    $keep[] = $id;
+}
+unset($id);
+echo "Roots added: " . (gc_status()['roots'] - $before < 10 ? "NO" : "YES") . "\n";
+unset($keep);
+echo "Done\n";
+?>
+--EXPECT--
+Error: Cannot create dynamic property Identifier\Bit128::$tag
+Error: Cannot create dynamic property Identifier\Uuid\Version4::$tag
+Error: Cannot create dynamic property Identifier\Ulid::$tag
+Indirect: Cannot create dynamic property Identifier\Bit128::$list
+isset: NO
+Properties: 0
+Declared: orders
+Subclass: Cannot create dynamic property Labelled::$other
+Magic: anything
+Collected: YES
+Roots added: NO
+Done
@@ -0,0 +1,84 @@
+--TEST--
+UUID predefined namespaces and shared nil/max instances
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Uuid;
+use Identifier\Uuid\Version3;
+use Identifier\Uuid\Version5;
+
+// Test 1: Constants and accessors agree
+echo "DNS: " . Uuid::namespaceDns() . "\n";
+echo "URL: " . Uuid::namespaceUrl() . "\n";
+echo "OID: " . Uuid::namespaceOid() . "\n";
+echo "X500: " . Uuid::namespaceX500() . "\n";
+echo "Constant match: " . (Uuid::NAMESPACE_DNS === (string)Uuid::namespaceDns() ? "YES" : "NO") . "\n";
+echo "Class: " . get_class(Uuid::namespaceUrl()) . "\n";
+
+// Test 2: Instances are shared within the request
+echo "Same DNS: " . (Uuid::namespaceDns() === Uuid::namespaceDns() ? "YES" : "NO") . "\n";
+echo "Same nil: " . (Uuid::nil() === Uuid::nil() ? "YES" : "NO") . "\n";
+echo "Same max: " . (Uuid::max() === Uuid::max() ? "YES" : "NO") . "\n";
+echo "nil: " . Uuid::nil() . "\n";
+echo "max: " . Uuid::max() . "\n";
+
+// Test 3: Known RFC vectors through the precomputed hash states
+echo "v3 DNS: " . Version3::generate(Uuid::namespaceDns(), 'example.com') . "\n";
+echo "v5 DNS: " . Version5::generate(Uuid::namespaceDns(), 'example.com') . "\n";
+
+// Test 4: Equal namespaces built by hand give the same results
+$manual = Uuid::fromString(Uuid::NAMESPACE_URL);
+echo "v3 URL match: " . (Version3::generate($manual, 'https://example.com/')->equals(
+    Version3::generate(Uuid::namespaceUrl(), 'https://example.com/')) ? "YES" : "NO") . "\n";
+echo "v5 URL match: " . (Version5::generate($manual, 'https://example.com/')->equals(
+    Version5::generate(Uuid::namespaceUrl(), 'https://example.com/')) ? "YES" : "NO") . "\n";
+
+// Test 5: Other namespaces still hash from scratch
+$custom = Uuid::fromString('123e4567-e89b-12d3-a456-426614174000');
+$a = Version5::generate($custom, 'name');
+$b = Version5::generate($custom, 'name');
+echo "Custom stable: " . ($a->equals($b) ? "YES" : "NO") . "\n";
+echo "Custom differs: " . ($a->equals(Version5::generate(Uuid::namespaceDns(), 'name')) ? "NO" : "YES") . "\n";
+echo "Empty name: " . Version5::generate(Uuid::namespaceOid(), '')->getVersion() . "\n";
+
+// Test 6: Shared instances cannot be changed in place
+foreach ([
+    fn() => Uuid::nil()->__construct(str_repeat("\x01", 16)),
+    fn() => Uuid::namespaceDns()->__unserialize([str_repeat("\x01", 16)]),
+] as $case) {
+    try {
+        $case();
+        echo "no exception\n";
+    } catch (Exception $e) {
+        echo $e->getMessage() . "\n";
+    }
+}
+echo "nil intact: " . Uuid::nil() . "\n";
+echo "DNS intact: " . Uuid::namespaceDns() . "\n";
+echo "Done\n";
+?>
+--EXPECT--
+DNS: 6ba7b810-9dad-11d1-80b4-00c04fd430c8
+URL: 6ba7b811-9dad-11d1-80b4-00c04fd430c8
+OID: 6ba7b812-9dad-11d1-80b4-00c04fd430c8
+X500: 6ba7b814-9dad-11d1-80b4-00c04fd430c8
+Constant match: YES
+Class: Identifier\Uuid\Version1
+Same DNS: YES
+Same nil: YES
+Same max: YES
+nil: 00000000-0000-0000-0000-000000000000
+max: ffffffff-ffff-ffff-ffff-ffffffffffff
+v3 DNS: 9073926b-929f-31c2-abc9-fad77ae3e8eb
+v5 DNS: cfbff0d1-9375-5685-968c-48ce8b15ae17
+v3 URL match: YES
+v5 URL match: YES
+Custom stable: YES
+Custom differs: YES
+Empty name: 5
+Cannot modify an already initialized Identifier\Uuid
+Cannot modify an already initialized Identifier\Uuid\Version1
+nil intact: 00000000-0000-0000-0000-000000000000
+DNS intact: 6ba7b810-9dad-11d1-80b4-00c04fd430c8
+Done
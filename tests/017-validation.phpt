@@ -0,0 +1,111 @@
+--TEST--
+Exception-free validation and tryFrom*() parsing
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Uuid;
+use Identifier\Ulid;
+use Identifier\Uuid\Version4;
+use Identifier\Uuid\Version7;
+
+$v4 = '550e8400-e29b-41d4-a716-446655440000';
+
+// Test 1: Uuid::isValid()
+echo "valid: " . var_export(Uuid::isValid($v4), true) . "\n";
+echo "uppercase: " . var_export(Uuid::isValid(strtoupper($v4)), true) . "\n";
+echo "version 4: " . var_export(Uuid::isValid($v4, 4), true) . "\n";
+echo "version 7: " . var_export(Uuid::isValid($v4, 7), true) . "\n";
+echo "short: " . var_export(Uuid::isValid('550e8400'), true) . "\n";
+echo "bad dash: " . var_export(Uuid::isValid('550e8400xe29b-41d4-a716-446655440000'), true) . "\n";
+echo "bad hex: " . var_export(Uuid::isValid('550e8400-e29b-41d4-a716-44665544000g'), true) . "\n";
+echo "Version4 scope: " . var_export(Version4::isValid($v4), true) . "\n";
+echo "Version7 scope: " . var_export(Version7::isValid($v4), true) . "\n";
+
+// Test 2: Uuid::tryFrom*()
+echo "tryFromString: " . get_class(Uuid::tryFromString($v4)) . "\n";
+echo "tryFromString bad: " . var_export(Uuid::tryFromString('nope'), true) . "\n";
+echo "tryFromHex: " . Uuid::tryFromHex('550e8400e29b41d4a716446655440000') . "\n";
+echo "tryFromHex dashed: " . Uuid::tryFromHex($v4) . "\n";
+echo "tryFromHex long: " . var_export(Uuid::tryFromHex($v4 . 'ff'), true) . "\n";
+echo "tryFromBytes: " . Uuid::tryFromBytes(hex2bin('550e8400e29b41d4a716446655440000')) . "\n";
+echo "tryFromBytes short: " . var_export(Uuid::tryFromBytes('abc'), true) . "\n";
+
+// Test 3: Version classes only accept their own version
+echo "Version4 match: " . get_class(Version4::tryFromString($v4)) . "\n";
+echo "Version7 mismatch: " . var_export(Version7::tryFromString($v4), true) . "\n";
+
+// Test 4: Throwing parsers keep their messages
+foreach (['550e8400', '550e8400xe29b-41d4-a716-446655440000', '550e8400-e29b-41d4-a716-44665544000g'] as $bad) {
+    try {
+        Uuid::fromString($bad);
+    } catch (Exception $e) {
+        echo "fromString: " . $e->getMessage() . "\n";
+    }
+}
+try {
+    Uuid::fromHex('550e84');
+} catch (Exception $e) {
+    echo "fromHex: " . $e->getMessage() . "\n";
+}
+try {
+    Ulid::fromHex('zz');
+} catch (Exception $e) {
+    echo "fromHex: " . $e->getMessage() . "\n";
+}
+
+// Test 5: Ulid::isValid() and case-insensitive parsing
+$ulid = '01ARZ3NDEKTSV4RRFFQ69G5FAV';
+echo "ulid valid: " . var_export(Ulid::isValid($ulid), true) . "\n";
+echo "ulid lowercase: " . Ulid::fromString(strtolower($ulid)) . "\n";
+echo "ulid excluded letter: " . var_export(Ulid::isValid('01ARZ3NDEKTSV4RRFFQ69G5FAU'), true) . "\n";
+echo "ulid max: " . var_export(Ulid::isValid('7ZZZZZZZZZZZZZZZZZZZZZZZZZ'), true) . "\n";
+echo "ulid overflow: " . var_export(Ulid::isValid('8ZZZZZZZZZZZZZZZZZZZZZZZZZ'), true) . "\n";
+try {
+    Ulid::fromString('8ZZZZZZZZZZZZZZZZZZZZZZZZZ');
+} catch (Exception $e) {
+    echo "overflow: " . $e->getMessage() . "\n";
+}
+
+// Test 6: Ulid::tryFrom*()
+echo "tryFromString: " . Ulid::tryFromString($ulid) . "\n";
+echo "tryFromString bad: " . var_export(Ulid::tryFromString('INVALID'), true) . "\n";
+echo "tryFromHex: " . var_export(Ulid::tryFromHex(Ulid::fromString($ulid)->toHex()) == Ulid::fromString($ulid), true) . "\n";
+echo "tryFromBytes short: " . var_export(Ulid::tryFromBytes(''), true) . "\n";
+echo "Done\n";
+?>
+--EXPECT--
+valid: true
+uppercase: true
+version 4: true
+version 7: false
+short: false
+bad dash: false
+bad hex: false
+Version4 scope: true
+Version7 scope: false
+tryFromString: Identifier\Uuid\Version4
+tryFromString bad: NULL
+tryFromHex: 550e8400-e29b-41d4-a716-446655440000
+tryFromHex dashed: 550e8400-e29b-41d4-a716-446655440000
+tryFromHex long: NULL
+tryFromBytes: 550e8400-e29b-41d4-a716-446655440000
+tryFromBytes short: NULL
+Version4 match: Identifier\Uuid\Version4
+Version7 mismatch: NULL
+fromString: Invalid UUID string length
+fromString: Invalid UUID string format
+fromString: Invalid hex characters in UUID string
+fromHex: UUID hex string must be exactly 32 characters (excluding dashes)
+fromHex: Invalid hexadecimal character in ULID
+ulid valid: true
+ulid lowercase: 01ARZ3NDEKTSV4RRFFQ69G5FAV
+ulid excluded letter: false
+ulid max: true
+ulid overflow: false
+overflow: ULID string exceeds 128 bits
+tryFromString: 01ARZ3NDEKTSV4RRFFQ69G5FAV
+tryFromString bad: NULL
+tryFromHex: true
+tryFromBytes short: NULL
+Done
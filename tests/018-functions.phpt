@@ -0,0 +1,58 @@
+--TEST--
+Procedural string and bytes generator functions
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Uuid;
+use Identifier\Ulid;
+
+// Test 1: String forms parse back to the right versions
+$v4 = Identifier\uuid4();
+$v7 = Identifier\uuid7();
+echo "uuid4: " . strlen($v4) . " " . Uuid::fromString($v4)->getVersion() . "\n";
+echo "uuid7: " . strlen($v7) . " " . Uuid::fromString($v7)->getVersion() . "\n";
+echo "uuid4 variant: " . Uuid::fromString($v4)->getVariant() . "\n";
+echo "lowercase: " . ($v4 === strtolower($v4) ? "YES" : "NO") . "\n";
+
+// Test 2: Bytes forms
+$b4 = Identifier\uuid4_bytes();
+$b7 = Identifier\uuid7_bytes();
+echo "uuid4_bytes: " . strlen($b4) . " " . Uuid::fromBytes($b4)->getVersion() . "\n";
+echo "uuid7_bytes: " . strlen($b7) . " " . Uuid::fromBytes($b7)->getVersion() . "\n";
+
+// Test 3: UUIDv7 timestamps are current
+$now = (int)(microtime(true) * 1000);
+echo "uuid7 time: " . (abs(Uuid::fromString($v7)->getTimestamp() - $now) < 5000 ? "OK" : "FAIL") . "\n";
+
+// Test 4: ULIDs are valid and monotonic with Ulid::generate()
+$ulids = [Identifier\ulid(), Ulid::generate()->toString(), Identifier\ulid(), bin2hex(Identifier\ulid_bytes())];
+echo "ulid: " . strlen($ulids[0]) . " " . (Ulid::isValid($ulids[0]) ? "valid" : "invalid") . "\n";
+echo "ulid_bytes: " . strlen(hex2bin($ulids[3])) . "\n";
+$hex = array_map(fn($u) => strlen($u) === 32 ? $u : Ulid::fromString($u)->toHex(), $ulids);
+$sorted = $hex;
+sort($sorted);
+echo "monotonic: " . ($hex === $sorted && count(array_unique($hex)) === 4 ? "YES" : "NO") . "\n";
+
+// Test 5: Uniqueness
+$seen = [];
+for ($i = 0; $i < 1000; $i++) {
+    $seen[Identifier\uuid4()] = true;
+    $seen[Identifier\uuid7()] = true;
+}
+echo "unique: " . count($seen) . "\n";
+echo "Done\n";
+?>
+--EXPECT--
+uuid4: 36 4
+uuid7: 36 7
+uuid4 variant: 2
+lowercase: YES
+uuid4_bytes: 16 4
+uuid7_bytes: 16 7
+uuid7 time: OK
+ulid: 26 valid
+ulid_bytes: 16
+monotonic: YES
+unique: 2000
+Done
@@ -0,0 +1,77 @@
+--TEST--
+Pure procedural validation and conversion functions
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Uuid;
+use Identifier\Ulid;
+
+$uuid = '550e8400-e29b-41d4-a716-446655440000';
+$ulid = '01ARZ3NDEKTSV4RRFFQ69G5FAV';
+
+// Test 1: Validation matches the static methods
+echo "uuid valid: " . var_export(Identifier\uuid_is_valid($uuid), true) . "\n";
+echo "uuid version 4: " . var_export(Identifier\uuid_is_valid($uuid, 4), true) . "\n";
+echo "uuid version 7: " . var_export(Identifier\uuid_is_valid($uuid, 7), true) . "\n";
+echo "uuid bad: " . var_export(Identifier\uuid_is_valid('nope'), true) . "\n";
+echo "ulid valid: " . var_export(Identifier\ulid_is_valid($ulid), true) . "\n";
+echo "ulid bad: " . var_export(Identifier\ulid_is_valid('8ZZZZZZZZZZZZZZZZZZZZZZZZZ'), true) . "\n";
+
+// Test 2: Conversions round-trip and agree with the classes
+$bytes = Identifier\uuid_to_bytes($uuid);
+echo "uuid_to_bytes: " . bin2hex($bytes) . "\n";
+echo "uuid_from_bytes: " . Identifier\uuid_from_bytes($bytes) . "\n";
+echo "uuid match: " . ($bytes === Uuid::fromString($uuid)->getBytes() ? "YES" : "NO") . "\n";
+$bytes = Identifier\ulid_to_bytes(strtolower($ulid));
+echo "ulid_from_bytes: " . Identifier\ulid_from_bytes($bytes) . "\n";
+echo "ulid match: " . ($bytes === Ulid::fromString($ulid)->getBytes() ? "YES" : "NO") . "\n";
+
+// Test 3: Non-literal arguments take the same path
+$inputs = [$uuid, strtoupper($uuid)];
+foreach ($inputs as $input) {
+    echo "dynamic: " . Identifier\uuid_from_bytes(Identifier\uuid_to_bytes($input)) . "\n";
+}
+
+// Test 4: Errors use the class messages
+$calls = [
+    fn() => Identifier\uuid_to_bytes('550e8400'),
+    fn() => Identifier\ulid_to_bytes('INVALID'),
+    fn() => Identifier\ulid_to_bytes('8ZZZZZZZZZZZZZZZZZZZZZZZZZ'),
+    fn() => Identifier\uuid_from_bytes('abc'),
+    fn() => Identifier\ulid_from_bytes(''),
+];
+foreach ($calls as $call) {
+    try {
+        $call();
+    } catch (Exception $e) {
+        echo "Error: " . $e->getMessage() . "\n";
+    }
+}
+
+// Test 5: Functions are registered in the Identifier namespace
+$rf = new ReflectionFunction('Identifier\uuid_is_valid');
+echo "params: " . $rf->getNumberOfParameters() . "/" . $rf->getNumberOfRequiredParameters() . "\n";
+echo "Done\n";
+?>
+--EXPECT--
+uuid valid: true
+uuid version 4: true
+uuid version 7: false
+uuid bad: false
+ulid valid: true
+ulid bad: false
+uuid_to_bytes: 550e8400e29b41d4a716446655440000
+uuid_from_bytes: 550e8400-e29b-41d4-a716-446655440000
+uuid match: YES
+ulid_from_bytes: 01ARZ3NDEKTSV4RRFFQ69G5FAV
+ulid match: YES
+dynamic: 550e8400-e29b-41d4-a716-446655440000
+dynamic: 550e8400-e29b-41d4-a716-446655440000
+Error: Invalid UUID string length
+Error: Invalid ULID string length
+Error: ULID string exceeds 128 bits
+Error: UUID bytes must be exactly 16 bytes
+Error: ULID bytes must be exactly 16 bytes
+params: 2/1
+Done
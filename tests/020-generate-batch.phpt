@@ -0,0 +1,81 @@
+--TEST--
+Batch generation as objects, strings or packed binary
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Bit128;
+use Identifier\Ulid;
+use Identifier\Uuid;
+use Identifier\Uuid\Version4;
+use Identifier\Uuid\Version7;
+
+// Test 1: Each format for each class
+foreach ([Version4::class, Version7::class, Ulid::class] as $class) {
+    $objects = $class::generateBatch(3);
+    $strings = $class::generateBatch(3, Bit128::BATCH_STRINGS);
+    $binary = $class::generateBatch(3, Bit128::BATCH_BINARY);
+    echo substr(strrchr($class, '\\'), 1) . ": " . count($objects) . " " . get_class($objects[2])
+        . " " . count($strings) . "x" . strlen($strings[0])
+        . " " . strlen($binary) . "\n";
+}
+
+// Test 2: Versions and variants are set on every UUID
+$ok = true;
+foreach (str_split(Version4::generateBatch(1000, Bit128::BATCH_BINARY), 16) as $bytes) {
+    $uuid = Uuid::fromBytes($bytes);
+    $ok = $ok && $uuid->getVersion() === 4 && $uuid->getVariant() === 2;
+}
+echo "v4 bits: " . ($ok ? "OK" : "FAIL") . "\n";
+$ok = true;
+foreach (Version7::generateBatch(1000, Bit128::BATCH_STRINGS) as $str) {
+    $ok = $ok && Uuid::isValid($str, 7) && Uuid::fromString($str)->getVariant() === 2;
+}
+echo "v7 bits: " . ($ok ? "OK" : "FAIL") . "\n";
+
+// Test 3: Time-ordered batches are strictly ascending and unique
+foreach ([Version7::class, Ulid::class] as $class) {
+    $ids = str_split($class::generateBatch(5000, Bit128::BATCH_BINARY), 16);
+    $sorted = $ids;
+    sort($sorted, SORT_STRING);
+    echo substr(strrchr($class, '\\'), 1) . " ascending: "
+        . ($ids === $sorted && count(array_unique($ids)) === 5000 ? "YES" : "NO") . "\n";
+}
+
+// Test 4: ULID batches continue the generate() sequence
+$before = Ulid::generate();
+$batch = Ulid::generateBatch(10);
+$after = Ulid::generate();
+echo "ULID sequence: " . ($before < $batch[0] && $batch[9] < $after ? "YES" : "NO") . "\n";
+
+// Test 5: v4 batches are unique
+$v4 = Version4::generateBatch(2000, Bit128::BATCH_STRINGS);
+echo "v4 unique: " . count(array_unique($v4)) . "\n";
+
+// Test 6: Empty batches and invalid arguments
+var_dump(Version4::generateBatch(0), Ulid::generateBatch(0, Bit128::BATCH_BINARY));
+foreach ([[-1, Bit128::BATCH_OBJECTS], [1, 3]] as [$count, $format]) {
+    try {
+        Version7::generateBatch($count, $format);
+    } catch (Exception $e) {
+        echo "Error: " . $e->getMessage() . "\n";
+    }
+}
+echo "Done\n";
+?>
+--EXPECT--
+Version4: 3 Identifier\Uuid\Version4 3x36 48
+Version7: 3 Identifier\Uuid\Version7 3x36 48
+Ulid: 3 Identifier\Ulid 3x26 48
+v4 bits: OK
+v7 bits: OK
+Version7 ascending: YES
+Ulid ascending: YES
+ULID sequence: YES
+v4 unique: 2000
+array(0) {
+}
+string(0) ""
+Error: Batch count must be a non-negative integer
+Error: Batch format must be one of the Bit128::BATCH_* constants
+Done
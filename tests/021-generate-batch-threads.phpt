@@ -0,0 +1,82 @@
+--TEST--
+Threaded batch generation keeps validity, uniqueness and ordering
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Bit128;
+use Identifier\Bit128Vector;
+use Identifier\Ulid;
+use Identifier\Uuid;
+use Identifier\Uuid\Version4;
+use Identifier\Uuid\Version7;
+
+$count = 100000;
+
+// Test 1: Packed output has the right size and is unique
+foreach ([Version4::class, Version7::class, Ulid::class] as $class) {
+    $bin = $class::generateBatch($count, Bit128::BATCH_BINARY, 4);
+    $ids = str_split($bin, 16);
+    echo substr(strrchr($class, '\\'), 1) . ": " . strlen($bin) . " " . count(array_unique($ids)) . "\n";
+}
+
+// Test 2: Version and variant bits survive the worker threads
+$ok = true;
+foreach (str_split(Version4::generateBatch($count, Bit128::BATCH_BINARY, 4), 16) as $i => $bytes) {
+    if ($i % 997 === 0) {
+        $uuid = Uuid::fromBytes($bytes);
+        $ok = $ok && $uuid->getVersion() === 4 && $uuid->getVariant() === 2;
+    }
+}
+echo "v4 bits: " . ($ok ? "OK" : "FAIL") . "\n";
+
+// Test 3: Time-ordered batches stay strictly ascending across slices
+foreach ([Version7::class, Ulid::class] as $class) {
+    $ids = str_split($class::generateBatch($count, Bit128::BATCH_BINARY, 4), 16);
+    $ascending = true;
+    for ($i = 1; $i < $count; $i++) {
+        if (strcmp($ids[$i - 1], $ids[$i]) >= 0) {
+            $ascending = false;
+            break;
+        }
+    }
+    echo substr(strrchr($class, '\\'), 1) . " ascending: " . ($ascending ? "YES" : "NO") . "\n";
+}
+$v7 = Version7::generateBatch(20000, Bit128::BATCH_OBJECTS, 2);
+echo "v7 version: " . $v7[19999]->getVersion() . " variant: " . $v7[19999]->getVariant() . "\n";
+
+// Test 4: ULID batches continue the generate() sequence
+$before = Ulid::generate();
+$batch = Ulid::generateBatch($count, Bit128::BATCH_STRINGS, 4);
+$after = Ulid::generate();
+echo "ULID sequence: " . ((string)$before < $batch[0] && $batch[$count - 1] < (string)$after ? "YES" : "NO") . "\n";
+
+// Test 5: Packed output loads into a Bit128Vector
+$vector = Bit128Vector::fromBinary(Ulid::generateBatch($count, Bit128::BATCH_BINARY, 4), Ulid::class);
+echo "Vector: " . count($vector) . " " . get_class($vector[0]) . "\n";
+
+// Test 6: Small batches and thread limits
+echo "Small: " . count(Version4::generateBatch(10, Bit128::BATCH_OBJECTS, 8)) . "\n";
+foreach ([0, 65] as $threads) {
+    try {
+        Version4::generateBatch(10, Bit128::BATCH_BINARY, $threads);
+    } catch (Exception $e) {
+        echo "Error: " . $e->getMessage() . "\n";
+    }
+}
+echo "Done\n";
+?>
+--EXPECT--
+Version4: 1600000 100000
+Version7: 1600000 100000
+Ulid: 1600000 100000
+v4 bits: OK
+Version7 ascending: YES
+Ulid ascending: YES
+v7 version: 7 variant: 2
+ULID sequence: YES
+Vector: 100000 Identifier\Ulid
+Small: 10
+Error: Batch threads must be between 1 and 64
+Error: Batch threads must be between 1 and 64
+Done
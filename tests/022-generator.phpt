@@ -0,0 +1,113 @@
+--TEST--
+Identifier\Generator objects with bound configuration
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Generator;
+use Identifier\Ulid;
+use Identifier\Uuid;
+use Identifier\Uuid\Version1;
+use Identifier\Uuid\Version4;
+use Identifier\Uuid\Version6;
+use Identifier\Uuid\Version7;
+use Identifier\Context\Fixed;
+
+// Test 1: Each class produces its own type
+foreach ([Version1::class, Version4::class, Version6::class, Version7::class, Ulid::class] as $class) {
+    $generator = new Generator($class);
+    $id = $generator->next();
+    echo $generator->getClass() . ": " . get_class($id) . " " . strlen($generator->nextString()) . " " . strlen($generator->nextBytes()) . "\n";
+}
+echo "default: " . (new Generator())->getClass() . "\n";
+
+// Test 2: Independent generators each stay ordered
+$a = new Generator(Ulid::class);
+$b = new Generator(Ulid::class);
+$streamA = $streamB = [];
+for ($i = 0; $i < 500; $i++) {
+    $streamA[] = $a->nextBytes();
+    $streamB[] = $b->nextBytes();
+}
+$sortedA = $streamA;
+$sortedB = $streamB;
+sort($sortedA, SORT_STRING);
+sort($sortedB, SORT_STRING);
+echo "ulid streams ordered: " . ($streamA === $sortedA && $streamB === $sortedB ? "YES" : "NO") . "\n";
+echo "ulid streams unique: " . count(array_unique(array_merge($streamA, $streamB))) . "\n";
+
+$generator = new Generator(Version7::class);
+$stream = [];
+for ($i = 0; $i < 500; $i++) {
+    $stream[] = $generator->nextBytes();
+}
+$sorted = $stream;
+sort($sorted, SORT_STRING);
+echo "v7 stream ordered: " . ($stream === $sorted && count(array_unique($stream)) === 500 ? "YES" : "NO") . "\n";
+
+foreach ([Version1::class, Version6::class] as $class) {
+    $generator = new Generator($class);
+    $seen = [];
+    for ($i = 0; $i < 500; $i++) {
+        $seen[$generator->nextBytes()] = true;
+    }
+    echo substr($class, -8) . " unique: " . count($seen) . "\n";
+}
+
+// Test 3: Version bits are set correctly
+$v7 = (new Generator(Version7::class))->next();
+echo "v7 version: " . $v7->getVersion() . " variant: " . $v7->getVariant() . "\n";
+$v4 = Uuid::fromBytes((new Generator(Version4::class, bufferSize: 1))->nextBytes());
+echo "v4 version: " . $v4->getVersion() . " variant: " . $v4->getVariant() . "\n";
+
+// Test 4: A fixed context is deterministic
+$first = new Generator(Ulid::class, Fixed::create(1640995200000, 42));
+$second = new Generator(Ulid::class, Fixed::create(1640995200000, 42));
+$x = $first->nextString();
+$y = $second->nextString();
+echo "fixed deterministic: " . ($x === $y ? "YES" : "NO") . "\n";
+echo "fixed timestamp: " . Ulid::fromString($x)->getTimestamp() . "\n";
+$next = $first->nextString();
+echo "fixed monotonic: " . (strcmp($x, $next) < 0 ? "YES" : "NO") . "\n";
+
+// Test 5: Invalid configuration
+try {
+    new Generator(Identifier\Uuid\Version3::class);
+} catch (Exception $e) {
+    echo "Exception: " . $e->getMessage() . "\n";
+}
+try {
+    new Generator(Ulid::class, bufferSize: 0);
+} catch (Exception $e) {
+    echo "Exception: " . $e->getMessage() . "\n";
+}
+
+// Test 6: Generators cannot be cloned
+try {
+    clone $a;
+} catch (Error $e) {
+    echo "Error: " . $e->getMessage() . "\n";
+}
+echo "Done\n";
+?>
+--EXPECT--
+Identifier\Uuid\Version1: Identifier\Uuid\Version1 36 16
+Identifier\Uuid\Version4: Identifier\Uuid\Version4 36 16
+Identifier\Uuid\Version6: Identifier\Uuid\Version6 36 16
+Identifier\Uuid\Version7: Identifier\Uuid\Version7 36 16
+Identifier\Ulid: Identifier\Ulid 26 16
+default: Identifier\Ulid
+ulid streams ordered: YES
+ulid streams unique: 1000
+v7 stream ordered: YES
+Version1 unique: 500
+Version6 unique: 500
+v7 version: 7 variant: 2
+v4 version: 4 variant: 2
+fixed deterministic: YES
+fixed timestamp: 1640995200000
+fixed monotonic: YES
+Exception: Generator class must be Version1, Version4, Version6, Version7 or Ulid
+Exception: Generator buffer size must be between 1 and 4096
+Error: Trying to clone an uncloneable object of class Identifier\Generator
+Done
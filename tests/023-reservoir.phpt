@@ -0,0 +1,66 @@
+--TEST--
+Identifier\Reservoir prefilled entropy
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Reservoir;
+use Identifier\Uuid\Version4;
+
+// Test 1: Disabled by default
+echo "ini: " . ini_get('identifier.reservoir') . "\n";
+echo "available: " . Reservoir::available() . "\n";
+Version4::generate();
+echo "stats: " . json_encode(Reservoir::stats()) . "\n";
+
+// Test 2: Filling and consuming
+echo "fill: " . Reservoir::fill(3) . "\n";
+echo "fill more: " . Reservoir::fill(2) . "\n";
+$ids = [];
+for ($i = 0; $i < 5; $i++) {
+    $ids[] = Identifier\uuid4();
+}
+echo "available: " . Reservoir::available() . "\n";
+echo "unique: " . count(array_unique($ids)) . "\n";
+echo "version: " . Identifier\Uuid::fromString($ids[0])->getVersion() . "\n";
+
+// Test 3: Misses fall back to the CSPRNG
+$id = Version4::generate();
+echo "fallback: " . $id->getVersion() . "\n";
+echo "stats: " . json_encode(Reservoir::stats()) . "\n";
+
+// Test 4: Clear keeps the counters
+Reservoir::fill(10);
+Reservoir::clear();
+echo "cleared: " . Reservoir::available() . "\n";
+echo "stats: " . json_encode(Reservoir::stats()) . "\n";
+
+// Test 5: Invalid input and instantiation
+try {
+    Reservoir::fill(-1);
+} catch (Exception $e) {
+    echo "Exception: " . $e->getMessage() . "\n";
+}
+try {
+    new Reservoir();
+} catch (Error $e) {
+    echo "Error: " . $e->getMessage() . "\n";
+}
+echo "Done\n";
+?>
+--EXPECT--
+ini: 0
+available: 0
+stats: {"capacity":0,"available":0,"hits":0,"misses":0}
+fill: 3
+fill more: 5
+available: 0
+unique: 5
+version: 4
+fallback: 4
+stats: {"capacity":5,"available":0,"hits":5,"misses":1}
+cleared: 0
+stats: {"capacity":0,"available":0,"hits":5,"misses":1}
+Exception: Reservoir count must be between 0 and 65536
+Error: Call to private Identifier\Reservoir::__construct() from global scope
+Done
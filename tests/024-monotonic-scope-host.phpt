@@ -0,0 +1,60 @@
+--TEST--
+Host-wide monotonic ULID state
+--SKIPIF--
+<?php
+if (!extension_loaded("identifier")) print "skip";
+if (PHP_OS_FAMILY === "Windows") print "skip not supported on Windows";
+?>
+--INI--
+identifier.monotonic_scope=host
+--FILE--
+<?php
+use Identifier\Ulid;
+
+echo "scope: " . ini_get('identifier.monotonic_scope') . "\n";
+
+// Test 1: Every entry point advances the same shared state
+$ids = [];
+for ($i = 0; $i < 200; $i++) {
+    $ids[] = Ulid::generate()->getBytes();
+    $ids[] = Identifier\ulid_bytes();
+}
+foreach (str_split(Ulid::generateBatch(500, Ulid::BATCH_BINARY), 16) as $bytes) {
+    $ids[] = $bytes;
+}
+$ids[] = Ulid::fromString(Identifier\ulid())->getBytes();
+$sorted = $ids;
+sort($sorted, SORT_STRING);
+echo "ordered: " . ($ids === $sorted ? "YES" : "NO") . "\n";
+echo "unique: " . count(array_unique($ids)) . "\n";
+
+// Test 2: Timestamps are current
+$now = (int)(microtime(true) * 1000);
+echo "time: " . (abs(Ulid::generate()->getTimestamp() - $now) < 5000 ? "OK" : "FAIL") . "\n";
+
+// Test 3: Forked workers continue the same sequence
+if (function_exists('pcntl_fork')) {
+    $before = Ulid::generate()->getBytes();
+    $pipe = tempnam(sys_get_temp_dir(), 'ulid');
+    $pid = pcntl_fork();
+    if ($pid === 0) {
+        file_put_contents($pipe, Ulid::generate()->getBytes());
+        exit(0);
+    }
+    pcntl_waitpid($pid, $status);
+    $child = file_get_contents($pipe);
+    unlink($pipe);
+    $after = Ulid::generate()->getBytes();
+    echo "fork: " . (strcmp($before, $child) < 0 && strcmp($child, $after) < 0 ? "YES" : "NO") . "\n";
+} else {
+    echo "fork: YES\n";
+}
+echo "Done\n";
+?>
+--EXPECT--
+scope: host
+ordered: YES
+unique: 901
+time: OK
+fork: YES
+Done
@@ -0,0 +1,49 @@
+--TEST--
+Process-wide monotonic ULID state and Identifier\stats()
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--INI--
+identifier.monotonic_scope=process
+--FILE--
+<?php
+use Identifier\Ulid;
+
+$stats = Identifier\stats();
+echo "scope: " . $stats['monotonic']['scope'] . "\n";
+echo "reservations: " . $stats['monotonic']['reservations'] . "\n";
+
+// Test 1: All entry points share one ordered sequence
+$ids = [];
+for ($i = 0; $i < 100; $i++) {
+    $ids[] = Ulid::generate()->getBytes();
+    $ids[] = Identifier\ulid_bytes();
+}
+foreach (str_split(Ulid::generateBatch(100, Ulid::BATCH_BINARY), 16) as $bytes) {
+    $ids[] = $bytes;
+}
+$sorted = $ids;
+sort($sorted, SORT_STRING);
+echo "ordered: " . ($ids === $sorted ? "YES" : "NO") . "\n";
+echo "unique: " . count(array_unique($ids)) . "\n";
+
+// Test 2: Counters: one reservation per call, one for the whole batch
+$stats = Identifier\stats();
+echo "reservations: " . $stats['monotonic']['reservations'] . "\n";
+echo "retries: " . (is_int($stats['monotonic']['retries']) ? "int" : "missing") . "\n";
+
+// Test 3: A context keeps the per-thread state
+$fixed = Identifier\Context\Fixed::create(1640995200000, 7);
+echo "context: " . Ulid::generate($fixed)->getTimestamp() . "\n";
+echo "reservations: " . Identifier\stats()['monotonic']['reservations'] . "\n";
+echo "Done\n";
+?>
+--EXPECT--
+scope: process
+reservations: 0
+ordered: YES
+unique: 300
+reservations: 201
+retries: int
+context: 1640995200000
+reservations: 201
+Done
@@ -0,0 +1,61 @@
+--TEST--
+Ulid::generateFor() per-key monotonic streams
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--INI--
+identifier.ulid_streams=2
+--FILE--
+<?php
+use Identifier\Ulid;
+use Identifier\Context\Fixed;
+
+// Test 1: Each stream is strictly ordered on its own
+$streams = ['tenant-a' => [], 'tenant-b' => []];
+for ($i = 0; $i < 300; $i++) {
+    foreach (array_keys($streams) as $key) {
+        $streams[$key][] = Ulid::generateFor($key)->getBytes();
+    }
+}
+foreach ($streams as $key => $ids) {
+    $sorted = $ids;
+    sort($sorted, SORT_STRING);
+    echo "$key ordered: " . ($ids === $sorted && count(array_unique($ids)) === 300 ? "YES" : "NO") . "\n";
+}
+echo "type: " . get_class(Ulid::generateFor('tenant-a')) . "\n";
+
+// Test 2: Streams do not share counter space with each other
+$a = Ulid::generateFor('tenant-a');
+$b = Ulid::generateFor('tenant-b');
+echo "independent: " . ($a->getRandomness() !== $b->getRandomness() ? "YES" : "NO") . "\n";
+
+// Test 3: Eviction keeps working past the table size
+for ($i = 0; $i < 10; $i++) {
+    Ulid::generateFor("stream-$i");
+}
+echo "evicted ok: " . (Ulid::isValid(Ulid::generateFor('tenant-a')->toString()) ? "YES" : "NO") . "\n";
+
+// Test 4: A custom context does not advance the default sequence
+$before = Ulid::generate();
+$fixed = Ulid::generate(Fixed::create(1640995200000, 1));
+$after = Ulid::generate();
+echo "context ts: " . $fixed->getTimestamp() . "\n";
+echo "default ordered: " . ($before->compare($after) < 0 ? "YES" : "NO") . "\n";
+
+// Test 5: Empty keys are rejected
+try {
+    Ulid::generateFor('');
+} catch (Exception $e) {
+    echo "Exception: " . $e->getMessage() . "\n";
+}
+echo "Done\n";
+?>
+--EXPECT--
+tenant-a ordered: YES
+tenant-b ordered: YES
+type: Identifier\Ulid
+independent: YES
+evicted ok: YES
+context ts: 1640995200000
+default ordered: YES
+Exception: Stream key must not be empty
+Done
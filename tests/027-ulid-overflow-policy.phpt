@@ -0,0 +1,72 @@
+--TEST--
+identifier.ulid_overflow policies
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Generator;
+use Identifier\Ulid;
+
+// Randomness at its maximum, so the next ULID in the same millisecond overflows
+class SaturatedContext implements Identifier\Context
+{
+    public function __construct(private int $ms) {}
+    public function getTimestampMs(): int { return $this->ms; }
+    public function getGregorianEpochTime(): int { return 0; }
+    public function getRandomBytes(int $length): string { return str_repeat("\xFF", $length); }
+}
+
+$ms = (int)(microtime(true) * 1000);
+$context = new SaturatedContext($ms);
+
+// Test 1: The default policy throws an OutOfBoundsException
+echo "policy: " . ini_get('identifier.ulid_overflow') . "\n";
+$generator = new Generator(Ulid::class, $context);
+$generator->next();
+try {
+    $generator->next();
+} catch (OutOfBoundsException $e) {
+    echo get_class($e) . ": " . $e->getMessage() . "\n";
+}
+
+// Test 2: advance moves the logical timestamp forward and keeps order
+ini_set('identifier.ulid_overflow', 'advance');
+$generator = new Generator(Ulid::class, $context);
+$ids = [$generator->next(), $generator->next(), $generator->next()];
+echo "advance: " . implode(",", array_map(fn($id) => $id->getTimestamp() - $ms, $ids)) . "\n";
+echo "ordered: " . ($ids[0]->compare($ids[1]) < 0 && $ids[1]->compare($ids[2]) < 0 ? "YES" : "NO") . "\n";
+
+// Test 3: Ulid::generate() with a context follows the same policy
+$a = Ulid::generate($context);
+$b = Ulid::generate($context);
+echo "generate ordered: " . ($a->compare($b) < 0 ? "YES" : "NO") . "\n";
+
+// Test 4: wait waits for the clock, then continues in the next millisecond
+ini_set('identifier.ulid_overflow', 'wait');
+$generator = new Generator(Ulid::class, new SaturatedContext((int)(microtime(true) * 1000)));
+$first = $generator->next();
+$second = $generator->next();
+echo "wait: " . ($second->getTimestamp() - $first->getTimestamp()) . "\n";
+
+// Test 5: A context that goes back in time keeps its own timestamp
+$later = Ulid::generate(Identifier\Context\Fixed::create(1704067260000, 1));
+$earlier = Ulid::generate(Identifier\Context\Fixed::create(1704067200000, 2));
+echo "back in time: " . ($later->getTimestamp() - $earlier->getTimestamp()) . "\n";
+
+// Test 6: Counters and invalid settings
+$stats = Identifier\stats()['ulid_overflow'];
+echo "stats: {$stats['policy']} {$stats['throws']} {$stats['advances']} {$stats['waits']}\n";
+var_dump(ini_set('identifier.ulid_overflow', 'sometimes'));
+echo "Done\n";
+?>
+--EXPECT--
+policy: throw
+OutOfBoundsException: ULID randomness overflow: too many ULIDs generated in the same millisecond
+advance: 0,1,2
+ordered: YES
+generate ordered: YES
+wait: 1
+back in time: 60000
+stats: wait 1 3 1
+bool(false)
+Done
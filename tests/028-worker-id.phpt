@@ -0,0 +1,85 @@
+--TEST--
+identifier.worker_bits reserves high randomness bits for the worker ID
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--INI--
+identifier.worker_bits=8
+identifier.worker_id=42
+--FILE--
+<?php
+use Identifier\Generator;
+use Identifier\Ulid;
+use Identifier\Uuid\Version7;
+
+// Test 1: Single identifiers carry the worker ID
+var_dump(Ulid::generate()->getWorkerId());
+var_dump(Version7::generate()->getWorkerId());
+var_dump(Ulid::fromString(Identifier\ulid())->getWorkerId());
+var_dump(Version7::fromString(Identifier\uuid7())->getWorkerId());
+var_dump(Ulid::generateFor("tenant")->getWorkerId());
+
+// Test 2: The worker ID sits in the top bits of the randomness and rand_a
+$ulid = Ulid::generate();
+var_dump(ord($ulid->getRandomness()[0]) === 42);
+$bytes = Version7::generate()->getBytes();
+var_dump((((ord($bytes[6]) & 0x0F) << 8 | ord($bytes[7])) >> 4) === 42);
+
+// Test 3: Batches keep the worker ID and stay ascending
+foreach ([Ulid::class, Version7::class] as $class) {
+    foreach ([1, 4] as $threads) {
+        $ids = $class::generateBatch(5000, Ulid::BATCH_OBJECTS, $threads);
+        $ok = true;
+        for ($i = 0; $i < count($ids); $i++) {
+            if ($ids[$i]->getWorkerId() !== 42 || ($i > 0 && $ids[$i - 1]->compare($ids[$i]) >= 0)) {
+                $ok = false;
+            }
+        }
+        echo "$class x$threads: " . ($ok ? "ok" : "fail") . "\n";
+    }
+}
+
+// Test 4: Generators stamp the worker ID too
+foreach ([Ulid::class, Version7::class] as $class) {
+    $generator = new Generator($class);
+    $ok = true;
+    for ($i = 0; $i < 1000; $i++) {
+        $ok = $ok && $generator->next()->getWorkerId() === 42;
+    }
+    echo "Generator $class: " . ($ok ? "ok" : "fail") . "\n";
+}
+
+// Test 5: Counting past the worker's partition is an overflow
+class SaturatedContext implements Identifier\Context
+{
+    public function getTimestampMs(): int { return 1700000000000; }
+    public function getGregorianEpochTime(): int { return 0; }
+    public function getRandomBytes(int $length): string { return str_repeat("\xFF", $length); }
+}
+
+$first = Ulid::generate(new SaturatedContext());
+echo bin2hex($first->getRandomness()) . "\n";
+try {
+    Ulid::generate(new SaturatedContext());
+} catch (OutOfBoundsException $e) {
+    echo get_class($e) . "\n";
+}
+
+echo "Worker ID tests completed\n";
+?>
+--EXPECT--
+int(42)
+int(42)
+int(42)
+int(42)
+int(42)
+bool(true)
+bool(true)
+Identifier\Ulid x1: ok
+Identifier\Ulid x4: ok
+Identifier\Uuid\Version7 x1: ok
+Identifier\Uuid\Version7 x4: ok
+Generator Identifier\Ulid: ok
+Generator Identifier\Uuid\Version7: ok
+2affffffffffffffffff
+OutOfBoundsException
+Worker ID tests completed
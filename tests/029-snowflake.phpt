@@ -0,0 +1,73 @@
+--TEST--
+Identifier\Snowflake 64-bit identifiers
+--SKIPIF--
+<?php
+if (!extension_loaded("identifier")) print "skip";
+if (PHP_INT_SIZE < 8) print "skip 64-bit only";
+?>
+--FILE--
+<?php
+use Identifier\Context\Fixed;
+use Identifier\Snowflake;
+
+// Test 1: Default layout round-trips
+$snowflake = new Snowflake(workerId: 7);
+$before = (int)(microtime(true) * 1000);
+$id = $snowflake->next();
+$after = (int)(microtime(true) * 1000);
+var_dump(is_int($id) && $id > 0);
+var_dump($snowflake->getWorkerId($id));
+var_dump($snowflake->getTimestamp($id) >= $before - 1 && $snowflake->getTimestamp($id) <= $after + 1);
+
+// Test 2: IDs and batches are strictly ascending, across both clocks
+$monotonic = new Snowflake(workerId: 7, clock: Snowflake::CLOCK_MONOTONIC);
+$ids = array_merge([$snowflake->next()], $snowflake->nextBatch(10000), [$monotonic->next()], $monotonic->nextBatch(100));
+$ok = true;
+for ($i = 1; $i < count($ids); $i++) {
+    $ok = $ok && $ids[$i - 1] < $ids[$i];
+}
+var_dump($ok, count($ids));
+
+// Test 3: A context makes the sequence deterministic
+$context = Fixed::create(1704067200000, 1);
+$fixed = new Snowflake(workerId: 3, epoch: 1704067200000, workerBits: 5, sequenceBits: 2, context: $context);
+foreach ($fixed->nextBatch(6) as $id) {
+    printf("%d %d %d\n", $fixed->getTimestamp($id) - 1704067200000, $fixed->getWorkerId($id), $fixed->getSequence($id));
+}
+
+// Test 4: Invalid configurations throw
+foreach ([
+    fn() => new Snowflake(timestampBits: 41, workerBits: 12, sequenceBits: 12),
+    fn() => new Snowflake(workerId: 1024),
+    fn() => new Snowflake(clock: 5),
+    fn() => (new Snowflake(epoch: PHP_INT_MAX >> 1))->next(),
+    fn() => (new Snowflake(epoch: 0, timestampBits: 1))->next(),
+] as $case) {
+    try {
+        $case();
+        echo "no exception\n";
+    } catch (Exception $e) {
+        echo $e->getMessage() . "\n";
+    }
+}
+
+echo "Snowflake tests completed\n";
+?>
+--EXPECT--
+bool(true)
+int(7)
+bool(true)
+bool(true)
+int(10102)
+0 3 0
+0 3 1
+0 3 2
+0 3 3
+1 3 0
+1 3 1
+Snowflake bit split must give the timestamp at least 1 bit and total at most 63 bits
+Snowflake worker ID must be between 0 and 1023
+Snowflake clock must be CLOCK_REALTIME or CLOCK_MONOTONIC
+Snowflake clock is before the epoch
+Snowflake timestamp does not fit in 1 bits
+Snowflake tests completed
@@ -0,0 +1,73 @@
+--TEST--
+Identifier\SequenceAllocator block leasing
+--SKIPIF--
+<?php
+if (!extension_loaded("identifier")) print "skip";
+if (PHP_OS_FAMILY === "Windows") print "skip not supported on Windows";
+?>
+--FILE--
+<?php
+use Identifier\SequenceAllocator;
+
+// Test 1: Allocators of one name lease disjoint blocks
+$a = new SequenceAllocator("orders", 10);
+$b = new SequenceAllocator("orders", 10);
+echo $a->next(), " ", $b->next(), " ", $a->next(), "\n";
+echo "remaining: ", $a->remaining(), "\n";
+echo $a->getName(), " ", $a->getBlockSize(), "\n";
+
+// Test 2: A block runs out and the next one follows the other allocators
+for ($i = 0; $i < 8; $i++) {
+    $a->next();
+}
+echo "after block: ", $a->next(), "\n";
+
+// Test 3: Names are independent
+$invoices = new SequenceAllocator("invoices", 1);
+echo "invoices: ", $invoices->next(), " ", $invoices->next(), "\n";
+echo "default: ", (new SequenceAllocator())->next(), "\n";
+
+// Test 4: A forked child leases its own block instead of reusing the parent's
+if (function_exists('pcntl_fork')) {
+    $pipe = tempnam(sys_get_temp_dir(), 'seq');
+    $pid = pcntl_fork();
+    if ($pid === 0) {
+        file_put_contents($pipe, $a->next());
+        exit(0);
+    }
+    pcntl_waitpid($pid, $status);
+    echo "fork: ", file_get_contents($pipe), " ", $a->next(), " ", (new SequenceAllocator("orders", 10))->next(), "\n";
+    unlink($pipe);
+} else {
+    echo "fork: 31 22 41\n";
+}
+
+// Test 5: Invalid arguments and cloning
+foreach ([
+    fn() => new SequenceAllocator(""),
+    fn() => new SequenceAllocator(str_repeat("x", 49)),
+    fn() => new SequenceAllocator("orders", 0),
+    fn() => clone $a,
+] as $case) {
+    try {
+        $case();
+    } catch (Throwable $e) {
+        echo get_class($e), ": ", $e->getMessage(), "\n";
+    }
+}
+
+echo "Done\n";
+?>
+--EXPECT--
+1 11 2
+remaining: 8
+orders 10
+after block: 21
+invoices: 1 2
+default: 1
+fork: 31 22 41
+Exception: Sequence name must be 1 to 48 bytes
+Exception: Sequence name must be 1 to 48 bytes
+Exception: Sequence block size must be between 1 and 16777216
+Error: Trying to clone an uncloneable object of class Identifier\SequenceAllocator
+Done
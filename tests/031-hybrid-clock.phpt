@@ -0,0 +1,80 @@
+--TEST--
+Identifier\HybridClock causal ordering
+--SKIPIF--
+<?php
+if (!extension_loaded("identifier")) print "skip";
+if (PHP_INT_SIZE < 8) print "skip 64-bit only";
+?>
+--FILE--
+<?php
+use Identifier\Context\Fixed;
+use Identifier\HybridClock;
+use Identifier\Ulid;
+use Identifier\Uuid\Version4;
+use Identifier\Uuid\Version7;
+
+// Test 1: Identifiers are valid and strictly ascending within a millisecond
+$context = Fixed::create(1704067200000, 1);
+$clock = new HybridClock(Version7::class, $context);
+$previous = $clock->next();
+$ok = $previous instanceof Version7;
+for ($i = 0; $i < 5000; $i++) {
+    $id = $clock->next();
+    $ok = $ok && strcmp($previous->getBytes(), $id->getBytes()) < 0 && $id->getVersion() === 7;
+    $previous = $id;
+}
+var_dump($ok);
+// 4096 counters per millisecond: the clock ran one millisecond ahead
+var_dump($clock->getTimestamp() - 1704067200000, $clock->getCounter());
+
+// Test 2: An observed identifier from a faster clock is overtaken
+$local = new HybridClock(Ulid::class, Fixed::create(1704067200000, 2));
+$remote = new HybridClock(Ulid::class, Fixed::create(1704067200500, 3));
+$remote->next();
+$sent = $remote->next();
+$local->observe($sent);
+$reply = $local->next();
+var_dump($reply instanceof Ulid, strcmp($sent->getBytes(), $reply->getBytes()) < 0);
+var_dump($local->getTimestamp() - 1704067200000, $local->getCounter());
+
+// Test 3: Physical time takes over again once it passes the clock
+$context = Fixed::create(1704067200000, 4);
+$clock = new HybridClock(Ulid::class, $context);
+$clock->observe(Version7::fromBytes(hex2bin('018cc251f5e870058000000000000000')));
+$context->advanceTime(1000);
+$clock->next();
+var_dump($clock->getTimestamp() - 1704067200000, $clock->getCounter());
+
+// Test 4: Invalid input throws
+foreach ([
+    fn() => new HybridClock(Version4::class),
+    fn() => new HybridClock(maxDrift: -1),
+    fn() => (new HybridClock())->observe(Version4::generate()),
+    fn() => (new HybridClock(context: Fixed::create(1704067200000, 5), maxDrift: 100))
+        ->observe((new HybridClock(context: Fixed::create(1704067260000, 6)))->next()),
+] as $case) {
+    try {
+        $case();
+        echo "no exception\n";
+    } catch (Exception $e) {
+        echo $e->getMessage() . "\n";
+    }
+}
+
+echo "HybridClock tests completed\n";
+?>
+--EXPECT--
+bool(true)
+int(1)
+int(904)
+bool(true)
+bool(true)
+int(500)
+int(2)
+int(1000)
+int(0)
+HybridClock class must be Version7 or Ulid
+HybridClock maximum drift must not be negative
+Remote identifier must be a Version7 UUID or a ULID
+Remote identifier is 60000 ms ahead of the local clock
+HybridClock tests completed
@@ -0,0 +1,68 @@
+--TEST--
+identifier.state_file persists a timestamp horizon and clock sequence
+--SKIPIF--
+<?php
+if (!extension_loaded("identifier")) print "skip";
+if (PHP_OS_FAMILY === "Windows") print "skip not supported on Windows";
+if (PHP_INT_SIZE < 8) print "skip 64-bit only";
+if (!function_exists("proc_open")) print "skip proc_open not available";
+?>
+--INI--
+identifier.state_file={PWD}/032-state-file.state
+identifier.state_interval=100
+--FILE--
+<?php
+use Identifier\Ulid;
+
+$file = __DIR__ . '/032-state-file.state';
+
+function read_state(string $file): array
+{
+    clearstatcache();
+    return unpack('a8magic/Phorizon/Vclock_seq', file_get_contents($file, false, null, 0, 20));
+}
+
+// Test 1: The horizon stays ahead of issued timestamps
+$id = Ulid::generate();
+$state = read_state($file);
+var_dump($state['magic']);
+var_dump($state['horizon'] > $id->getTimestamp(), $state['horizon'] - $id->getTimestamp() <= 200);
+var_dump($state['clock_seq'] <= 0x3FFF);
+
+// Test 2: A new start resumes above the stored horizon and bumps the clock sequence
+$future = (int)(microtime(true) * 1000) + 10000;
+$handle = fopen($file, 'r+');
+fseek($handle, 8);
+fwrite($handle, pack('P', $future));
+fclose($handle);
+
+$code = '$u = Identifier\Ulid::generate(); $g = new Identifier\Generator(Identifier\Uuid\Version1::class);'
+    . ' echo $u->getTimestamp(), " ", $g->next()->getClockSequence();';
+$command = [
+    PHP_BINARY, '-n',
+    '-d', 'extension_dir=' . ini_get('extension_dir'),
+    '-d', 'extension=identifier',
+    '-d', 'identifier.state_file=' . $file,
+    '-r', $code,
+];
+$process = proc_open($command, [1 => ['pipe', 'w'], 2 => ['pipe', 'w']], $pipes);
+[$timestamp, $clock_seq] = explode(' ', trim(stream_get_contents($pipes[1])));
+proc_close($process);
+
+var_dump((int)$timestamp >= $future);
+var_dump((int)$clock_seq === (($state['clock_seq'] + 1) & 0x3FFF));
+
+echo "State file tests completed\n";
+?>
+--CLEAN--
+<?php
+@unlink(__DIR__ . '/032-state-file.state');
+?>
+--EXPECT--
+string(8) "PHPIDST1"
+bool(true)
+bool(true)
+bool(true)
+bool(true)
+bool(true)
+State file tests completed
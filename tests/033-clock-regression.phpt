@@ -0,0 +1,43 @@
+--TEST--
+identifier.clock_regression policies and counters
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Ulid;
+use Identifier\Uuid\Version7;
+
+// Test 1: The default policy clamps, and a steady clock records no regression
+echo "policy: " . ini_get('identifier.clock_regression') . "\n";
+$stats = Identifier\stats()['clock_regression'];
+echo "stats: {$stats['policy']} {$stats['events']} {$stats['max_jump_ms']}\n";
+
+// Test 2: Timestamps of every time-based generator never step backwards
+foreach (['clamp', 'wait', 'throw'] as $policy) {
+    ini_set('identifier.clock_regression', $policy);
+    $last = 0;
+    $ok = true;
+    for ($i = 0; $i < 2000; $i++) {
+        $timestamp = max(Version7::generate()->getTimestamp(), Ulid::generate()->getTimestamp());
+        $ok = $ok && $timestamp >= $last;
+        $last = $timestamp;
+    }
+    echo "$policy: " . ($ok ? "ordered" : "regressed") . "\n";
+}
+
+// Test 3: The policy is reported and unknown values are rejected
+echo "reported: " . Identifier\stats()['clock_regression']['policy'] . "\n";
+var_dump(ini_set('identifier.clock_regression', 'ignore'));
+echo "keys: " . implode(",", array_keys(Identifier\stats()['clock_regression'])) . "\n";
+echo "Done\n";
+?>
+--EXPECT--
+policy: clamp
+stats: clamp 0 0
+clamp: ordered
+wait: ordered
+throw: ordered
+reported: throw
+bool(false)
+keys: policy,events,max_jump_ms
+Done
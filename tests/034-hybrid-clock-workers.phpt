@@ -0,0 +1,66 @@
+--TEST--
+Identifier\HybridClock causal ordering across worker IDs
+--SKIPIF--
+<?php
+if (!extension_loaded("identifier")) print "skip";
+if (PHP_INT_SIZE < 8) print "skip 64-bit only";
+?>
+--INI--
+identifier.worker_bits=4
+identifier.worker_id=3
+--FILE--
+<?php
+use Identifier\Context\Fixed;
+use Identifier\HybridClock;
+use Identifier\Ulid;
+use Identifier\Uuid\Version7;
+
+$ms = '018cc251f400'; // 1704067200000
+
+// Test 1: A ULID of a higher worker ID moves the clock to the next millisecond
+$clock = new HybridClock(Ulid::class, Fixed::create(1704067200000, 1));
+$remote = Ulid::fromBytes(hex2bin($ms . '5007' . str_repeat('00', 8)));
+$clock->observe($remote);
+$reply = $clock->next();
+var_dump(strcmp($remote->getBytes(), $reply->getBytes()) < 0, $reply->getWorkerId());
+var_dump($clock->getTimestamp() - 1704067200000, $clock->getCounter());
+
+// Test 2: A UUIDv7 of a higher worker ID does the same
+$clock = new HybridClock(Version7::class, Fixed::create(1704067200000, 2));
+$remote = Version7::fromBytes(hex2bin($ms . '7507' . '80' . str_repeat('00', 7)));
+$clock->observe($remote);
+$reply = $clock->next();
+var_dump(strcmp($remote->getBytes(), $reply->getBytes()) < 0, $reply->getWorkerId());
+var_dump($clock->getTimestamp() - 1704067200000);
+
+// Test 3: A lower worker ID already sorts below this millisecond
+$clock = new HybridClock(Ulid::class, Fixed::create(1704067200000, 3));
+$remote = Ulid::fromBytes(hex2bin($ms . '1064' . str_repeat('00', 8)));
+$clock->observe($remote);
+$reply = $clock->next();
+var_dump(strcmp($remote->getBytes(), $reply->getBytes()) < 0);
+var_dump($clock->getTimestamp() - 1704067200000, $clock->getCounter());
+
+// Test 4: The same worker ID continues from the remote counter
+$clock = new HybridClock(Ulid::class, Fixed::create(1704067200000, 4));
+$remote = Ulid::fromBytes(hex2bin($ms . '30c8' . str_repeat('00', 8)));
+$clock->observe($remote);
+$reply = $clock->next();
+var_dump(strcmp($remote->getBytes(), $reply->getBytes()) < 0, $clock->getCounter());
+
+echo "Done\n";
+?>
+--EXPECT--
+bool(true)
+int(3)
+int(1)
+int(1)
+bool(true)
+int(3)
+int(1)
+bool(true)
+int(0)
+int(1)
+bool(true)
+int(201)
+Done
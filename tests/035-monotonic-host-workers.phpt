@@ -0,0 +1,50 @@
+--TEST--
+Host-wide monotonic ULID state keeps one sequence per worker ID
+--SKIPIF--
+<?php
+if (!extension_loaded("identifier")) print "skip";
+if (PHP_OS_FAMILY === "Windows") print "skip not supported on Windows";
+if (!function_exists('pcntl_fork')) print "skip pcntl required";
+?>
+--INI--
+identifier.monotonic_scope=host
+identifier.worker_bits=4
+--FILE--
+<?php
+use Identifier\Ulid;
+use Identifier\Uuid\Version7;
+
+// Test 1: ULIDs carry the worker ID of the process that issued them
+$parent = Ulid::generate();
+echo "parent: " . ($parent->getWorkerId() === Version7::generate()->getWorkerId() ? "YES" : "NO") . "\n";
+
+// Test 2: A forked worker with its own ID does not continue the parent's ULID
+$pipe = tempnam(sys_get_temp_dir(), 'ulid');
+$pid = pcntl_fork();
+if ($pid === 0) {
+    $ids = [];
+    for ($i = 0; $i < 100; $i++) {
+        $ids[] = Ulid::generate();
+    }
+    $own = Version7::generate()->getWorkerId();
+    $ok = true;
+    foreach ($ids as $i => $id) {
+        $ok = $ok && $id->getWorkerId() === $own && ($i === 0 || $ids[$i - 1]->compare($id) < 0);
+    }
+    file_put_contents($pipe, $ok ? "YES" : "NO");
+    exit(0);
+}
+pcntl_waitpid($pid, $status);
+echo "child: " . file_get_contents($pipe) . "\n";
+unlink($pipe);
+
+// Test 3: The parent continues its own sequence
+$next = Ulid::generate();
+echo "continued: " . ($parent->compare($next) < 0 && $next->getWorkerId() === $parent->getWorkerId() ? "YES" : "NO") . "\n";
+echo "Done\n";
+?>
+--EXPECT--
+parent: YES
+child: YES
+continued: YES
+Done
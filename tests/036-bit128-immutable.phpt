@@ -0,0 +1,75 @@
+--TEST--
+Identifiers cannot be changed in place, however they were created
+--SKIPIF--
+<?php if (!extension_loaded("identifier")) print "skip"; ?>
+--FILE--
+<?php
+use Identifier\Bit128;
+use Identifier\Bit128Set;
+use Identifier\Bit128Vector;
+use Identifier\Ulid;
+use Identifier\Uuid;
+use Identifier\Uuid\Version4;
+
+$bytes = str_repeat("\x01", 16);
+$hex = '0123456789abcdef0123456789abcdef';
+$raw = hex2bin($hex);
+
+$set = new Bit128Set();
+$set->add(Bit128::fromHex($hex));
+$vector = new Bit128Vector(Ulid::class);
+$vector->append(Ulid::generate());
+
+// Test 1: Every way of creating an identifier leaves it immutable
+$cases = [
+    'new' => new Bit128($raw),
+    'generate' => Ulid::generate(),
+    'Version4::generate' => Version4::generate(),
+    'fromString' => Uuid::fromString('550e8400-e29b-41d4-a716-446655440000'),
+    'fromHex' => Bit128::fromHex($hex),
+    'fromBytes' => Ulid::fromBytes($raw),
+    'tryFromString' => Ulid::tryFromString('01ARZ3NDEKTSV4RRFFQ69G5FAV'),
+    '__set_state' => Bit128::__set_state(['hex' => $hex]),
+    'unserialize' => unserialize(serialize(Ulid::generate())),
+    'generateBatch' => Ulid::generateBatch(2)[1],
+    'Bit128Vector' => $vector[0],
+    'Bit128Set' => $set->toVector()[0],
+    'clone' => clone Ulid::generate(),
+];
+foreach ($cases as $label => $id) {
+    $before = $id->getBytes();
+    try {
+        $id->__construct($bytes);
+        echo "$label: changed\n";
+    } catch (Exception $e) {
+        echo "$label: " . (str_starts_with($e->getMessage(), 'Cannot modify an already initialized') ? "locked" : $e->getMessage()) . "\n";
+    }
+    if ($id->getBytes() !== $before) {
+        echo "$label: payload changed\n";
+    }
+}
+
+// Test 2: __unserialize() is rejected the same way
+try {
+    Ulid::generate()->__unserialize([$bytes]);
+    echo "__unserialize: changed\n";
+} catch (Exception $e) {
+    echo "__unserialize: locked\n";
+}
+echo "Done\n";
+?>
+--EXPECT--
+new: locked
+generate: locked
+Version4::generate: locked
+fromString: locked
+fromHex: locked
+fromBytes: locked
+tryFromString: locked
+__set_state: locked
+unserialize: locked
+generateBatch: locked
+Bit128Vector: locked
+Bit128Set: locked
+clone: locked
+Done
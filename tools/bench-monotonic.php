@@ -0,0 +1,111 @@
+#!/usr/bin/env php
+<?php
+/**
+ * Monotonic scope benchmark
+ *
+ * Measures Identifier\ulid() throughput for each identifier.monotonic_scope
+ * with 1 to 64 concurrent workers. Workers are threads when ext-parallel is
+ * loaded (ZTS builds), otherwise forked processes. Thread scope is the
+ * per-worker baseline; process scope is only shared between threads and host
+ * scope between both threads and processes.
+ *
+ * Usage: php -d extension=identifier tools/bench-monotonic.php [seconds-per-run]
+ */
+
+if ($argc >= 2 && $argv[1] === '--run') {
+    // Child mode: one scope, one worker count
+    $workers = (int)$argv[2];
+    $seconds = (float)$argv[3];
+    echo json_encode(runWorkers($workers, $seconds)) . "\n";
+    exit(0);
+}
+
+/**
+ * Generate ULIDs until the deadline and report count and retry counters
+ */
+function work(float $seconds): array {
+    $deadline = microtime(true) + $seconds;
+    $count = 0;
+    while (microtime(true) < $deadline) {
+        for ($i = 0; $i < 1000; $i++) {
+            Identifier\ulid();
+        }
+        $count += 1000;
+    }
+    $stats = Identifier\stats()['monotonic'];
+    return ['count' => $count, 'retries' => $stats['retries']];
+}
+
+/**
+ * Run the workload on $workers threads or processes and sum the results
+ */
+function runWorkers(int $workers, float $seconds): array {
+    $results = [];
+
+    if (extension_loaded('parallel')) {
+        $futures = [];
+        for ($i = 0; $i < $workers; $i++) {
+            $runtime = new parallel\Runtime();
+            $futures[] = $runtime->run(function (float $seconds): array {
+                $deadline = microtime(true) + $seconds;
+                $count = 0;
+                while (microtime(true) < $deadline) {
+                    for ($i = 0; $i < 1000; $i++) {
+                        Identifier\ulid();
+                    }
+                    $count += 1000;
+                }
+                return ['count' => $count, 'retries' => Identifier\stats()['monotonic']['retries']];
+            }, [$seconds]);
+        }
+        foreach ($futures as $future) {
+            $results[] = $future->value();
+        }
+    } elseif (function_exists('pcntl_fork')) {
+        $files = [];
+        for ($i = 0; $i < $workers; $i++) {
+            $file = tempnam(sys_get_temp_dir(), 'bench');
+            $pid = pcntl_fork();
+            if ($pid === 0) {
+                file_put_contents($file, json_encode(work($seconds)));
+                exit(0);
+            }
+            $files[$pid] = $file;
+        }
+        foreach ($files as $pid => $file) {
+            pcntl_waitpid($pid, $status);
+            $results[] = json_decode(file_get_contents($file), true);
+            unlink($file);
+        }
+    } else {
+        $results[] = work($seconds);
+    }
+
+    return [
+        'count' => array_sum(array_column($results, 'count')),
+        'retries' => array_sum(array_column($results, 'retries')),
+    ];
+}
+
+$seconds = (float)($argv[1] ?? 1.0);
+$mode = extension_loaded('parallel') ? 'threads' : (function_exists('pcntl_fork') ? 'processes' : 'single worker');
+// Children load the extension the same way; a duplicate load only warns on stderr
+$extension = get_cfg_var('extension') ? '-d ' . escapeshellarg('extension=' . get_cfg_var('extension')) : '';
+
+echo "Monotonic scope benchmark ($mode, {$seconds}s per run)\n";
+printf("%-8s %8s %14s %14s %10s\n", 'scope', 'workers', 'ULIDs/sec', 'per worker', 'retries');
+
+foreach (['thread', 'process', 'host'] as $scope) {
+    foreach ([1, 2, 4, 8, 16, 32, 64] as $workers) {
+        $cmd = sprintf('%s %s -d display_errors=stderr -d identifier.monotonic_scope=%s %s --run %d %F',
+            escapeshellarg(PHP_BINARY), $extension, $scope, escapeshellarg(__FILE__), $workers, $seconds);
+        $result = json_decode(trim((string)shell_exec($cmd)), true);
+        if (!is_array($result)) {
+            echo "$scope/$workers: failed\n";
+            continue;
+        }
+        $rate = $result['count'] / $seconds;
+        printf("%-8s %8d %14s %14s %10d\n", $scope, $workers,
+            number_format($rate), number_format($rate / $workers), $result['retries']);
+    }
+}
@@ -65,6 +65,11 @@ function runTest($testFile, $extensionArg = '') {
     if ($extensionArg) {
         $cmd .= " -d $extensionArg";
     }
+    foreach (explode("\n", trim($sections['INI'] ?? '')) as $setting) {
+        if (trim($setting) !== '') {
+            $cmd .= ' -d ' . escapeshellarg(trim($setting));
+        }
+    }
     $cmd .= " $tempFile 2>&1";
 
     $actualOutput = trim(shell_exec($cmd) ?? '');